@@ -88,7 +88,8 @@ void OMR::CodeGenerator::createStackAtlas()
     TR::AutomaticSymbol *localCursor;
 
     for (localCursor = automaticIterator.getFirst(); localCursor; localCursor = automaticIterator.getNext()) {
-        if (localCursor->getGCMapIndex() < 0 && localCursor->isCollectedReference() && !localCursor->isLocalObject()
+        if (localCursor->getGCMapIndex() < 0 && localCursor->isCollectedReference()
+            && (!localCursor->isLocalObject() || localCursor->getReferenceSlots())
             && !localCursor->isInitializedReference() && !localCursor->isInternalPointer()
             && !localCursor->isPinningArrayPointer()) {
             localCursor->setGCMapIndex(slotIndex);
@@ -112,6 +113,20 @@ void OMR::CodeGenerator::createStackAtlas()
         localMap->setBit(i);
     }
 
+    // Only the reference slots of local objects hold references
+    //
+    for (localCursor = automaticIterator.getFirst(); localCursor; localCursor = automaticIterator.getNext()) {
+        if (localCursor->isLocalObject() && localCursor->getGCMapIndex() >= 0) {
+            int32_t mapIndex = localCursor->getGCMapIndex();
+            for (i = 0; i < (int32_t)localCursor->getNumberOfSlots(); ++i) {
+                localMap->resetBit(mapIndex + i);
+            }
+            for (int32_t *slot = localCursor->getReferenceSlots(); *slot; ++slot) {
+                localMap->setBit(mapIndex + *slot);
+            }
+        }
+    }
+
     self()->setMethodStackMap(localMap);
 
     // Now create the stack atlas
@@ -209,6 +224,10 @@ TR_GCStackMap *OMR::CodeGenerator::buildGCMapForInstruction(TR::Instruction *ins
                     // inside it. Otherwise, map the local itself.
                     //
                     if (localCursor->isLocalObject()) {
+                        int32_t *slot = localCursor->getReferenceSlots();
+                        for (; slot && *slot; ++slot) {
+                            map->setBit(mapIndex + *slot);
+                        }
                     } else if (localCursor->isCollectedReference() && !localCursor->isInternalPointer()
                         && !localCursor->isPinningArrayPointer()) {
                         map->setBit(mapIndex);
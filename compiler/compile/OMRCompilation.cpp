@@ -268,6 +268,9 @@ OMR::Compilation::Compilation(int32_t id, OMR_VMThread *omrVMThread, TR_FrontEnd
     , _scratchSpaceLimit(TR::Options::_scratchSpaceLimit)
     , _cpuTimeAtStartOfCompilation(-1)
     , _ilVerifier(NULL)
+    , _tieredMethodInfo(NULL)
+    , _methodProfile(NULL)
+    , _valueProfiles(std::less<TR::Node *>(), ValueProfileAllocator(self()->region()))
     , _gpuPtxList(m)
     , _gpuKernelLineNumberList(m)
     , _gpuPtxCount(0)
@@ -974,6 +977,9 @@ int32_t OMR::Compilation::compile()
             }
 #endif
 
+            if (_tieredMethodInfo)
+                OMR::Recompilation::insertTieredCompilationTrees(self(), _tieredMethodInfo);
+
             if (_recompilationInfo) {
                 _recompilationInfo->beforeOptimization();
             } else if (self()->getOptLevel() == -1) {
@@ -983,7 +989,9 @@ int32_t OMR::Compilation::compile()
             if (self()->getOption(TR_TraceAll))
                 self()->getDebug()->printMethodHotness(self()->log());
 
-            TR_DebuggingCounters::initializeCompilation();
+            // The inlining counters are only collected for one compilation at a time
+            if (self()->getOptions()->insertDebuggingCounters())
+                TR_DebuggingCounters::initializeCompilation();
             if (printCodegenTime)
                 optTime.startTiming(self());
 
@@ -1776,7 +1784,7 @@ bool OMR::Compilation::isVirtualGuardNOPingRequired(TR_VirtualGuard *virtualGuar
         return true;
 }
 
-bool OMR::Compilation::hasBlockFrequencyInfo() { return false; }
+bool OMR::Compilation::hasBlockFrequencyInfo() { return _methodProfile != NULL; }
 
 void OMR::Compilation::setUsesPreexistence(bool v)
 {
@@ -2524,6 +2532,14 @@ const TR::TypeLayout *OMR::Compilation::typeLayout(TR_OpaqueClassBlock *clazz)
     }
 }
 
+TR::ValueProfile *OMR::Compilation::getValueProfile(TR::Node *node)
+{
+    auto it = _valueProfiles.find(node);
+    return it != _valueProfiles.end() ? it->second : NULL;
+}
+
+void OMR::Compilation::setValueProfile(TR::Node *node, TR::ValueProfile *profile) { _valueProfiles[node] = profile; }
+
 TR::list<TR::Snippet *> *OMR::Compilation::getSnippetsToBePatchedOnClassRedefinition()
 {
     return self()->cg()->getSnippetsToBePatchedOnClassRedefinition();
@@ -94,6 +94,7 @@ class TR_ResolvedMethod;
 namespace OMR {
 class RetainedMethodSet;
 class RuntimeAssumption;
+class TieredMethodInfo;
 } // namespace OMR
 
 class TR_VirtualGuard;
@@ -112,6 +113,7 @@ class ILValidator;
 class Instruction;
 class KnownObjectTable;
 class LabelSymbol;
+class MethodProfile;
 class Node;
 class NodePool;
 class Options;
@@ -124,6 +126,7 @@ class SymbolReference;
 class SymbolReferenceTable;
 class TreeTop;
 class TypeLayout;
+class ValueProfile;
 } // namespace TR
 
 typedef TR::SparseBitVector SharedSparseBitVector;
@@ -910,6 +913,30 @@ public:
 
     void setIlVerifier(TR::IlVerifier *ilVerifier) { _ilVerifier = ilVerifier; }
 
+    /**
+     * \brief
+     *    Persistent state of the method when it is compiled with tiered compilation, or NULL
+     */
+    OMR::TieredMethodInfo *getTieredMethodInfo() { return _tieredMethodInfo; }
+
+    void setTieredMethodInfo(OMR::TieredMethodInfo *info) { _tieredMethodInfo = info; }
+
+    /**
+     * \brief
+     *    Profile collected by an earlier body of the method that this compilation optimizes with, or NULL
+     */
+    TR::MethodProfile *getMethodProfile() { return _methodProfile; }
+
+    void setMethodProfile(TR::MethodProfile *profile) { _methodProfile = profile; }
+
+    /**
+     * \brief
+     *    Values recorded for the given node by an earlier body of the method, or NULL
+     */
+    TR::ValueProfile *getValueProfile(TR::Node *node);
+
+    void setValueProfile(TR::Node *node, TR::ValueProfile *profile);
+
     typedef std::pair<const void * const, TR::DebugCounterBase *> DebugCounterEntry;
     typedef TR::typed_allocator<DebugCounterEntry, TR::Allocator> DebugCounterMapAllocator;
     typedef std::map<const void *, TR::DebugCounterBase *, std::less<const void *>, DebugCounterMapAllocator>
@@ -1568,6 +1595,12 @@ private:
     int64_t _cpuTimeAtStartOfCompilation;
 
     TR::IlVerifier *_ilVerifier;
+    OMR::TieredMethodInfo *_tieredMethodInfo;
+    TR::MethodProfile *_methodProfile;
+
+    typedef TR::typed_allocator<std::pair<TR::Node * const, TR::ValueProfile *>, TR::Region &> ValueProfileAllocator;
+    typedef std::map<TR::Node *, TR::ValueProfile *, std::less<TR::Node *>, ValueProfileAllocator> ValueProfileMap;
+    ValueProfileMap _valueProfiles;
 
     ListHeadAndTail<char *> _gpuPtxList;
     ListHeadAndTail<int32_t> _gpuKernelLineNumberList; // TODO: fix to get real line numbers
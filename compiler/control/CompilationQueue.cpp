@@ -0,0 +1,333 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "control/CompilationQueue.hpp"
+
+#include <new>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "control/CompileMethod.hpp"
+#include "env/CompilerEnv.hpp"
+#include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
+#include "infra/Assert.hpp"
+
+// The default omrthread stack is far too small for the compiler's recursive tree walks
+static const uintptr_t COMPILATION_THREAD_STACK_SIZE = 1024 * 1024;
+
+TR::CompilationFuture::CompilationFuture(TR::CompilationQueue *queue, TR::IlGeneratorMethodDetails &details,
+    TR_Hotness hotness, int32_t priority)
+    : _queue(queue)
+    , _next(NULL)
+    , _details(details)
+    , _hotness(hotness)
+    , _priority(priority)
+    , _state(Queued)
+    , _referenceCount(2)
+    , _rc(COMPILATION_REQUESTED)
+    , _startPC(NULL)
+{}
+
+bool TR::CompilationFuture::isDone()
+{
+    TR::CompilationQueue::attachCurrentThread();
+    omrthread_monitor_enter(_queue->_monitor);
+    bool done = _state == Done || _state == Cancelled;
+    omrthread_monitor_exit(_queue->_monitor);
+    return done;
+}
+
+uint8_t *TR::CompilationFuture::wait(int32_t &rc)
+{
+    TR::CompilationQueue::attachCurrentThread();
+    omrthread_monitor_enter(_queue->_monitor);
+    while (_state == Queued || _state == Compiling)
+        omrthread_monitor_wait(_queue->_monitor);
+    rc = _rc;
+    uint8_t *startPC = _startPC;
+    omrthread_monitor_exit(_queue->_monitor);
+    return startPC;
+}
+
+bool TR::CompilationFuture::cancel()
+{
+    TR::CompilationQueue::attachCurrentThread();
+    omrthread_monitor_enter(_queue->_monitor);
+    bool cancelled = _state == Queued;
+    if (cancelled) {
+        _queue->unlink(&_queue->_head, this);
+        _queue->_numQueued--;
+        _queue->finish(this, Cancelled, COMPILATION_REQUESTED, NULL);
+    }
+    omrthread_monitor_exit(_queue->_monitor);
+    return cancelled;
+}
+
+void TR::CompilationFuture::release()
+{
+    TR::CompilationQueue::attachCurrentThread();
+    TR::CompilationQueue *queue = _queue;
+    omrthread_monitor_enter(queue->_monitor);
+    TR_ASSERT_FATAL(_referenceCount > 1 || (_state != Queued && _state != Compiling),
+        "compilation future %p released more often than it was submitted", this);
+    if (_state == Queued && _referenceCount == 2) {
+        // the queue holds the only other reference, so nobody is interested in the result any more
+        queue->unlink(&queue->_head, this);
+        queue->_numQueued--;
+        queue->finish(this, Cancelled, COMPILATION_REQUESTED, NULL);
+    }
+    queue->releaseReference(this);
+    omrthread_monitor_exit(queue->_monitor);
+}
+
+TR::CompilationQueue::CompilationQueue(int32_t numThreads)
+    : _monitor(NULL)
+    , _threads(NULL)
+    , _numThreads(numThreads)
+    , _head(NULL)
+    , _compiling(NULL)
+    , _numQueued(0)
+    , _shuttingDown(false)
+{}
+
+TR::CompilationQueue *TR::CompilationQueue::create(int32_t numThreads)
+{
+    TR_ASSERT_FATAL(numThreads > 0, "a compilation queue needs at least one compilation thread");
+    attachCurrentThread();
+
+    TR::RawAllocator rawAllocator;
+    void *storage = rawAllocator.allocate(sizeof(CompilationQueue), std::nothrow);
+    if (storage == NULL)
+        return NULL;
+
+    CompilationQueue *queue = new (storage) CompilationQueue(numThreads);
+    if (!queue->startThreads()) {
+        destroy(queue);
+        return NULL;
+    }
+    return queue;
+}
+
+void TR::CompilationQueue::destroy(TR::CompilationQueue *queue)
+{
+    attachCurrentThread();
+    queue->stopThreads();
+    TR::RawAllocator rawAllocator = queue->_rawAllocator;
+    queue->~CompilationQueue();
+    rawAllocator.deallocate(queue);
+}
+
+bool TR::CompilationQueue::startThreads()
+{
+    if (omrthread_monitor_init_with_name(&_monitor, 0, "JIT-CompilationQueueMonitor") != 0) {
+        _monitor = NULL;
+        return false;
+    }
+
+    _threads = static_cast<omrthread_t *>(_rawAllocator.allocate(_numThreads * sizeof(omrthread_t), std::nothrow));
+    if (_threads == NULL)
+        return false;
+    for (int32_t i = 0; i < _numThreads; i++)
+        _threads[i] = NULL;
+
+    omrthread_attr_t attr = NULL;
+    if (omrthread_attr_init(&attr) != J9THREAD_SUCCESS)
+        return false;
+    omrthread_attr_set_name(&attr, "JIT Compilation Thread");
+    omrthread_attr_set_stacksize(&attr, COMPILATION_THREAD_STACK_SIZE);
+    omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+
+    bool started = true;
+    for (int32_t i = 0; i < _numThreads && started; i++) {
+        if (omrthread_create_ex(&_threads[i], &attr, 0, compilationThreadEntry, this) != J9THREAD_SUCCESS) {
+            _threads[i] = NULL;
+            started = false;
+        }
+    }
+
+    omrthread_attr_destroy(&attr);
+    return started;
+}
+
+void TR::CompilationQueue::stopThreads()
+{
+    if (_monitor != NULL) {
+        omrthread_monitor_enter(_monitor);
+        TR_ASSERT_FATAL(_head == NULL, "compilation queue destroyed with %d queued compilations that were not released",
+            _numQueued);
+        _shuttingDown = true;
+        omrthread_monitor_notify_all(_monitor);
+        omrthread_monitor_exit(_monitor);
+    }
+
+    if (_threads != NULL) {
+        for (int32_t i = 0; i < _numThreads; i++) {
+            if (_threads[i] != NULL)
+                omrthread_join(_threads[i]);
+        }
+        _rawAllocator.deallocate(_threads);
+        _threads = NULL;
+    }
+
+    if (_monitor != NULL)
+        omrthread_monitor_destroy(_monitor);
+    _monitor = NULL;
+}
+
+TR::CompilationFuture *TR::CompilationQueue::submit(TR::IlGeneratorMethodDetails &details, TR_Hotness hotness,
+    int32_t priority)
+{
+    attachCurrentThread();
+    omrthread_monitor_enter(_monitor);
+
+    CompilationFuture *future = findActive(details.getMethod());
+    if (future != NULL) {
+        future->_referenceCount++;
+        if (future->_state == CompilationFuture::Queued && priority > future->_priority) {
+            unlink(&_head, future);
+            future->_priority = priority;
+            enqueue(future);
+        }
+    } else {
+        void *storage = _rawAllocator.allocate(sizeof(CompilationFuture));
+        future = new (storage) CompilationFuture(this, details, hotness, priority);
+        enqueue(future);
+        _numQueued++;
+        omrthread_monitor_notify_all(_monitor);
+    }
+
+    omrthread_monitor_exit(_monitor);
+    return future;
+}
+
+int32_t TR::CompilationQueue::getNumQueued()
+{
+    attachCurrentThread();
+    omrthread_monitor_enter(_monitor);
+    int32_t numQueued = _numQueued;
+    omrthread_monitor_exit(_monitor);
+    return numQueued;
+}
+
+int J9THREAD_PROC TR::CompilationQueue::compilationThreadEntry(void *queue)
+{
+    static_cast<CompilationQueue *>(queue)->compilationThreadLoop();
+    return 0;
+}
+
+void TR::CompilationQueue::compilationThreadLoop()
+{
+    omrthread_monitor_enter(_monitor);
+    while (true) {
+        while (!_shuttingDown && _head == NULL)
+            omrthread_monitor_wait(_monitor);
+        if (_shuttingDown)
+            break;
+
+        CompilationFuture *future = _head;
+        _head = future->_next;
+        _numQueued--;
+        future->_state = CompilationFuture::Compiling;
+        future->_next = _compiling;
+        _compiling = future;
+        omrthread_monitor_exit(_monitor);
+
+        compile(future);
+
+        omrthread_monitor_enter(_monitor);
+    }
+    omrthread_monitor_exit(_monitor);
+
+    TR::Compiler->persistentAllocator().releaseThreadCache();
+}
+
+void TR::CompilationQueue::compile(TR::CompilationFuture *future)
+{
+    int32_t rc = COMPILATION_REQUESTED;
+
+    uint8_t *startPC = compileMethodFromDetails(NULL, future->_details, future->_hotness, rc);
+
+    omrthread_monitor_enter(_monitor);
+    unlink(&_compiling, future);
+    finish(future, CompilationFuture::Done, rc, rc == COMPILATION_SUCCEEDED ? startPC : NULL);
+    omrthread_monitor_exit(_monitor);
+}
+
+void TR::CompilationQueue::enqueue(TR::CompilationFuture *future)
+{
+    CompilationFuture **link = &_head;
+    while (*link != NULL && (*link)->_priority >= future->_priority)
+        link = &(*link)->_next;
+    future->_next = *link;
+    *link = future;
+}
+
+void TR::CompilationQueue::unlink(TR::CompilationFuture **list, TR::CompilationFuture *future)
+{
+    for (CompilationFuture **link = list; *link != NULL; link = &(*link)->_next) {
+        if (*link == future) {
+            *link = future->_next;
+            future->_next = NULL;
+            return;
+        }
+    }
+    TR_ASSERT_FATAL(false, "compilation future %p is not in the expected list", future);
+}
+
+TR::CompilationFuture *TR::CompilationQueue::findActive(TR::ResolvedMethod *method)
+{
+    for (CompilationFuture *future = _head; future != NULL; future = future->_next) {
+        if (future->_details.getMethod() == method)
+            return future;
+    }
+    for (CompilationFuture *future = _compiling; future != NULL; future = future->_next) {
+        if (future->_details.getMethod() == method)
+            return future;
+    }
+    return NULL;
+}
+
+void TR::CompilationQueue::releaseReference(TR::CompilationFuture *future)
+{
+    if (--future->_referenceCount == 0) {
+        future->~CompilationFuture();
+        _rawAllocator.deallocate(future);
+    }
+}
+
+void TR::CompilationQueue::finish(TR::CompilationFuture *future, TR::CompilationFuture::State state, int32_t rc,
+    uint8_t *startPC)
+{
+    future->_state = state;
+    future->_rc = rc;
+    future->_startPC = startPC;
+    omrthread_monitor_notify_all(_monitor);
+    releaseReference(future);
+}
+
+void TR::CompilationQueue::attachCurrentThread()
+{
+    omrthread_init_library();
+    if (omrthread_self() == NULL) {
+        omrthread_t self = NULL;
+        omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT);
+    }
+}
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef COMPILATIONQUEUE_INCL
+#define COMPILATIONQUEUE_INCL
+
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
+#include "env/RawAllocator.hpp"
+#include "ilgen/IlGeneratorMethodDetails.hpp"
+#include "thread_api.h"
+
+namespace TR {
+
+class CompilationQueue;
+
+/**
+ * The pending result of a compilation submitted to a TR::CompilationQueue.
+ *
+ * A future is shared by every submitter of the same method and by the queue itself, and stays
+ * valid until each submitter has called release(). Releasing the last submitter's reference to a
+ * compilation that has not started yet cancels it.
+ */
+class CompilationFuture {
+public:
+    enum State {
+        Queued,
+        Compiling,
+        Done,
+        Cancelled
+    };
+
+    /**
+     * @brief Returns whether the compilation has finished or was cancelled
+     */
+    bool isDone();
+
+    /**
+     * @brief Blocks until the compilation has finished or was cancelled
+     * @param rc is set to the compilation return code, or COMPILATION_REQUESTED if the compilation
+     *        was cancelled
+     * @return the entry point of the compiled body, or NULL if the compilation failed
+     */
+    uint8_t *wait(int32_t &rc);
+
+    /**
+     * @brief Removes the compilation from the queue if it has not started yet
+     * @return true if the compilation was cancelled, false if it already started or finished
+     */
+    bool cancel();
+
+    /**
+     * @brief Drops the caller's reference to this future
+     */
+    void release();
+
+    TR::IlGeneratorMethodDetails &details() { return _details; }
+
+    int32_t getPriority() const { return _priority; }
+
+private:
+    friend class CompilationQueue;
+
+    CompilationFuture(CompilationQueue *queue, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness,
+        int32_t priority);
+
+    CompilationQueue *_queue;
+    CompilationFuture *_next; ///< next request in the queue or in the list of compilations in progress
+    TR::IlGeneratorMethodDetails _details;
+    TR_Hotness _hotness;
+    int32_t _priority;
+    State _state;
+    int32_t _referenceCount; ///< submitters plus one for the queue while queued or compiling
+    int32_t _rc;
+    uint8_t *_startPC;
+};
+
+/**
+ * Compiles methods asynchronously on a pool of compilation threads.
+ *
+ * Requests are serviced in decreasing priority order, and in submission order for equal
+ * priorities. Submitting a method that is already queued or being compiled returns the future of
+ * the existing request, raising its priority if needed, rather than compiling the method twice.
+ *
+ * Each compilation runs through compileMethodFromDetails, so the compilation threads compile
+ * simultaneously, and the application may keep compiling synchronously while the queue is active
+ * (see compileMethodFromDetails for what is shared between compilations). The method objects
+ * referenced by the details of a request (the resolved method and its IL generator) must stay
+ * alive until its future is done.
+ *
+ * The queue uses the omrthread library. Threads calling into the queue are attached to the
+ * library if they are not attached already.
+ */
+class CompilationQueue {
+public:
+    /**
+     * @brief Creates a queue serviced by numThreads compilation threads
+     * @return the new queue, or NULL if the queue or its threads could not be created
+     */
+    static CompilationQueue *create(int32_t numThreads);
+
+    /**
+     * @brief Waits for the running compilations and stops the compilation threads
+     *
+     * Every future returned by the queue must have been released, which cancels the compilations
+     * that have not started.
+     */
+    static void destroy(CompilationQueue *queue);
+
+    /**
+     * @brief Queues a compilation of the method described by details
+     * @return the future of the compilation, which the caller must release
+     */
+    CompilationFuture *submit(TR::IlGeneratorMethodDetails &details, TR_Hotness hotness, int32_t priority = 0);
+
+    int32_t getNumQueued();
+
+    int32_t getNumThreads() const { return _numThreads; }
+
+private:
+    friend class CompilationFuture;
+
+    CompilationQueue(int32_t numThreads);
+
+    bool startThreads();
+    void stopThreads();
+
+    static int J9THREAD_PROC compilationThreadEntry(void *queue);
+    void compilationThreadLoop();
+    void compile(CompilationFuture *future);
+
+    void enqueue(CompilationFuture *future);
+    void unlink(CompilationFuture **list, CompilationFuture *future);
+    CompilationFuture *findActive(TR::ResolvedMethod *method);
+
+    void releaseReference(CompilationFuture *future);
+    void finish(CompilationFuture *future, CompilationFuture::State state, int32_t rc, uint8_t *startPC);
+
+    static void attachCurrentThread();
+
+    TR::RawAllocator _rawAllocator;
+    omrthread_monitor_t _monitor; ///< guards the queue and the state of every future
+    omrthread_t *_threads;
+    int32_t _numThreads;
+    CompilationFuture *_head; ///< queued requests in service order
+    CompilationFuture *_compiling; ///< requests being compiled
+    int32_t _numQueued;
+    bool _shuttingDown;
+};
+
+} // namespace TR
+
+#endif // COMPILATIONQUEUE_INCL
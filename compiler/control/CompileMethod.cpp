@@ -36,9 +36,13 @@
 #include "compile/Compilation.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/ResolvedMethod.hpp"
+#include "control/CompilationController.hpp"
+#include "control/CompilationStrategy.hpp"
+#include "control/MethodProfile.hpp"
 #include "control/OptimizationPlan.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
+#include "control/Recompilation.hpp"
 #include "env/CPU.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/IO.hpp"
@@ -62,31 +66,27 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "control/CompilationController.hpp"
 
-static void writePerfToolEntry(void *start, uint32_t size, const char *name)
+static FILE *openPerfToolFile()
 {
-    // race condition
-    static bool firstAttempt = true;
-    static FILE *perfFile = 0;
-
-    if (firstAttempt) {
-        firstAttempt = false;
 #if defined(OMR_OS_WINDOWS)
-        int jvmPid = _getpid();
+    int jvmPid = _getpid();
 #else
-        pid_t jvmPid = getpid();
+    pid_t jvmPid = getpid();
 #endif
-        static const int maxPerfFilenameSize = 15 + sizeof(jvmPid) * 3; // "/tmp/perf-%ld.map"
-        char perfFilename[maxPerfFilenameSize] = { 0 };
+    static const int maxPerfFilenameSize = 15 + sizeof(jvmPid) * 3; // "/tmp/perf-%ld.map"
+    char perfFilename[maxPerfFilenameSize] = { 0 };
+
+    bool truncated = TR::snprintfTrunc(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map",
+        static_cast<int64_t>(jvmPid));
+    return truncated ? NULL : fopen(perfFilename, "a");
+}
+
+static void writePerfToolEntry(void *start, uint32_t size, const char *name)
+{
+    // Entries can be written by several compilation threads at once. The file is opened by the
+    // first of them, and each entry is written with a single call so that lines do not interleave.
+    static FILE *perfFile = openPerfToolFile();
 
-        bool truncated = TR::snprintfTrunc(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map",
-            static_cast<int64_t>(jvmPid));
-        if (!truncated) {
-            perfFile = fopen(perfFilename, "a");
-        }
-        if (!perfFile) // couldn't open the file
-        {
-        }
-    }
     if (perfFile) {
         // perf does not want 0x leading the hex start address and length of the compiled code region
         // the rest of the line is considered to be the name of the region
@@ -256,8 +256,8 @@ uint8_t *compileMethod(OMR_VMThread *omrVMThread, TR_ResolvedMethod &compilee, T
     return compileMethodFromDetails(omrVMThread, details, hotness, rc);
 }
 
-uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness,
-    int32_t &rc)
+static uint8_t *compileMethodBody(OMR_VMThread *omrVMThread, TR::IlGeneratorMethodDetails &details,
+    TR_Hotness hotness, OMR::TieredMethodInfo *tieredInfo, int32_t &rc)
 {
     uint64_t translationStartTime = TR::Compiler->vm.getUSecClock();
     TR::FrontEnd *fe = TR::FrontEnd::instance();
@@ -321,6 +321,7 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
         }
 
         compiler.setIlVerifier(details.getIlVerifier());
+        compiler.setTieredMethodInfo(tieredInfo);
 
         if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileStart)) {
             const char *signature = compilee.signature(&trMemory);
@@ -428,3 +429,37 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
 
     return startPC;
 }
+
+uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness,
+    int32_t &rc)
+{
+    if (!TR::Options::getCmdLineOptions()->getOption(TR_EnableTieredCompilation))
+        return compileMethodBody(omrVMThread, details, hotness, NULL, rc);
+
+    // The requested hotness is superseded by the tiers of the compilation strategy
+    OMR::TieredMethodInfo *info
+        = new (PERSISTENT_NEW) OMR::TieredMethodInfo(details.getResolvedMethod(), details.getIlVerifier());
+    if (info == NULL) {
+        rc = COMPILATION_FAILED;
+        return 0;
+    }
+
+    TR_Hotness initialHotness = TR::CompilationController::getCompilationStrategy()->getInitialTieredHotness();
+    uint8_t *startPC = compileMethodBody(omrVMThread, details, initialHotness, info, rc);
+    if (startPC == 0) {
+        if (info->getProfile() != NULL)
+            TR::MethodProfile::destroy(info->getProfile());
+        OMR::TieredMethodInfo::jitPersistentFree(info);
+        return 0;
+    }
+
+    OMR::Recompilation::installTieredBody(info, initialHotness, startPC);
+    return startPC;
+}
+
+uint8_t *recompileMethod(OMR::TieredMethodInfo *info, TR_Hotness hotness, int32_t &rc)
+{
+    TR::IlGeneratorMethodDetails details(info->getMethod());
+    details.setIlVerifier(info->getIlVerifier());
+    return compileMethodBody(NULL, details, hotness, info, rc);
+}
@@ -25,6 +25,10 @@
 struct OMR_VMThread;
 class TR_ResolvedMethod;
 
+namespace OMR {
+class TieredMethodInfo;
+}
+
 namespace TR {
 class FrontEnd;
 class IlGeneratorMethodDetails;
@@ -34,5 +38,24 @@ class JitConfig;
 int32_t init_options(TR::JitConfig *jitConfig, char *cmdLineOptions);
 int32_t commonJitInit(TR::FrontEnd &fe, char *cmdLineOptions);
 uint8_t *compileMethod(OMR_VMThread *omrVMThread, TR_ResolvedMethod &compilee, TR_Hotness hotness, int32_t &rc);
+
+/**
+ * @brief Compiles the method described by details
+ *
+ * Several threads may compile different methods at the same time once the JIT is initialized.
+ * Each compilation has its own TR::Compilation, options and scratch memory. The state shared by
+ * compilations (the persistent allocator and TR::PersistentInfo, the code cache manager, the
+ * optimization plan pool and the command line options, which are only read) is safe for
+ * simultaneous use. Logging options write every compilation to the same log, so traces are only
+ * readable when one method is compiled at a time. The same method must not be compiled by two
+ * threads at once.
+ */
 uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness,
     int32_t &rc);
+
+/**
+ * @brief Compiles a new body of a method compiled with tiered compilation at the given hotness
+ *
+ * The body is not installed; see OMR::Recompilation::installTieredBody.
+ */
+uint8_t *recompileMethod(OMR::TieredMethodInfo *info, TR_Hotness hotness, int32_t &rc);
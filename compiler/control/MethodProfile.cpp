@@ -0,0 +1,260 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "control/MethodProfile.hpp"
+
+#include <algorithm>
+#include <string.h>
+#include <utility>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/CfgEdge.hpp"
+#include "infra/CfgNode.hpp"
+#include "infra/ILWalk.hpp"
+#include "infra/vector.hpp"
+#include "ras/Logger.hpp"
+
+typedef TR::vector<TR::Block *, TR::Region &> BlockList;
+typedef TR::vector<std::pair<TR::TreeTop *, TR::Node *>, TR::Region &> ProfiledNodeList;
+
+void TR::ValueProfile::recordValue(TR::ValueProfile *profile, int64_t value)
+{
+    for (int32_t i = 0; i < NumValues; i++) {
+        if (profile->_counts[i] == 0) {
+            profile->_values[i] = value;
+            profile->_counts[i] = 1;
+            return;
+        }
+
+        if (profile->_values[i] == value) {
+            profile->_counts[i]++;
+            return;
+        }
+    }
+
+    profile->_otherCount++;
+}
+
+uint64_t TR::ValueProfile::getTotalCount()
+{
+    uint64_t total = _otherCount;
+    for (int32_t i = 0; i < NumValues; i++)
+        total += _counts[i];
+    return total;
+}
+
+uint32_t TR::ValueProfile::getMostFrequentValue(int64_t &value)
+{
+    uint32_t maxCount = 0;
+    for (int32_t i = 0; i < NumValues; i++) {
+        if (_counts[i] > maxCount) {
+            maxCount = _counts[i];
+            value = _values[i];
+        }
+    }
+    return maxCount;
+}
+
+TR::MethodProfile::MethodProfile(int32_t numBlocks, int32_t numValueProfiles)
+    : _numBlocks(numBlocks)
+    , _numValueProfiles(numValueProfiles)
+    , _blockCounts(NULL)
+    , _valueProfiles(NULL)
+{
+    if (numBlocks > 0) {
+        _blockCounts = static_cast<uint32_t *>(jitPersistentAlloc(numBlocks * sizeof(uint32_t)));
+        memset(_blockCounts, 0, numBlocks * sizeof(uint32_t));
+    }
+
+    if (numValueProfiles > 0) {
+        _valueProfiles = static_cast<TR::ValueProfile *>(jitPersistentAlloc(numValueProfiles * sizeof(TR::ValueProfile)));
+        memset(_valueProfiles, 0, numValueProfiles * sizeof(TR::ValueProfile));
+    }
+}
+
+void TR::MethodProfile::destroy(TR::MethodProfile *profile)
+{
+    if (profile->_blockCounts != NULL)
+        jitPersistentFree(profile->_blockCounts);
+    if (profile->_valueProfiles != NULL)
+        jitPersistentFree(profile->_valueProfiles);
+    jitPersistentFree(profile);
+}
+
+bool TR::MethodProfile::isProfiledNode(TR::Node *node)
+{
+    switch (node->getOpCodeValue()) {
+        case TR::idiv:
+        case TR::irem:
+        case TR::ldiv:
+        case TR::lrem:
+            break;
+        default:
+            return false;
+    }
+
+    // The probe evaluates the divisor ahead of the tree that uses it, which only preserves the
+    // value of loads that nothing in the tree can change
+    TR::Node *divisor = node->getSecondChild();
+    return divisor->getOpCode().isLoadVarDirect() && divisor->getSymbol()->isAutoOrParm();
+}
+
+static void collectProfilePoints(TR::Compilation *comp, BlockList &blocks, ProfiledNodeList &nodes)
+{
+    for (TR::Block *block = comp->getStartTree()->getNode()->getBlock(); block; block = block->getNextBlock())
+        blocks.push_back(block);
+
+    for (TR::PreorderNodeIterator iter(comp->getStartTree(), comp); iter.currentTree(); ++iter) {
+        if (TR::MethodProfile::isProfiledNode(iter.currentNode()))
+            nodes.push_back(std::make_pair(iter.currentTree(), iter.currentNode()));
+    }
+}
+
+TR::MethodProfile *TR::MethodProfile::instrument(TR::Compilation *comp)
+{
+    TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
+    TR::Region &region = comp->trMemory()->currentStackRegion();
+    BlockList blocks(region);
+    ProfiledNodeList nodes(region);
+    collectProfilePoints(comp, blocks, nodes);
+
+    TR::MethodProfile *profile = new (PERSISTENT_NEW) TR::MethodProfile(static_cast<int32_t>(blocks.size()),
+        static_cast<int32_t>(nodes.size()));
+    TR::SymbolReferenceTable *symRefTab = comp->getSymRefTab();
+
+    for (size_t i = 0; i < blocks.size(); i++) {
+        TR::Node *node = blocks[i]->getEntry()->getNode();
+        TR::SymbolReference *counterSymRef
+            = symRefTab->createKnownStaticDataSymbolRef(&profile->_blockCounts[i], TR::Int32);
+        blocks[i]->prepend(TR::TreeTop::create(comp,
+            TR::Node::createStore(counterSymRef,
+                TR::Node::create(node, TR::iadd, 2, TR::Node::createLoad(node, counterSymRef),
+                    TR::Node::iconst(node, 1)))));
+    }
+
+    if (!nodes.empty()) {
+        static TR::DataType helperArgTypes[] = { TR::Address, TR::Int64 };
+        static const char *helperArgNames[] = { "profile", "value" };
+        TR::ResolvedMethod *helper = new (comp->trHeapMemory()) TR::ResolvedMethod("MethodProfile.cpp", "0",
+            "recordValue", 2, helperArgNames, helperArgTypes, TR::NoType,
+            reinterpret_cast<void *>(&TR::ValueProfile::recordValue), 0);
+        TR::SymbolReference *helperSymRef = symRefTab->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, helper);
+        helperSymRef->getSymbol()->castToMethodSymbol()->setLinkage(TR_System);
+
+        for (size_t i = 0; i < nodes.size(); i++) {
+            TR::Node *value = nodes[i].second->getSecondChild();
+            if (value->getDataType() != TR::Int64)
+                value = TR::Node::create(TR::i2l, 1, value);
+
+            TR::Node *call = TR::Node::createWithSymRef(TR::call, 2, 2,
+                TR::Node::aconst(value, reinterpret_cast<uintptr_t>(&profile->_valueProfiles[i])), value,
+                helperSymRef);
+            nodes[i].first->insertBefore(TR::TreeTop::create(comp, TR::Node::create(TR::treetop, 1, call)));
+        }
+    }
+
+    if (comp->getOption(TR_TraceAll))
+        comp->log()->printf("Method profile: added %d block counters and %d value profiling probes\n",
+            profile->_numBlocks, profile->_numValueProfiles);
+
+    return profile;
+}
+
+bool TR::MethodProfile::apply(TR::Compilation *comp)
+{
+    TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
+    TR::Region &region = comp->trMemory()->currentStackRegion();
+    BlockList blocks(region);
+    ProfiledNodeList nodes(region);
+    collectProfilePoints(comp, blocks, nodes);
+
+    if (static_cast<int32_t>(blocks.size()) != _numBlocks || static_cast<int32_t>(nodes.size()) != _numValueProfiles) {
+        if (comp->getOption(TR_TraceAll))
+            comp->log()->prints("Method profile: trees do not match the profiled trees, profile not used\n");
+        return false;
+    }
+
+    uint32_t maxCount = 0;
+    for (int32_t i = 0; i < _numBlocks; i++)
+        maxCount = std::max(maxCount, _blockCounts[i]);
+
+    if (maxCount == 0)
+        return false;
+
+    // Blocks that never ran get a frequency of zero; every other block is scaled to the hottest
+    // one without dropping into the range reserved for cold blocks
+    for (int32_t i = 0; i < _numBlocks; i++) {
+        uint32_t count = _blockCounts[i];
+        int32_t frequency = count == 0
+            ? 0
+            : std::max<int32_t>(MAX_COLD_BLOCK_COUNT + 1,
+                  static_cast<int32_t>(static_cast<uint64_t>(count) * MAX_BLOCK_COUNT / maxCount));
+        blocks[i]->setFrequency(frequency);
+    }
+
+    TR::CFG *cfg = comp->getFlowGraph();
+    cfg->getStart()->setFrequency(blocks[0]->getFrequency());
+    cfg->getEnd()->setFrequency(blocks[0]->getFrequency());
+
+    // Only block counts are recorded, so an edge gets the count of whichever end it is the only
+    // edge of
+    for (TR::CFGNode *node = cfg->getFirstNode(); node; node = node->getNext()) {
+        for (auto edge = node->getSuccessors().begin(); edge != node->getSuccessors().end(); ++edge) {
+            TR::CFGNode *to = (*edge)->getTo();
+            if (to->getPredecessors().size() == 1)
+                (*edge)->setFrequency(to->getFrequency());
+            else if (node->getSuccessors().size() == 1)
+                (*edge)->setFrequency(node->getFrequency());
+            else
+                (*edge)->setFrequency(std::min(node->getFrequency(), to->getFrequency()));
+        }
+    }
+
+    cfg->setMaxFrequency(MAX_BLOCK_COUNT);
+    cfg->setMaxEdgeFrequency(MAX_BLOCK_COUNT);
+
+    for (int32_t i = 0; i < _numValueProfiles; i++) {
+        if (_valueProfiles[i].getTotalCount() > 0)
+            comp->setValueProfile(nodes[i].second, &_valueProfiles[i]);
+    }
+
+    comp->setMethodProfile(this);
+
+    if (comp->getOption(TR_TraceAll))
+        comp->log()->printf("Method profile: set frequencies of %d blocks from %u entries\n", _numBlocks,
+            _blockCounts[0]);
+
+    return true;
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef METHODPROFILE_INCL
+#define METHODPROFILE_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+
+namespace TR {
+class Compilation;
+class Node;
+
+/**
+ * The most frequent values seen by a value profiling probe.
+ *
+ * Probes update the profile without synchronization, so the counts are approximate when several
+ * threads run the profiled code at the same time.
+ */
+class ValueProfile {
+public:
+    static const int32_t NumValues = 4;
+
+    /**
+     * @brief Called from compiled code to record a value
+     */
+    static void recordValue(TR::ValueProfile *profile, int64_t value);
+
+    /**
+     * @brief Returns the number of values recorded
+     */
+    uint64_t getTotalCount();
+
+    /**
+     * @brief Finds the most frequently recorded value
+     * @return the number of times the value was recorded, or 0 if no value was recorded
+     */
+    uint32_t getMostFrequentValue(int64_t &value);
+
+private:
+    int64_t _values[NumValues];
+    uint32_t _counts[NumValues];
+    uint32_t _otherCount; ///< values recorded once every slot was taken
+};
+
+/**
+ * Block execution counts and value profiles collected by a profiling body of a method, used to
+ * optimize later bodies of the same method.
+ *
+ * Blocks and profiled nodes are identified by their position in the trees right after IL
+ * generation, so a profile can only be applied to a compilation that generates the same IL.
+ * Values are profiled for the divisors of integer divisions and remainders that are loads of
+ * autos or parameters.
+ */
+class MethodProfile {
+public:
+    TR_PERSISTENT_ALLOC(TR_Memory::PersistentProfileInfo)
+
+    /**
+     * @brief Adds block counters and value profiling probes to the trees of a compilation
+     *
+     * Called once IL generation has finished, before the trees are optimized.
+     *
+     * @return the profile the compiled body updates
+     */
+    static TR::MethodProfile *instrument(TR::Compilation *comp);
+
+    /**
+     * @brief Frees a profile that no compiled body updates
+     */
+    static void destroy(TR::MethodProfile *profile);
+
+    /**
+     * @brief Sets the block and edge frequencies of a compilation from the block counts, and
+     *        makes the value profiles available through TR::Compilation::getValueProfile
+     *
+     * Called once IL generation has finished, before the trees are optimized.
+     *
+     * @return false if nothing was recorded or the trees do not match the profiled ones
+     */
+    bool apply(TR::Compilation *comp);
+
+    int32_t getNumBlocks() { return _numBlocks; }
+
+    uint32_t getBlockCount(int32_t index) { return _blockCounts[index]; }
+
+    int32_t getNumValueProfiles() { return _numValueProfiles; }
+
+    TR::ValueProfile *getValueProfile(int32_t index) { return &_valueProfiles[index]; }
+
+    /**
+     * @brief Returns whether values of the given node are profiled
+     */
+    static bool isProfiledNode(TR::Node *node);
+
+private:
+    MethodProfile(int32_t numBlocks, int32_t numValueProfiles);
+
+    int32_t _numBlocks;
+    int32_t _numValueProfiles;
+    uint32_t *_blockCounts; ///< incremented on entry to each block
+    TR::ValueProfile *_valueProfiles;
+};
+
+} // namespace TR
+
+#endif
@@ -21,4 +21,25 @@
 
 #include "control/CompilationStrategy.hpp"
 
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+
 TR::CompilationStrategy *OMR::CompilationStrategy::self() { return static_cast<TR::CompilationStrategy *>(this); }
+
+TR_Hotness OMR::CompilationStrategy::getNextTieredHotness(TR_Hotness hotness)
+{
+    switch (hotness) {
+        case noOpt:
+        case cold:
+            return warm;
+        // The OMR hot strategy still refers to optimizations only downstream projects provide, so
+        // warm bodies are final unless a project overrides this
+        default:
+            return unknownHotness;
+    }
+}
+
+int32_t OMR::CompilationStrategy::getTieredRecompilationCount(TR_Hotness hotness)
+{
+    return TR::Options::getCmdLineOptions()->getTieredCompilationCount();
+}
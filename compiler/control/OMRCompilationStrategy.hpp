@@ -34,6 +34,8 @@ typedef OMR::CompilationStrategy CompilationStrategyConnector;
 } // namespace OMR
 #endif
 
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
 #include "env/TRMemory.hpp"
 
 class TR_OptimizationPlan;
@@ -66,6 +68,23 @@ public:
     void shutdown() {} // called at shutdown time; useful for stats
 
     bool enableSwitchToProfiling() { return true; } // turn profiling on during optimizations
+
+    /**
+     * @brief Returns the hotness of the first body of a method compiled with tiered compilation
+     */
+    TR_Hotness getInitialTieredHotness() { return cold; }
+
+    /**
+     * @brief Returns the hotness to recompile a method at when the counter of its body compiled at
+     *        the given hotness expires, or unknownHotness if that body is final
+     */
+    TR_Hotness getNextTieredHotness(TR_Hotness hotness);
+
+    /**
+     * @brief Returns the number of invocations and loop iterations a body compiled at the given
+     *        hotness runs before the method is recompiled
+     */
+    int32_t getTieredRecompilationCount(TR_Hotness hotness);
 };
 } // namespace OMR
 
@@ -704,6 +704,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "disableLoopStrider", "O\tdisable loop strider", TR::Options::disableOptimization, loopStrider, 0, "P" },
     { "disableLoopTransfer", "O\tdisable the loop transfer part of loop versioner",
      SET_OPTION_BIT(TR_DisableLoopTransfer), "F" },
+    { "disableLoopVectorizer", "O\tdisable loop vectorizer", TR::Options::disableOptimization, loopVectorizer, 0, "P" },
     { "disableLoopVersioner", "O\tdisable loop versioner", TR::Options::disableOptimization, loopVersioner, 0, "P" },
     { "disableMarkingOfHotFields", "O\tdisable marking of Hot Fields", SET_OPTION_BIT(TR_DisableMarkingOfHotFields),
      "F" },
@@ -894,6 +895,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_DisableSIMDUTF16BEEncoder), "F" },
     { "disableSIMDUTF16LEEncoder", "M\tdisable inlining of SIMD UTF16 Little Endian encoder",
      SET_OPTION_BIT(TR_DisableSIMDUTF16LEEncoder), "F" },
+    { "disableSLPVectorizer", "O\tdisable superword level parallelism vectorizer", TR::Options::disableOptimization,
+     slpVectorizer, 0, "P" },
     { "disableSmartPlacementOfCodeCaches",
      "O\tdisable placement of code caches in memory so they are near each other and the DLLs", SET_OPTION_BIT(TR_DisableSmartPlacementOfCodeCaches), "F", NOT_IN_SUBSET },
     { "disableSSE3", "C\tdisable sse 3 and newer on x86", TR::Options::disableCPUFeatures, TR_DisableSSE3, 0, "F" },
@@ -1362,6 +1365,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_EnableSymbolValidationManager), "F" },
     { "enableThisLiveRangeExtension", "R\tenable this live range extension to the end of the method",
      SET_OPTION_BIT(TR_EnableThisLiveRangeExtension), "F" },
+    { "enableTieredCompilation", "O\tcompile methods at cold first and recompile them at warm when they keep running",
+     SET_OPTION_BIT(TR_EnableTieredCompilation), "F" },
+    { "enableTieredProfiling", "O\tcollect block counts and values in tiered compilation bodies and optimize the next body with them",
+     SET_OPTION_BIT(TR_EnableTieredProfiling), "F" },
     { "enableTM", "O\tenable transactional memory support", SET_OPTION_BIT(TR_EnableTM), "F" },
     { "enableTraps", "C\tenable trap instructions", RESET_OPTION_BIT(TR_DisableTraps), "F" },
     { "enableTreePatternMatching", "O\tEnable opts that use the TR_Pattern framework",
@@ -1869,6 +1876,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      TR::Options::set32BitNumeric, offsetof(OMR::Options, _test390LitPoolBuffer), 0, "F%d" },
     { "test390StackBufferSize=", "L\tInsert buffer in stack to force testing of large stack sizes",
      TR::Options::set32BitNumeric, offsetof(OMR::Options, _test390StackBuffer), 0, "F%d" },
+    { "tieredCompilationCount=", "O<nnn>\tnumber of invocations and loop iterations before a cold body is recompiled",
+     TR::Options::set32BitNumeric, offsetof(OMR::Options, _tieredCompilationCount), 0, "F%d" },
     { "timing", "M\ttime individual phases and optimizations", SET_OPTION_BIT(TR_Timing), "F" },
     { "timingCumulative", "M\ttime cumulative phases (ILgen,Optimizer,codegen)", SET_OPTION_BIT(TR_CummTiming), "F" },
 #if defined(TR_HOST_X86) || defined(TR_HOST_POWER)
@@ -2016,6 +2025,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "traceLoopReduction", "L\ttrace loop reduction", TR::Options::traceOptimization, loopReduction, 0, "P" },
     { "traceLoopReplicator", "L\ttrace loop replicator", TR::Options::traceOptimization, loopReplicator, 0, "P" },
     { "traceLoopStrider", "L\ttrace loop strider", TR::Options::traceOptimization, loopStrider, 0, "P" },
+    { "traceLoopVectorizer", "L\ttrace loop vectorizer", TR::Options::traceOptimization, loopVectorizer, 0, "P" },
     { "traceLoopVersioner", "L\ttrace loop versioner", TR::Options::traceOptimization, loopVersioner, 0, "P" },
     { "traceMarkingOfHotFields", "M\ttrace marking of Hot Fields", SET_OPTION_BIT(TR_TraceMarkingOfHotFields), "F" },
     { "traceMethodHandleTransformer", "L\ttrace MethodHandle transformer", TR::Options::traceOptimization,
@@ -2087,6 +2097,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "traceSequentialStoreSimplification", "L\ttrace sequential load or store simplification",
      TR::Options::traceOptimization, sequentialStoreSimplification, 0, "P" },
 #endif
+    { "traceSLPVectorizer", "L\ttrace superword level parallelism vectorizer", TR::Options::traceOptimization,
+     slpVectorizer, 0, "P" },
     { "traceStaticFinalFieldFolding", "L\ttrace generic static final field folding", TR::Options::traceOptimization,
      staticFinalFieldFolding, 0, "P" },
     { "traceStringBuilderTransformer", "L\ttrace StringBuilder transformer optimization",
@@ -2925,6 +2937,7 @@ void OMR::Options::initialize()
     _isAOTCompile = false;
     _jProfilingMethodRecompThreshold = 0;
     _jProfilingLoopRecompThreshold = 0;
+    _tieredCompilationCount = 0;
     _blockShufflingSequence = NULL;
     _randomSeed = 0;
     _loggerListForOtherCompThreads = NULL;
@@ -3645,6 +3658,7 @@ void OMR::Options::jitPreProcess()
     _lastIpaOptTransformationIndex = INT_MAX;
     _jProfilingMethodRecompThreshold = 4000;
     _jProfilingLoopRecompThreshold = 2000;
+    _tieredCompilationCount = 1000;
     _blockShufflingSequence = (char *)"S";
     _delayCompileWithCPUBurn = 0;
     _largeNumberOfLoops = 6500;
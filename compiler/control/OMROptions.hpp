@@ -447,7 +447,7 @@ enum TR_CompilationOptions {
     TR_EnableSelectiveEnterExitHooks                         = 0x00000080 + 11,
     TR_EnableUseDefBasedVectorAPIExpansion                   = 0x00000100 + 11,
     TR_DisableDirectMemoryStore                              = 0x00000200 + 11,
-    // Available                                             = 0x00000400 + 11,
+    TR_EnableTieredCompilation                               = 0x00000400 + 11,
     TR_DisableConstProvenance                                = 0x00000800 + 11,
     TR_DisableITableIterationsAfterLastITableCacheCheck      = 0x00001000 + 11,
     TR_VerboseOptTransformations                             = 0x00002000 + 11,
@@ -474,7 +474,7 @@ enum TR_CompilationOptions {
     TR_ForceTRIOForLoggers                                   = 0x00000040 + 12,
     TR_DisablePartialInlining                                = 0x00000080 + 12,
     TR_AssumeStartupPhaseUntilToldNotTo                      = 0x00000100 + 12,
-    // Available                                             = 0x00000200 + 12,
+    TR_EnableTieredProfiling                                 = 0x00000200 + 12,
     TR_DisableAOTBytesCompression                            = 0x00000400 + 12,
     TR_X86UseMFENCE                                          = 0x00000800 + 12,
     // Available                                             = 0x00001000 + 12,
@@ -2262,6 +2262,11 @@ public:
      */
     int32_t getJProfilingLoopRecompThreshold() { return _jProfilingLoopRecompThreshold; }
 
+    /**   \brief Returns the number of invocations and loop iterations before a method compiled with
+     *           tiered compilation is recompiled at the next hotness
+     */
+    int32_t getTieredCompilationCount() { return _tieredCompilationCount; }
+
     inline static float getMinProfiledCheckcastFrequency() { return _minProfiledCheckcastFrequency / ((float)100.0); }
 
     static bool isQuickstartDetected() { return _quickstartDetected; }
@@ -2870,6 +2875,7 @@ protected:
 
     int32_t _jProfilingMethodRecompThreshold;
     int32_t _jProfilingLoopRecompThreshold;
+    int32_t _tieredCompilationCount;
     char *_blockShufflingSequence;
     int32_t _randomSeed;
     TR_MCTLogs *_loggerListForOtherCompThreads;
@@ -25,22 +25,42 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include "AtomicSupport.hpp"
 #include "codegen/CodeGenerator.hpp"
 #include "env/FrontEnd.hpp"
 #include "compile/Compilation.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/ResolvedMethod.hpp"
 #include "compile/SymbolReferenceTable.hpp"
+#include "control/CompilationController.hpp"
+#include "control/CompilationStrategy.hpp"
+#include "control/CompileMethod.hpp"
+#include "control/MethodProfile.hpp"
 #include "control/OptimizationPlan.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "env/PersistentInfo.hpp"
+#include "env/StackMemoryRegion.hpp"
 #include "env/TRMemory.hpp"
+#include "env/VerboseLog.hpp"
 #include "env/jittypes.h"
+#include "il/Block.hpp"
 #include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ParameterSymbol.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
 #include "infra/Assert.hpp"
+#include "infra/Cfg.hpp"
 #include "infra/Link.hpp"
+#include "infra/List.hpp"
 #include "infra/Timer.hpp"
+#include "infra/vector.hpp"
 
 class TR_OpaqueMethodBlock;
 
@@ -56,3 +76,193 @@ OMR::Recompilation::Recompilation(TR::Compilation *comp)
 void OMR::Recompilation::shutdown() {}
 
 TR::Recompilation *OMR::Recompilation::self() { return static_cast<TR::Recompilation *>(this); }
+
+static bool canForwardInvocations(TR::ResolvedMethodSymbol *methodSymbol)
+{
+    switch (methodSymbol->getResolvedMethod()->returnType()) {
+        case TR::NoType:
+        case TR::Int8:
+        case TR::Int16:
+        case TR::Int32:
+        case TR::Int64:
+        case TR::Float:
+        case TR::Double:
+        case TR::Address:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void OMR::Recompilation::insertTieredCompilationTrees(TR::Compilation *comp, OMR::TieredMethodInfo *info)
+{
+    TR::ResolvedMethodSymbol *methodSymbol = comp->getMethodSymbol();
+    TR::CFG *cfg = methodSymbol->getFlowGraph();
+    TR::SymbolReferenceTable *symRefTab = comp->getSymRefTab();
+
+    if (info->_profile != NULL)
+        info->_profile->apply(comp);
+
+    if (!canForwardInvocations(methodSymbol)) {
+        if (comp->getOption(TR_TraceAll))
+            comp->log()->prints("Tiered compilation: return type cannot be forwarded, compiling a final body\n");
+        return;
+    }
+
+    TR::CompilationStrategy *strategy = TR::CompilationController::getCompilationStrategy();
+    bool isFinalBody = strategy->getNextTieredHotness(comp->getMethodHotness()) == unknownHotness;
+
+    if (!isFinalBody) {
+        // The previous profile is not freed since the bodies that update it may still be running
+        if (comp->getOption(TR_EnableTieredProfiling))
+            info->_profile = TR::MethodProfile::instrument(comp);
+
+        static TR::DataType helperArgTypes[] = { TR::Address };
+        static const char *helperArgNames[] = { "info" };
+        TR::ResolvedMethod *helper = new (comp->trHeapMemory()) TR::ResolvedMethod("OMRRecompilation.cpp", "0",
+            "tieredCounterExpired", 1, helperArgNames, helperArgTypes, TR::NoType,
+            reinterpret_cast<void *>(&OMR::Recompilation::tieredCounterExpired), 0);
+        TR::SymbolReference *helperSymRef = symRefTab->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, helper);
+        helperSymRef->getSymbol()->castToMethodSymbol()->setLinkage(TR_System);
+        TR::SymbolReference *counterSymRef = symRefTab->findOrCreateRecompilationCounterSymbolRef(&info->_counter);
+
+        // Count loop iterations at the targets of the back edges of a depth-first walk of the CFG
+        TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
+        TR::Region &region = comp->trMemory()->currentStackRegion();
+        typedef std::pair<TR::CFGNode *, TR::CFGEdgeList::iterator> WalkEntry;
+        TR::vector<WalkEntry, TR::Region &> walk(region);
+        TR::vector<uint8_t, TR::Region &> state(cfg->getNextNodeNumber(), 0, region); // 1 on the walk, 2 done
+        TR::vector<TR::Block *, TR::Region &> loopHeaders(region);
+
+        state[cfg->getStart()->getNumber()] = 1;
+        walk.push_back(WalkEntry(cfg->getStart(), cfg->getStart()->getSuccessors().begin()));
+        while (!walk.empty()) {
+            WalkEntry &top = walk.back();
+            if (top.second == top.first->getSuccessors().end()) {
+                state[top.first->getNumber()] = 2;
+                walk.pop_back();
+                continue;
+            }
+
+            TR::CFGNode *succ = (*top.second)->getTo();
+            ++top.second;
+            if (state[succ->getNumber()] == 1) {
+                TR::Block *header = toBlock(succ);
+                if (std::find(loopHeaders.begin(), loopHeaders.end(), header) == loopHeaders.end())
+                    loopHeaders.push_back(header);
+            } else if (state[succ->getNumber()] == 0) {
+                state[succ->getNumber()] = 1;
+                walk.push_back(WalkEntry(succ, succ->getSuccessors().begin()));
+            }
+        }
+
+        for (auto it = loopHeaders.begin(); it != loopHeaders.end(); ++it)
+            insertCounterTrees(comp, *it, counterSymRef, helperSymRef, info);
+        insertCounterTrees(comp, methodSymbol->prependEmptyFirstBlock(), counterSymRef, helperSymRef, info);
+    }
+
+    // Forward invocations of this body to the current one once the method has been recompiled
+    TR::Block *checkBlock = methodSymbol->prependEmptyFirstBlock();
+    TR::Node *node = checkBlock->getEntry()->getNode();
+    TR::Block *forwardBlock = TR::Block::createEmptyBlock(node, comp, 0);
+    cfg->addNode(forwardBlock);
+    methodSymbol->getLastTreeTop()->join(forwardBlock->getEntry());
+
+    TR::DataType returnType = methodSymbol->getResolvedMethod()->returnType();
+    TR::SymbolReference *targetSymRef
+        = symRefTab->findOrCreateComputedStaticMethodSymbol(JITTED_METHOD_INDEX, -1, comp->getCurrentMethod());
+    targetSymRef->getSymbol()->castToMethodSymbol()->setLinkage(TR_System);
+
+    TR::Node *call = TR::Node::createWithSymRef(node, TR::ILOpCode::getIndirectCall(returnType),
+        methodSymbol->getParameterList().getSize() + 1, targetSymRef);
+    call->setAndIncChild(0,
+        TR::Node::createLoad(node, symRefTab->createKnownStaticDataSymbolRef(&info->_startPC, TR::Address)));
+    ListIterator<TR::ParameterSymbol> parms(&methodSymbol->getParameterList());
+    for (TR::ParameterSymbol *p = parms.getFirst(); p != NULL; p = parms.getNext())
+        call->setAndIncChild(p->getOrdinal() + 1, TR::Node::createLoad(node, methodSymbol->getParmSymRef(p->getSlot())));
+
+    forwardBlock->append(TR::TreeTop::create(comp, TR::Node::create(TR::treetop, 1, call)));
+    if (returnType == TR::NoType)
+        forwardBlock->append(TR::TreeTop::create(comp, TR::Node::create(node, TR::Return, 0)));
+    else
+        forwardBlock->append(TR::TreeTop::create(comp, TR::Node::create(node, TR::ILOpCode::returnOpCode(returnType), 1, call)));
+    cfg->addEdge(forwardBlock, cfg->getEnd());
+
+    TR::SymbolReference *generationSymRef = symRefTab->createKnownStaticDataSymbolRef(&info->_generation, TR::Int32);
+    checkBlock->append(TR::TreeTop::create(comp,
+        TR::Node::createif(TR::ificmpne, TR::Node::createLoad(node, generationSymRef),
+            TR::Node::iconst(node, info->_generation + 1), forwardBlock->getEntry())));
+    cfg->addEdge(checkBlock, forwardBlock);
+
+    if (comp->getOption(TR_TraceAll))
+        comp->log()->printf("Tiered compilation: inserted %s for generation %d\n",
+            isFinalBody ? "forwarding check" : "recompilation counters and forwarding check", info->_generation + 1);
+}
+
+void OMR::Recompilation::insertCounterTrees(TR::Compilation *comp, TR::Block *block,
+    TR::SymbolReference *counterSymRef, TR::SymbolReference *helperSymRef, OMR::TieredMethodInfo *info)
+{
+    TR::CFG *cfg = comp->getFlowGraph();
+    TR::Node *node = block->getEntry()->getNode();
+    TR::TreeTop *firstTree = block->getFirstRealTreeTop();
+    bool isEmpty = firstTree == block->getExit();
+
+    //    counter = counter - 1
+    //    ificmpgt --> continuation (counter, 0)
+    //    call tieredCounterExpired(info)
+    // continuation:
+    TR::Node *decrement = TR::Node::createStore(counterSymRef,
+        TR::Node::create(node, TR::isub, 2, TR::Node::createLoad(node, counterSymRef), TR::Node::iconst(node, 1)));
+    TR::Node *call = TR::Node::createWithSymRef(node, TR::call, 1,
+        TR::Node::aconst(node, reinterpret_cast<uintptr_t>(info)), helperSymRef);
+    TR::TreeTop *decrementTree = block->prepend(TR::TreeTop::create(comp, decrement));
+    TR::TreeTop *callTree = TR::TreeTop::create(comp, decrementTree, TR::Node::create(TR::treetop, 1, call));
+
+    TR::Block *continuation = isEmpty ? block->getNextBlock() : block->split(firstTree, cfg);
+    block->split(callTree, cfg);
+    block->append(TR::TreeTop::create(comp,
+        TR::Node::createif(TR::ificmpgt, TR::Node::createLoad(node, counterSymRef), TR::Node::iconst(node, 0),
+            continuation->getEntry())));
+    cfg->addEdge(block, continuation);
+}
+
+void OMR::Recompilation::installTieredBody(OMR::TieredMethodInfo *info, TR_Hotness hotness, uint8_t *startPC)
+{
+    TR::CompilationStrategy *strategy = TR::CompilationController::getCompilationStrategy();
+
+    info->_startPC = startPC;
+    info->_hotness = hotness;
+    info->_counter = strategy->getNextTieredHotness(hotness) == unknownHotness
+        ? INT_MAX
+        : strategy->getTieredRecompilationCount(hotness);
+
+    // Older bodies read the start PC once they see the new generation
+    VM_AtomicSupport::writeBarrier();
+    info->_generation++;
+
+    if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseRecompile))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "tiered compilation installed body %d of %s at %s: %p",
+            info->_generation, info->_method->nameChars(), TR::Compilation::getHotnessName(hotness), startPC);
+}
+
+void OMR::Recompilation::tieredCounterExpired(OMR::TieredMethodInfo *info)
+{
+    // Only one thread recompiles; the others keep running the current body
+    if (VM_AtomicSupport::lockCompareExchangeU32(&info->_recompiling, 0, 1) != 0)
+        return;
+
+    TR_Hotness nextHotness = TR::CompilationController::getCompilationStrategy()->getNextTieredHotness(info->_hotness);
+    info->_counter = INT_MAX;
+
+    if (nextHotness != unknownHotness) {
+        int32_t rc = COMPILATION_REQUESTED;
+        uint8_t *startPC = recompileMethod(info, nextHotness, rc);
+
+        // If the compilation failed, the current body stays in use with its counter effectively disabled
+        if (startPC != NULL)
+            installTieredBody(info, nextHotness, startPC);
+    }
+
+    VM_AtomicSupport::writeBarrier();
+    info->_recompiling = 0;
+}
@@ -37,15 +37,83 @@ typedef OMR::Recompilation RecompilationConnector;
 #include <stddef.h>
 #include <stdint.h>
 #include "compile/Compilation.hpp"
+#include "compile/CompilationTypes.hpp"
 #include "env/TRMemory.hpp"
 
+class TR_ResolvedMethod;
+
 namespace TR {
+class Block;
+class IlVerifier;
 class Instruction;
+class MethodProfile;
 class Recompilation;
+class SymbolReference;
 } // namespace TR
 
 namespace OMR {
 
+/**
+ * Persistent state of a method compiled with tiered compilation.
+ *
+ * Every body of the method except the one compiled at the final hotness decrements the counter on
+ * entry and at each loop header, and calls OMR::Recompilation::tieredCounterExpired when it drops
+ * to zero to have the method recompiled at the next hotness. A body checks the generation on
+ * entry and forwards the invocation to the current body once it has been replaced, so the entry
+ * point of the first body stays valid for the life of the method. With tiered profiling enabled,
+ * the non-final bodies also collect a TR::MethodProfile that the next body is optimized with.
+ *
+ * The resolved method and IL verifier must stay alive as long as the method can be recompiled.
+ */
+class TieredMethodInfo {
+public:
+    TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo)
+
+    TieredMethodInfo(TR_ResolvedMethod *method, TR::IlVerifier *ilVerifier)
+        : _counter(0)
+        , _generation(0)
+        , _startPC(NULL)
+        , _method(method)
+        , _ilVerifier(ilVerifier)
+        , _hotness(unknownHotness)
+        , _recompiling(0)
+        , _profile(NULL)
+    {}
+
+    TR_ResolvedMethod *getMethod() { return _method; }
+
+    TR::IlVerifier *getIlVerifier() { return _ilVerifier; }
+
+    /**
+     * @brief Returns the hotness of the current body, or unknownHotness before the first body
+     *        is installed
+     */
+    TR_Hotness getHotness() { return _hotness; }
+
+    uint8_t *getStartPC() { return _startPC; }
+
+    int32_t getGeneration() { return _generation; }
+
+    int32_t getCounter() { return _counter; }
+
+    /**
+     * @brief Returns the profile collected by the most recent profiling body, or NULL
+     */
+    TR::MethodProfile *getProfile() { return _profile; }
+
+private:
+    friend class OMR::Recompilation;
+
+    int32_t _counter; ///< decremented by the generated code
+    int32_t _generation; ///< number of bodies installed so far
+    uint8_t *_startPC; ///< entry point of the current body
+    TR_ResolvedMethod *_method;
+    TR::IlVerifier *_ilVerifier;
+    TR_Hotness _hotness;
+    uint32_t _recompiling;
+    TR::MethodProfile *_profile;
+};
+
 class Recompilation {
 public:
     TR_ALLOC(TR_Memory::Recompilation)
@@ -72,6 +140,26 @@ public:
 
     static void shutdown();
 
+    /**
+     * @brief Adds the recompilation counters and the forwarding check to the trees of a body
+     *        of a method compiled with tiered compilation
+     *
+     * Called once IL generation has finished, before the trees are optimized. The profile
+     * collected by the previous body is applied first, and non-final bodies are instrumented
+     * to collect a new one when tiered profiling is enabled.
+     */
+    static void insertTieredCompilationTrees(TR::Compilation *comp, OMR::TieredMethodInfo *info);
+
+    /**
+     * @brief Makes the body compiled at the given hotness the current body of the method
+     */
+    static void installTieredBody(OMR::TieredMethodInfo *info, TR_Hotness hotness, uint8_t *startPC);
+
+    /**
+     * @brief Called from compiled code when the recompilation counter of a method drops to zero
+     */
+    static void tieredCounterExpired(OMR::TieredMethodInfo *info);
+
 protected:
     Recompilation(TR::Compilation *);
 
@@ -84,6 +172,10 @@ protected:
     TR_HeapMemory trHeapMemory() { return trMemory(); }
 
     TR::Compilation *_compilation;
+
+private:
+    static void insertCounterTrees(TR::Compilation *comp, TR::Block *block, TR::SymbolReference *counterSymRef,
+        TR::SymbolReference *helperSymRef, OMR::TieredMethodInfo *info);
 };
 
 } // namespace OMR
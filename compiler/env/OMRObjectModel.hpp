@@ -138,6 +138,12 @@ public:
 
     uintptr_t objectHeaderSizeInBytes() { return 0; }
 
+    /**
+     * @brief: Returns true if objects that are proven not to escape the compiled method may be
+     *         replaced by scalars or allocated in its stack frame instead of on the heap
+     */
+    bool canAllocateNonEscapingObjectsOnStack() { return true; }
+
     uintptr_t offsetOfIndexableSizeField() { return 0; }
 
     /**
@@ -21,18 +21,324 @@
 
 #include "env/PersistentAllocator.hpp"
 
+#include <string.h>
+#include "AtomicSupport.hpp"
+#include "infra/ThreadLocal.hpp"
+
+#if defined(SUPPORTS_THREAD_LOCAL)
+static TR_TLS_DEFINE(void *, persistentAllocatorThreadCache);
+static bool threadCacheKeyAllocated = false;
+#endif
+
+static volatile uint32_t nextAllocatorId = 0;
+
+const uint32_t OMR::PersistentAllocator::_sizeClassBlockSizes[NUM_SIZE_CLASSES] = { 16, 32, 48, 64, 80, 96, 112,
+    128, 160, 192, 224, 256, 320, 384, 448, 512, 640, 768, 896, 1024, 1280, 1536, 1792, 2048 };
+
 OMR::PersistentAllocator::PersistentAllocator(const TR::PersistentAllocatorKit &allocatorKit)
     : _rawAllocator(allocatorKit.rawAllocator)
-{}
+    , _id(VM_AtomicSupport::addU32(&nextAllocatorId, 1))
+    , _segments(NULL)
+    , _numSegments(0)
+    , _segmentAlloc(NULL)
+    , _segmentEnd(NULL)
+    , _carvedBytes(0)
+    , _threadCaches(NULL)
+    , _releasedThreadCaches(NULL)
+    , _largeBlockBytes(0)
+{
+    memset(_freeBlocks, 0, sizeof(_freeBlocks));
+    memset(_numFreeBlocks, 0, sizeof(_numFreeBlocks));
+    MUTEX_INIT(_lock);
+
+#if defined(SUPPORTS_THREAD_LOCAL)
+    // Allocators are created while the JIT is initialized, before other threads use them
+    if (!threadCacheKeyAllocated) {
+        TR_TLS_ALLOC(persistentAllocatorThreadCache);
+        threadCacheKeyAllocated = true;
+    }
+#endif
+}
+
+uint32_t OMR::PersistentAllocator::sizeClassFor(size_t blockSize)
+{
+    if (blockSize <= 128)
+        return static_cast<uint32_t>((blockSize + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT) - 1;
+
+    // Above 128 bytes there are four size classes per power of two
+    size_t b = blockSize - 1;
+    uint32_t log2 = 7;
+    while ((b >> (log2 + 1)) != 0)
+        log2++;
+    return 8 + (log2 - 7) * 4 + static_cast<uint32_t>((b >> (log2 - 2)) & 3);
+}
+
+uint32_t OMR::PersistentAllocator::batchSize(uint32_t sizeClass)
+{
+    uint32_t count = static_cast<uint32_t>(CACHE_BATCH_BYTES / _sizeClassBlockSizes[sizeClass]);
+    return count < 2 ? 2 : (count > 32 ? 32 : count);
+}
+
+OMR::PersistentAllocator::ThreadCache *OMR::PersistentAllocator::threadCache() throw()
+{
+#if defined(SUPPORTS_THREAD_LOCAL)
+    ThreadCache *cache = static_cast<ThreadCache *>(TR_TLS_GET(persistentAllocatorThreadCache, void *));
+    if (cache != NULL) {
+        // A thread only caches blocks for one allocator; any other allocator takes the locked path
+        return (cache->_allocator == this && cache->_allocatorId == _id) ? cache : NULL;
+    }
+
+    MUTEX_ENTER(_lock);
+    cache = _releasedThreadCaches;
+    if (cache != NULL) {
+        _releasedThreadCaches = cache->_next;
+    } else {
+        cache = static_cast<ThreadCache *>(_rawAllocator.allocate(sizeof(ThreadCache), std::nothrow));
+        if (cache != NULL) {
+            memset(cache, 0, sizeof(ThreadCache));
+            cache->_allocator = this;
+            cache->_allocatorId = _id;
+        }
+    }
+    if (cache != NULL) {
+        cache->_next = _threadCaches;
+        _threadCaches = cache;
+    }
+    MUTEX_EXIT(_lock);
+
+    if (cache != NULL)
+        TR_TLS_SET(persistentAllocatorThreadCache, cache);
+    return cache;
+#else
+    return NULL;
+#endif
+}
+
+void OMR::PersistentAllocator::releaseThreadCache() throw()
+{
+#if defined(SUPPORTS_THREAD_LOCAL)
+    ThreadCache *cache = static_cast<ThreadCache *>(TR_TLS_GET(persistentAllocatorThreadCache, void *));
+    if (cache == NULL || cache->_allocator != this || cache->_allocatorId != _id)
+        return;
+
+    MUTEX_ENTER(_lock);
+    for (uint32_t sizeClass = 0; sizeClass < NUM_SIZE_CLASSES; sizeClass++)
+        freeBlocks(cache, sizeClass, cache->_numFreeBlocks[sizeClass]);
+
+    ThreadCache **link = &_threadCaches;
+    while (*link != cache)
+        link = &(*link)->_next;
+    *link = cache->_next;
+    cache->_next = _releasedThreadCaches;
+    _releasedThreadCaches = cache;
+    MUTEX_EXIT(_lock);
+
+    TR_TLS_SET(persistentAllocatorThreadCache, NULL);
+#endif
+}
+
+/**
+ * Carves count blocks of the size class out of the current segment onto the shared free list,
+ * obtaining a new segment when the current one is exhausted. Must be called with the lock held.
+ */
+bool OMR::PersistentAllocator::carveBlocks(uint32_t sizeClass, uint32_t count) throw()
+{
+    size_t blockSize = _sizeClassBlockSizes[sizeClass];
+    if (static_cast<size_t>(_segmentEnd - _segmentAlloc) < blockSize) {
+        // Put what is left of the current segment on the free lists of smaller size classes
+        for (int32_t c = sizeClass - 1; c >= 0 && _segmentAlloc != _segmentEnd; c--) {
+            while (static_cast<size_t>(_segmentEnd - _segmentAlloc) >= _sizeClassBlockSizes[c]) {
+                FreeBlock *block = reinterpret_cast<FreeBlock *>(_segmentAlloc + HEADER_SIZE);
+                block->_next = _freeBlocks[c];
+                _freeBlocks[c] = block;
+                _numFreeBlocks[c]++;
+                _segmentAlloc += _sizeClassBlockSizes[c];
+                _carvedBytes += _sizeClassBlockSizes[c];
+            }
+        }
+
+        uint8_t *segment = static_cast<uint8_t *>(_rawAllocator.allocate(SEGMENT_SIZE, std::nothrow));
+        if (segment == NULL)
+            return false;
+
+        *reinterpret_cast<uint8_t **>(segment) = _segments;
+        _segments = segment;
+        _numSegments++;
+
+        // The raw allocator aligns segments to BLOCK_ALIGNMENT. Blocks start HEADER_SIZE bytes
+        // before an aligned address so that their payloads are aligned.
+        _segmentAlloc = segment + BLOCK_ALIGNMENT - HEADER_SIZE;
+        _segmentEnd = segment + SEGMENT_SIZE - HEADER_SIZE;
+    }
+
+    for (uint32_t i = 0; i < count && static_cast<size_t>(_segmentEnd - _segmentAlloc) >= blockSize; i++) {
+        FreeBlock *block = reinterpret_cast<FreeBlock *>(_segmentAlloc + HEADER_SIZE);
+        block->_next = _freeBlocks[sizeClass];
+        _freeBlocks[sizeClass] = block;
+        _numFreeBlocks[sizeClass]++;
+        _segmentAlloc += blockSize;
+        _carvedBytes += blockSize;
+    }
+    return true;
+}
+
+/**
+ * Takes a block of the size class from the shared free list, first moving a batch of blocks into
+ * the thread cache if there is one.
+ */
+OMR::PersistentAllocator::FreeBlock *OMR::PersistentAllocator::allocateBlock(ThreadCache *cache,
+    uint32_t sizeClass) throw()
+{
+    uint32_t count = cache != NULL ? batchSize(sizeClass) : 1;
+    FreeBlock *block = NULL;
+
+    MUTEX_ENTER(_lock);
+    if (_numFreeBlocks[sizeClass] < count)
+        carveBlocks(sizeClass, count - static_cast<uint32_t>(_numFreeBlocks[sizeClass]));
+
+    if (_freeBlocks[sizeClass] != NULL) {
+        block = _freeBlocks[sizeClass];
+        _freeBlocks[sizeClass] = block->_next;
+        _numFreeBlocks[sizeClass]--;
+
+        for (uint32_t i = 1; cache != NULL && i < count && _freeBlocks[sizeClass] != NULL; i++) {
+            FreeBlock *cached = _freeBlocks[sizeClass];
+            _freeBlocks[sizeClass] = cached->_next;
+            _numFreeBlocks[sizeClass]--;
+            cached->_next = cache->_freeBlocks[sizeClass];
+            cache->_freeBlocks[sizeClass] = cached;
+            cache->_numFreeBlocks[sizeClass]++;
+        }
+    }
+    MUTEX_EXIT(_lock);
+
+    return block;
+}
+
+/**
+ * Moves count blocks of the size class from the thread cache to the shared free list. Must be
+ * called with the lock held.
+ */
+void OMR::PersistentAllocator::freeBlocks(ThreadCache *cache, uint32_t sizeClass, uint32_t count) throw()
+{
+    for (uint32_t i = 0; i < count; i++) {
+        FreeBlock *block = cache->_freeBlocks[sizeClass];
+        cache->_freeBlocks[sizeClass] = block->_next;
+        cache->_numFreeBlocks[sizeClass]--;
+        block->_next = _freeBlocks[sizeClass];
+        _freeBlocks[sizeClass] = block;
+        _numFreeBlocks[sizeClass]++;
+    }
+}
+
+/**
+ * Large blocks have a header that holds the size of the raw allocation instead of a size class.
+ */
+void *OMR::PersistentAllocator::allocateLarge(size_t size) throw()
+{
+    size_t rawSize = size + BLOCK_ALIGNMENT;
+    if (rawSize < size)
+        return NULL;
+
+    uint8_t *raw = static_cast<uint8_t *>(_rawAllocator.allocate(rawSize, std::nothrow));
+    if (raw == NULL)
+        return NULL;
+
+    VM_AtomicSupport::add(&_largeBlockBytes, rawSize);
+    uint8_t *p = raw + BLOCK_ALIGNMENT;
+    *reinterpret_cast<uint64_t *>(p - HEADER_SIZE) = rawSize;
+    return p;
+}
 
 void *OMR::PersistentAllocator::allocate(size_t size, const std::nothrow_t tag, void *hint) throw()
 {
-    return _rawAllocator.allocate(size, tag, hint);
+    if (size > MAX_SMALL_BLOCK_SIZE - HEADER_SIZE)
+        return allocateLarge(size);
+
+    uint32_t sizeClass = sizeClassFor(size + HEADER_SIZE);
+    ThreadCache *cache = threadCache();
+
+    FreeBlock *block;
+    if (cache != NULL && cache->_freeBlocks[sizeClass] != NULL) {
+        block = cache->_freeBlocks[sizeClass];
+        cache->_freeBlocks[sizeClass] = block->_next;
+        cache->_numFreeBlocks[sizeClass]--;
+    } else {
+        block = allocateBlock(cache, sizeClass);
+        if (block == NULL)
+            return NULL;
+    }
+
+    *reinterpret_cast<uint64_t *>(reinterpret_cast<uint8_t *>(block) - HEADER_SIZE) = sizeClass;
+    return block;
 }
 
-void *OMR::PersistentAllocator::allocate(size_t size, void *hint) { return _rawAllocator.allocate(size, hint); }
+void *OMR::PersistentAllocator::allocate(size_t size, void *hint)
+{
+    void * const alloc = allocate(size, std::nothrow, hint);
+    if (!alloc)
+        throw std::bad_alloc();
+    return alloc;
+}
 
 void OMR::PersistentAllocator::deallocate(void *p, const size_t sizeHint) throw()
 {
-    _rawAllocator.deallocate(p, sizeHint);
+    if (p == NULL)
+        return;
+
+    uint64_t header = *reinterpret_cast<uint64_t *>(static_cast<uint8_t *>(p) - HEADER_SIZE);
+    if (header >= NUM_SIZE_CLASSES) {
+        VM_AtomicSupport::subtract(&_largeBlockBytes, static_cast<uintptr_t>(header));
+        _rawAllocator.deallocate(static_cast<uint8_t *>(p) - BLOCK_ALIGNMENT, static_cast<size_t>(header));
+        return;
+    }
+
+    uint32_t sizeClass = static_cast<uint32_t>(header);
+    FreeBlock *block = static_cast<FreeBlock *>(p);
+    ThreadCache *cache = threadCache();
+    if (cache == NULL) {
+        MUTEX_ENTER(_lock);
+        block->_next = _freeBlocks[sizeClass];
+        _freeBlocks[sizeClass] = block;
+        _numFreeBlocks[sizeClass]++;
+        MUTEX_EXIT(_lock);
+        return;
+    }
+
+    block->_next = cache->_freeBlocks[sizeClass];
+    cache->_freeBlocks[sizeClass] = block;
+    cache->_numFreeBlocks[sizeClass]++;
+
+    // Keep at most two batches cached so that a thread that frees more than it allocates returns
+    // the blocks for other threads to use
+    uint32_t batch = batchSize(sizeClass);
+    if (cache->_numFreeBlocks[sizeClass] > 2 * batch) {
+        MUTEX_ENTER(_lock);
+        freeBlocks(cache, sizeClass, batch);
+        MUTEX_EXIT(_lock);
+    }
+}
+
+void OMR::PersistentAllocator::getStatistics(Statistics &stats)
+{
+    MUTEX_ENTER(_lock);
+    size_t freeBlockBytes = 0;
+    for (uint32_t sizeClass = 0; sizeClass < NUM_SIZE_CLASSES; sizeClass++)
+        freeBlockBytes += _numFreeBlocks[sizeClass] * _sizeClassBlockSizes[sizeClass];
+
+    // Thread caches are read without synchronizing with their threads, so this part is approximate
+    size_t numThreadCaches = 0;
+    for (ThreadCache *cache = _threadCaches; cache != NULL; cache = cache->_next) {
+        for (uint32_t sizeClass = 0; sizeClass < NUM_SIZE_CLASSES; sizeClass++)
+            freeBlockBytes += cache->_numFreeBlocks[sizeClass] * _sizeClassBlockSizes[sizeClass];
+        numThreadCaches++;
+    }
+
+    stats.segmentBytes = _numSegments * SEGMENT_SIZE;
+    stats.unusedSegmentBytes = _segmentEnd - _segmentAlloc;
+    stats.freeBlockBytes = freeBlockBytes;
+    stats.smallBlockBytes = _carvedBytes > freeBlockBytes ? _carvedBytes - freeBlockBytes : 0;
+    stats.largeBlockBytes = _largeBlockBytes;
+    stats.numThreadCaches = numThreadCaches;
+    MUTEX_EXIT(_lock);
 }
@@ -42,17 +42,49 @@ using OMR::PersistentAllocator;
 
 #include "env/RawAllocator.hpp"
 #include "env/PersistentAllocatorKit.hpp"
+#include "omrmutex.h"
 
 namespace OMR {
 
+/**
+ * Allocator for memory that outlives compilations.
+ *
+ * Small allocations are rounded up to one of a set of size classes and carved out of segments
+ * obtained from the raw allocator. Each thread keeps a cache of free blocks per size class, so
+ * allocating and freeing small blocks does not take a lock; the lock is only taken to move a
+ * batch of blocks between a thread cache and the shared free lists, or to obtain a new segment.
+ * Allocations larger than the biggest size class come directly from the raw allocator.
+ *
+ * Segments are never returned to the raw allocator. A thread that stops using the allocator
+ * should call releaseThreadCache() so that the blocks it caches can be reused by other threads.
+ */
 class PersistentAllocator {
 public:
+    /**
+     * Memory held by the allocator. Free blocks cached by threads are counted as free.
+     */
+    struct Statistics {
+        size_t segmentBytes; ///< bytes of segments obtained from the raw allocator
+        size_t unusedSegmentBytes; ///< bytes at the end of the current segment not yet carved into blocks
+        size_t freeBlockBytes; ///< bytes of small blocks on free lists and in thread caches
+        size_t smallBlockBytes; ///< bytes of small blocks in use, including headers and rounding
+        size_t largeBlockBytes; ///< bytes of allocations taken directly from the raw allocator
+        size_t numThreadCaches;
+    };
+
     PersistentAllocator(const TR::PersistentAllocatorKit &allocatorKit);
 
     void *allocate(size_t size, const std::nothrow_t tag, void *hint = 0) throw();
     void *allocate(size_t size, void *hint = 0);
     void deallocate(void *p, const size_t sizeHint = 0) throw();
 
+    /**
+     * @brief Returns the blocks cached by the calling thread to the shared free lists
+     */
+    void releaseThreadCache() throw();
+
+    void getStatistics(Statistics &stats);
+
     friend bool operator==(const PersistentAllocator &left, const PersistentAllocator &right)
     {
         return left._rawAllocator == right._rawAllocator;
@@ -66,7 +98,51 @@ public:
 private:
     PersistentAllocator(const PersistentAllocator &);
 
+    static const uint32_t NUM_SIZE_CLASSES = 24;
+    static const size_t BLOCK_ALIGNMENT = 16;
+    static const size_t HEADER_SIZE = 8; ///< the header keeps block payloads aligned to BLOCK_ALIGNMENT
+    static const size_t MAX_SMALL_BLOCK_SIZE = 2048;
+    static const size_t SEGMENT_SIZE = 64 * 1024;
+    static const size_t CACHE_BATCH_BYTES = 4096;
+
+    static const uint32_t _sizeClassBlockSizes[NUM_SIZE_CLASSES];
+
+    struct FreeBlock {
+        FreeBlock *_next;
+    };
+
+    struct ThreadCache {
+        PersistentAllocator *_allocator;
+        uint32_t _allocatorId;
+        ThreadCache *_next;
+        FreeBlock *_freeBlocks[NUM_SIZE_CLASSES];
+        uint32_t _numFreeBlocks[NUM_SIZE_CLASSES];
+    };
+
+    static uint32_t sizeClassFor(size_t blockSize);
+    static uint32_t batchSize(uint32_t sizeClass);
+
+    ThreadCache *threadCache() throw();
+    FreeBlock *allocateBlock(ThreadCache *cache, uint32_t sizeClass) throw();
+    void freeBlocks(ThreadCache *cache, uint32_t sizeClass, uint32_t count) throw();
+    bool carveBlocks(uint32_t sizeClass, uint32_t count) throw();
+    void *allocateLarge(size_t size) throw();
+
     TR::RawAllocator _rawAllocator;
+    uint32_t _id;
+    MUTEX _lock; ///< guards the fields below
+
+    FreeBlock *_freeBlocks[NUM_SIZE_CLASSES];
+    size_t _numFreeBlocks[NUM_SIZE_CLASSES];
+    uint8_t *_segments; ///< segments are linked through their first word
+    size_t _numSegments;
+    uint8_t *_segmentAlloc;
+    uint8_t *_segmentEnd;
+    size_t _carvedBytes;
+    ThreadCache *_threadCaches;
+    ThreadCache *_releasedThreadCaches;
+
+    volatile uintptr_t _largeBlockBytes;
 };
 
 } // namespace OMR
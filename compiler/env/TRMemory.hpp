@@ -473,12 +473,11 @@ public:
 
     TR_PersistentMemory(void *jitConfig, TR::PersistentAllocator &persistentAllocator);
 
-    void *allocatePersistentMemory(size_t const size, ObjectType const ot = UnknownType) throw()
-    {
-        _totalPersistentAllocations[ot] += size;
-        void *persistentMemory = _persistentAllocator.get().allocate(size, std::nothrow);
-        return persistentMemory;
-    }
+    /**
+     * May be called by several compilation threads at once; the allocation statistics are
+     * updated atomically.
+     */
+    void *allocatePersistentMemory(size_t const size, ObjectType const ot = UnknownType) throw();
 
     void freePersistentMemory(void *mem) throw() { _persistentAllocator.get().deallocate(mem); }
 
@@ -496,7 +495,7 @@ public:
 
     TR::PersistentInfo _persistentInfo;
     TR::reference_wrapper<TR::PersistentAllocator> _persistentAllocator;
-    size_t _totalPersistentAllocations[TR_MemoryBase::NumObjectTypes];
+    volatile uintptr_t _totalPersistentAllocations[TR_MemoryBase::NumObjectTypes];
 };
 
 extern TR_PersistentMemory *trPersistentMemory;
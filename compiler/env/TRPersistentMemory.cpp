@@ -25,6 +25,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "AtomicSupport.hpp"
 #include "infra/CriticalSection.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
@@ -85,6 +86,12 @@ TR_PersistentMemory::TR_PersistentMemory(void *jitConfig, TR::PersistentAllocato
     , _totalPersistentAllocations()
 {}
 
+void *TR_PersistentMemory::allocatePersistentMemory(size_t const size, ObjectType const ot) throw()
+{
+    VM_AtomicSupport::add(&_totalPersistentAllocations[ot], size);
+    return _persistentAllocator.get().allocate(size, std::nothrow);
+}
+
 void TR_PersistentMemory::printMemStats()
 {
     fprintf(stderr, "TR_PersistentMemory Stats:\n");
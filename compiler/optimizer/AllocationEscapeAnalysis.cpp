@@ -0,0 +1,563 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "optimizer/AllocationEscapeAnalysis.hpp"
+
+#include <algorithm>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/ObjectModel.hpp"
+#include "il/AutomaticSymbol.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/ILWalk.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+#include "ras/Logger.hpp"
+
+// Objects larger than this are left on the heap rather than growing the stack frame
+#define MAX_STACK_OBJECT_SIZE 256
+
+TR::AllocationEscapeAnalysis::AllocationEscapeAnalysis(TR::OptimizationManager *manager)
+    : TR::Optimization(manager)
+    , _allocations(NULL)
+    , _holders(NULL)
+{}
+
+int32_t TR::AllocationEscapeAnalysis::perform()
+{
+    if (!TR::Compiler->om.canAllocateNonEscapingObjectsOnStack() || !comp()->getFlowGraph()->getStructure()) {
+        return 0;
+    }
+
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+
+    TR::map<TR::Node *, Candidate *> allocations(std::less<TR::Node *>(), stackRegion);
+    TR::map<TR::Symbol *, Candidate *> holders(std::less<TR::Symbol *>(), stackRegion);
+    _allocations = &allocations;
+    _holders = &holders;
+
+    TR::vector<Candidate *, TR::Region &> candidates(stackRegion);
+    TR::vector<TR::Node *, TR::Region &> localStores(stackRegion);
+    collectCandidates(candidates, localStores);
+    if (candidates.empty()) {
+        return 0;
+    }
+
+    findHolders(localStores);
+
+    vcount_t visitCount = comp()->incVisitCount();
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt != NULL; tt = tt->getNextTreeTop()) {
+        analyzeUses(tt->getNode(), visitCount);
+    }
+
+    int32_t numTransformed = 0;
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        Candidate *candidate = *it;
+        if (candidate->_escapes) {
+            continue;
+        }
+
+        int32_t size = 0;
+        if (canReplaceByScalars(candidate)) {
+            if (performTransformation(comp(), "%sReplacing allocation n%dn by %d scalars\n", optDetailString(),
+                    candidate->_node->getGlobalIndex(), (int32_t)candidate->_fields.size())) {
+                replaceByScalars(candidate);
+                numTransformed++;
+            }
+        } else if (canAllocateOnStack(candidate, size)) {
+            if (performTransformation(comp(), "%sAllocating n%dn on the stack (%d bytes)\n", optDetailString(),
+                    candidate->_node->getGlobalIndex(), size)) {
+                allocateOnStack(candidate, size);
+                numTransformed++;
+            }
+        }
+    }
+
+    _allocations = NULL;
+    _holders = NULL;
+
+    if (numTransformed == 0) {
+        return 0;
+    }
+
+    optimizer()->setAliasSetsAreValid(false);
+    requestOpt(OMR::deadTreesElimination);
+    return numTransformed;
+}
+
+const char *TR::AllocationEscapeAnalysis::optDetailString() const throw()
+{
+    return "O^O ALLOCATION ESCAPE ANALYSIS: ";
+}
+
+/**
+ * Find the allocations that are candidates and the stores to reference locals that may make
+ * other locals hold them.
+ */
+void TR::AllocationEscapeAnalysis::collectCandidates(TR::vector<Candidate *, TR::Region &> &candidates,
+    TR::vector<TR::Node *, TR::Region &> &localStores)
+{
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+    TR::Block *block = NULL;
+
+    for (TR::PreorderNodeIterator iter(comp()->getStartTree(), comp()); iter.currentTree(); ++iter) {
+        TR::Node *node = iter.currentNode();
+        TR::ILOpCode &op = node->getOpCode();
+        if (op.getOpCodeValue() == TR::BBStart) {
+            block = node->getBlock();
+        } else if (op.getOpCodeValue() == TR::New) {
+            if (isInCycle(block)) {
+                logprintf(trace(), comp()->log(), "Allocation n%dn in block_%d is in a cycle\n", node->getGlobalIndex(),
+                    block->getNumber());
+            } else {
+                Candidate *candidate = new (stackRegion) Candidate(node, iter.currentTree(), stackRegion);
+                candidates.push_back(candidate);
+                (*_allocations)[node] = candidate;
+            }
+        } else if (op.getOpCodeValue() == TR::loadaddr && node->getSymbol()->isAutoOrParm()) {
+            // The local may be changed through its address
+            (*_holders)[node->getSymbol()] = NULL;
+        } else if (op.isStoreDirect() && node->getDataType() == TR::Address && node->getSymbol()->isAutoOrParm()) {
+            // A parameter also holds the value passed by the caller
+            if (node->getSymbol()->isParm()) {
+                (*_holders)[node->getSymbol()] = NULL;
+            }
+            localStores.push_back(node);
+        }
+    }
+}
+
+bool TR::AllocationEscapeAnalysis::isInCycle(TR::Block *block)
+{
+    TR_BlockStructure *blockStructure = block->getStructureOf();
+    if (blockStructure == NULL) {
+        return true;
+    }
+
+    for (TR_RegionStructure *region = blockStructure->getParent(); region != NULL; region = region->getParent()) {
+        if (region->isNaturalLoop() || region->containsInternalCycles()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Find the candidate each reference local holds. A local stored with more than one candidate, or
+ * with a candidate and any other non-null value, cannot be tracked and the candidates it holds
+ * escape.
+ */
+void TR::AllocationEscapeAnalysis::findHolders(TR::vector<TR::Node *, TR::Region &> &localStores)
+{
+    // Copies from locals that have not been seen yet are resolved once everything else is known,
+    // and are then treated as holding unknown values
+    for (int32_t pass = 0; pass < 2; pass++) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto it = localStores.begin(); it != localStores.end(); ++it) {
+                TR::Node *store = *it;
+                TR::Node *value = store->getFirstChild();
+                TR::Symbol *local = store->getSymbol();
+
+                if (value->getOpCode().getOpCodeValue() == TR::aconst && value->getAddress() == 0) {
+                    continue;
+                }
+
+                Candidate *candidate = getCandidate(value);
+                if (candidate == NULL && value->getOpCode().isLoadVarDirect() && value->getSymbol()->isAutoOrParm()
+                    && _holders->find(value->getSymbol()) == _holders->end() && pass == 0) {
+                    continue;
+                }
+
+                changed |= addHolder(local, candidate);
+            }
+        }
+    }
+
+    for (auto it = localStores.begin(); it != localStores.end(); ++it) {
+        TR::Node *value = (*it)->getFirstChild();
+        auto holder = _holders->find((*it)->getSymbol());
+        if (holder != _holders->end() && holder->second != NULL && value->getOpCode().getOpCodeValue() == TR::aconst
+            && value->getAddress() == 0) {
+            holder->second->_mayBeNull = true;
+        }
+    }
+}
+
+/**
+ * Record that the local may hold the candidate, or any other value when the candidate is NULL.
+ *
+ * \return true if what the local holds changed
+ */
+bool TR::AllocationEscapeAnalysis::addHolder(TR::Symbol *local, Candidate *candidate)
+{
+    auto holder = _holders->find(local);
+    if (holder == _holders->end()) {
+        (*_holders)[local] = candidate;
+        return true;
+    }
+
+    if (holder->second == candidate) {
+        return false;
+    }
+
+    if (candidate != NULL) {
+        escape(candidate, "it shares a local with other values", NULL);
+    }
+    if (holder->second == NULL) {
+        return false;
+    }
+
+    escape(holder->second, "it shares a local with other values", NULL);
+    holder->second = NULL;
+    return true;
+}
+
+/**
+ * Return the candidate the node evaluates to, if any.
+ */
+TR::AllocationEscapeAnalysis::Candidate *TR::AllocationEscapeAnalysis::getCandidate(TR::Node *node)
+{
+    if (node->getOpCode().getOpCodeValue() == TR::New) {
+        auto allocation = _allocations->find(node);
+        return allocation != _allocations->end() ? allocation->second : NULL;
+    }
+
+    if (node->getOpCode().isLoadVarDirect() && node->getSymbol()->isAutoOrParm()) {
+        auto holder = _holders->find(node->getSymbol());
+        return holder != _holders->end() ? holder->second : NULL;
+    }
+
+    return NULL;
+}
+
+void TR::AllocationEscapeAnalysis::analyzeUses(TR::Node *node, vcount_t visitCount)
+{
+    if (node->getVisitCount() == visitCount) {
+        return;
+    }
+    node->setVisitCount(visitCount);
+
+    if (node->getOpCode().isNullCheck()) {
+        Candidate *candidate = getCandidate(node->getNullCheckReference());
+        if (candidate != NULL) {
+            candidate->_nullChecks.push_back(node);
+            if (node->getOpCode().isResolveCheck()) {
+                candidate->_hasResolveCheck = true;
+            }
+        }
+
+        // A check of the reference itself is not a use of it
+        TR::Node *passThrough = node->getFirstChild();
+        if (passThrough->getOpCodeValue() == TR::PassThrough && passThrough->getVisitCount() != visitCount) {
+            passThrough->setVisitCount(visitCount);
+            analyzeUses(passThrough->getFirstChild(), visitCount);
+        }
+    }
+
+    for (int32_t i = 0; i < node->getNumChildren(); i++) {
+        TR::Node *child = node->getChild(i);
+        Candidate *candidate = getCandidate(child);
+        if (candidate != NULL && !candidate->_escapes) {
+            analyzeUse(node, i, candidate);
+        }
+        analyzeUses(child, visitCount);
+    }
+}
+
+/**
+ * Check a use of a candidate as the given child of the parent node.
+ */
+void TR::AllocationEscapeAnalysis::analyzeUse(TR::Node *parent, int32_t childIndex, Candidate *candidate)
+{
+    TR::ILOpCode &op = parent->getOpCode();
+
+    // The base of a field access, or the destination object of a write barrier
+    bool isDestination = op.isWrtBar() && childIndex == 2 && getCandidate(parent->getFirstChild()) == candidate;
+    if ((op.isLoadIndirect() || op.isStoreIndirect()) && (childIndex == 0 || isDestination)) {
+        TR::SymbolReference *symRef = parent->getSymbolReference();
+        TR::DataType type = parent->getDataType();
+        if (op.isVectorOpCode() || type == TR::Aggregate || symRef->isUnresolved()
+            || !symRef->getSymbol()->isShadow()) {
+            escape(candidate, "it is accessed as a whole", parent);
+            return;
+        }
+
+        int32_t offset = (int32_t)symRef->getOffset();
+        if (offset < (int32_t)TR::Compiler->om.objectHeaderSizeInBytes()) {
+            escape(candidate, "its header is accessed", parent);
+            return;
+        }
+
+        if (childIndex != 0) {
+            return;
+        }
+
+        candidate->_fieldAccesses.push_back(parent);
+        for (auto field = candidate->_fields.begin(); field != candidate->_fields.end(); ++field) {
+            if (field->_offset == offset && field->_type == type) {
+                return;
+            }
+        }
+
+        Field field = { offset, type, symRef, NULL };
+        candidate->_fields.push_back(field);
+        return;
+    }
+
+    if (op.isStoreIndirect()) {
+        escape(candidate, "it is stored into memory", parent);
+        return;
+    }
+
+    if (op.isStoreDirect()) {
+        if (!parent->getSymbol()->isAutoOrParm() || getCandidate(parent->getFirstChild()) != candidate
+            || (*_holders)[parent->getSymbol()] != candidate) {
+            escape(candidate, "it is stored to a variable that is not tracked", parent);
+        }
+        return;
+    }
+
+    switch (op.getOpCodeValue()) {
+        case TR::treetop:
+            return;
+        case TR::acmpeq:
+        case TR::acmpne:
+        case TR::ifacmpeq:
+        case TR::ifacmpne:
+            candidate->_isCompared = true;
+            return;
+        default:
+            escape(candidate, "it is used by an operation that is not tracked", parent);
+            return;
+    }
+}
+
+void TR::AllocationEscapeAnalysis::escape(Candidate *candidate, const char *reason, TR::Node *node)
+{
+    if (candidate->_escapes) {
+        return;
+    }
+
+    candidate->_escapes = true;
+    if (trace()) {
+        if (node != NULL) {
+            comp()->log()->printf("Allocation n%dn escapes because %s at %s n%dn\n",
+                candidate->_node->getGlobalIndex(), reason, node->getOpCode().getName(), node->getGlobalIndex());
+        } else {
+            comp()->log()->printf("Allocation n%dn escapes because %s\n", candidate->_node->getGlobalIndex(), reason);
+        }
+    }
+}
+
+bool TR::AllocationEscapeAnalysis::compareFieldOffsets(const Field &a, const Field &b)
+{
+    return a._offset < b._offset;
+}
+
+/**
+ * An object can be replaced by scalars when its reference is only used to access fields that do
+ * not overlap one another.
+ */
+bool TR::AllocationEscapeAnalysis::canReplaceByScalars(Candidate *candidate)
+{
+    if (candidate->_isCompared || candidate->_mayBeNull || candidate->_hasResolveCheck) {
+        return false;
+    }
+
+    std::sort(candidate->_fields.begin(), candidate->_fields.end(), compareFieldOffsets);
+    for (size_t i = 1; i < candidate->_fields.size(); i++) {
+        Field &previous = candidate->_fields[i - 1];
+        if (previous._offset + (int32_t)TR::DataType::getSize(previous._type) > candidate->_fields[i]._offset) {
+            logprintf(trace(), comp()->log(), "Fields of allocation n%dn at offsets %d and %d overlap\n",
+                candidate->_node->getGlobalIndex(), previous._offset, candidate->_fields[i]._offset);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * An object can be allocated on the stack when it is small and the GC stack maps can describe
+ * its reference fields.
+ */
+bool TR::AllocationEscapeAnalysis::canAllocateOnStack(Candidate *candidate, int32_t &size)
+{
+    int32_t slotSize = (int32_t)TR::Compiler->om.sizeofReferenceAddress();
+    int32_t end = (int32_t)TR::Compiler->om.objectHeaderSizeInBytes();
+    for (auto field = candidate->_fields.begin(); field != candidate->_fields.end(); ++field) {
+        end = std::max(end, field->_offset + (int32_t)TR::DataType::getSize(field->_type));
+
+        // Reference slots are numbered from the start of the object and the list of them ends with
+        // slot zero, so a reference in the first slot cannot be described
+        if (field->_type == TR::Address
+            && (TR::Compiler->om.sizeofReferenceField() != slotSize || field->_offset % slotSize != 0
+                || field->_offset / slotSize == 0)) {
+            logprintf(trace(), comp()->log(), "Reference field at offset %d of allocation n%dn cannot be mapped\n",
+                field->_offset, candidate->_node->getGlobalIndex());
+            return false;
+        }
+    }
+
+    size = std::max(slotSize, (end + slotSize - 1) / slotSize * slotSize);
+    if (size > MAX_STACK_OBJECT_SIZE) {
+        logprintf(trace(), comp()->log(), "Allocation n%dn needs %d bytes, which is too large for the stack\n",
+            candidate->_node->getGlobalIndex(), size);
+        return false;
+    }
+
+    return true;
+}
+
+void TR::AllocationEscapeAnalysis::replaceByScalars(Candidate *candidate)
+{
+    TR::Node *allocation = candidate->_node;
+    for (auto field = candidate->_fields.begin(); field != candidate->_fields.end(); ++field) {
+        field->_temp = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), field->_type);
+
+        // Fields of a new object start out zero
+        TR::Node *zero = TR::Node::createConstZeroValue(allocation, field->_type);
+        TR::Node *store = TR::Node::createWithSymRef(allocation, comp()->il.opCodeForDirectStore(field->_type), 1,
+            zero, field->_temp);
+        candidate->_tree->insertBefore(TR::TreeTop::create(comp(), store));
+    }
+
+    for (auto it = candidate->_fieldAccesses.begin(); it != candidate->_fieldAccesses.end(); ++it) {
+        TR::Node *access = *it;
+        int32_t offset = (int32_t)access->getSymbolReference()->getOffset();
+        TR::SymbolReference *temp = NULL;
+        for (auto field = candidate->_fields.begin(); field != candidate->_fields.end(); ++field) {
+            if (field->_offset == offset && field->_type == access->getDataType()) {
+                temp = field->_temp;
+            }
+        }
+
+        if (access->getOpCode().isLoadIndirect()) {
+            access->getFirstChild()->recursivelyDecReferenceCount();
+            access->setNumChildren(0);
+            TR::Node::recreateWithSymRef(access, comp()->il.opCodeForDirectLoad(access->getDataType()), temp);
+        } else {
+            TR::Node *value = access->getSecondChild();
+            access->getFirstChild()->recursivelyDecReferenceCount();
+            if (access->getOpCode().isWrtBar()) {
+                access->getChild(2)->recursivelyDecReferenceCount();
+            }
+            access->setChild(0, value);
+            access->setNumChildren(1);
+            TR::Node::recreateWithSymRef(access, comp()->il.opCodeForDirectStore(access->getDataType()), temp);
+        }
+    }
+
+    for (auto it = candidate->_nullChecks.begin(); it != candidate->_nullChecks.end(); ++it) {
+        TR::Node *check = *it;
+        TR::Node::recreate(check, TR::treetop);
+        TR::Node *passThrough = check->getFirstChild();
+        if (passThrough->getOpCodeValue() == TR::PassThrough) {
+            check->setAndIncChild(0, passThrough->getFirstChild());
+            passThrough->recursivelyDecReferenceCount();
+        }
+    }
+
+    // Anything that still refers to the object, such as the locals that held it, now sees null
+    for (int32_t i = 0; i < allocation->getNumChildren(); i++) {
+        allocation->getChild(i)->recursivelyDecReferenceCount();
+    }
+    allocation->setNumChildren(0);
+    TR::Node::recreate(allocation, TR::aconst);
+    allocation->setAddress(0);
+}
+
+void TR::AllocationEscapeAnalysis::allocateOnStack(Candidate *candidate, int32_t size)
+{
+    TR::Node *allocation = candidate->_node;
+    TR::Node *classNode = allocation->getFirstChild();
+    TR::SymbolReference *classSymRef = classNode->getOpCode().hasSymbolReference() ? classNode->getSymbolReference()
+                                                                                   : NULL;
+    TR::SymbolReference *localObject
+        = comp()->getSymRefTab()->createLocalObject(size, comp()->getMethodSymbol(), classSymRef);
+    TR::AutomaticSymbol *localObjectSymbol = localObject->getSymbol()->castToLocalObjectSymbol();
+
+    int32_t slotSize = (int32_t)TR::Compiler->om.sizeofReferenceAddress();
+    int32_t *referenceSlots = (int32_t *)trMemory()->allocateHeapMemory((size / slotSize + 1) * sizeof(int32_t));
+    int32_t numReferenceSlots = 0;
+
+    for (auto field = candidate->_fields.begin(); field != candidate->_fields.end(); ++field) {
+        TR::Node *address = TR::Node::createWithSymRef(allocation, TR::loadaddr, 0, localObject);
+        TR::Node *zero = TR::Node::createConstZeroValue(allocation, field->_type);
+        TR::Node *store = TR::Node::createWithSymRef(comp()->il.opCodeForIndirectStore(field->_type), 2, 2, address,
+            zero, field->_symRef);
+
+        // Reference fields are cleared on entry because the GC maps describe them everywhere in
+        // the method. The allocation runs at most once per invocation, so this is equivalent.
+        if (field->_type == TR::Address) {
+            int32_t slot = field->_offset / slotSize;
+            if (std::find(referenceSlots, referenceSlots + numReferenceSlots, slot)
+                == referenceSlots + numReferenceSlots) {
+                referenceSlots[numReferenceSlots++] = slot;
+            }
+            comp()->getStartTree()->insertAfter(TR::TreeTop::create(comp(), store));
+        } else {
+            candidate->_tree->insertBefore(TR::TreeTop::create(comp(), store));
+        }
+    }
+
+    if (numReferenceSlots > 0) {
+        referenceSlots[numReferenceSlots] = 0;
+        localObjectSymbol->setReferenceSlots(referenceSlots);
+    } else {
+        localObjectSymbol->setNotCollected();
+    }
+
+    // Write barriers are only needed for stores into heap objects
+    for (auto it = candidate->_fieldAccesses.begin(); it != candidate->_fieldAccesses.end(); ++it) {
+        TR::Node *access = *it;
+        if (access->getOpCode().isWrtBar()) {
+            access->getChild(2)->recursivelyDecReferenceCount();
+            access->setNumChildren(2);
+            TR::Node::recreate(access, comp()->il.opCodeForIndirectStore(TR::Address));
+        }
+    }
+
+    for (int32_t i = 0; i < allocation->getNumChildren(); i++) {
+        allocation->getChild(i)->recursivelyDecReferenceCount();
+    }
+    allocation->setNumChildren(0);
+    TR::Node::recreateWithSymRef(allocation, TR::loadaddr, localObject);
+}
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef ALLOCATIONESCAPEANALYSIS_INCL
+#define ALLOCATIONESCAPEANALYSIS_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "infra/map.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR {
+class Block;
+class Node;
+class Symbol;
+class SymbolReference;
+class TreeTop;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * Escape analysis for objects allocated with \c new.
+ *
+ * An allocation escapes when its reference can be observed outside the compiled method or by
+ * code the analysis cannot see: it is passed to a call, returned, stored into memory, or flows
+ * into a local that may also hold other values. Calls that were inlined are part of the trees,
+ * so the analysis sees through them; this pass should therefore run after inlining.
+ *
+ * An allocation that does not escape and whose reference is only used to access its fields is
+ * replaced by one temporary per field. Otherwise, when the object is also compared or may be
+ * null where it is used, it is allocated in the method's stack frame instead. The reference
+ * slots of stack allocated objects are described by the GC stack atlas.
+ *
+ * The object size is not known to the optimizer, so only the fields that are accessed are
+ * materialized and objects whose header is read or written are left alone. Only allocations
+ * outside of cycles in the flow graph are considered, so that each allocation produces at most
+ * one object per invocation of the method. Front ends that generate \c new nodes must mark
+ * the method symbol with setHasNews() for the strategy to run this pass, and may turn it off
+ * through the object model.
+ */
+class AllocationEscapeAnalysis : public TR::Optimization {
+public:
+    AllocationEscapeAnalysis(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) AllocationEscapeAnalysis(manager);
+    }
+
+    virtual int32_t perform();
+    virtual const char *optDetailString() const throw();
+
+private:
+    /**
+     * A field of a candidate, identified by its offset and the type it is accessed as.
+     */
+    struct Field {
+        int32_t _offset;
+        TR::DataType _type;
+        TR::SymbolReference *_symRef; ///< shadow of one of the accesses
+        TR::SymbolReference *_temp; ///< replacement temporary when the object is replaced by scalars
+    };
+
+    struct Candidate {
+        Candidate(TR::Node *node, TR::TreeTop *tree, TR::Region &region)
+            : _node(node)
+            , _tree(tree)
+            , _fieldAccesses(region)
+            , _nullChecks(region)
+            , _fields(region)
+            , _escapes(false)
+            , _mayBeNull(false)
+            , _isCompared(false)
+            , _hasResolveCheck(false)
+        {}
+
+        TR::Node *_node;
+        TR::TreeTop *_tree; ///< tree that evaluates the allocation
+        TR::vector<TR::Node *, TR::Region &> _fieldAccesses; ///< indirect loads and stores based on the object
+        TR::vector<TR::Node *, TR::Region &> _nullChecks; ///< null checks of the object
+        TR::vector<Field, TR::Region &> _fields;
+        bool _escapes;
+        bool _mayBeNull; ///< a local holding the object may also hold null
+        bool _isCompared;
+        bool _hasResolveCheck;
+    };
+
+    void collectCandidates(TR::vector<Candidate *, TR::Region &> &candidates,
+        TR::vector<TR::Node *, TR::Region &> &localStores);
+    bool isInCycle(TR::Block *block);
+    void findHolders(TR::vector<TR::Node *, TR::Region &> &localStores);
+    bool addHolder(TR::Symbol *local, Candidate *candidate);
+    Candidate *getCandidate(TR::Node *node);
+    void analyzeUses(TR::Node *node, vcount_t visitCount);
+    void analyzeUse(TR::Node *parent, int32_t childIndex, Candidate *candidate);
+    void escape(Candidate *candidate, const char *reason, TR::Node *node);
+
+    static bool compareFieldOffsets(const Field &a, const Field &b);
+    bool canReplaceByScalars(Candidate *candidate);
+    bool canAllocateOnStack(Candidate *candidate, int32_t &size);
+    void replaceByScalars(Candidate *candidate);
+    void allocateOnStack(Candidate *candidate, int32_t size);
+
+    TR::map<TR::Node *, Candidate *> *_allocations;
+
+    /**
+     * The candidate each local holds, or NULL when the local may hold any other non-null value.
+     */
+    TR::map<TR::Symbol *, Candidate *> *_holders;
+};
+
+} // namespace TR
+
+#endif // ALLOCATIONESCAPEANALYSIS_INCL
@@ -339,7 +339,7 @@ int32_t TR_GlobalRegisterAllocator::perform()
 
     if (cg()->getSupportsGlRegDeps() && !debug("disableGRA") && cg()->prepareForGRA()) {
         static char *useFreqs = feGetEnv("TR_GRA_UseProfilingFrequencies");
-        if (useFreqs)
+        if (useFreqs || comp()->getMethodProfile() != NULL)
             comp()->setUsesBlockFrequencyInGRA();
 
         TR_BitVector *liveVars = NULL;
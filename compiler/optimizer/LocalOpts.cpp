@@ -39,6 +39,7 @@
 #include "compile/ResolvedMethod.hpp"
 #include "compile/SymbolReferenceTable.hpp"
 #include "compile/VirtualGuard.hpp"
+#include "control/MethodProfile.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "control/Recompilation.hpp"
@@ -75,6 +76,7 @@
 #include "infra/ILWalk.hpp"
 #include "infra/Link.hpp"
 #include "infra/List.hpp"
+#include "infra/vector.hpp"
 #include "optimizer/Inliner.hpp"
 #include "infra/Stack.hpp"
 #include "infra/CfgEdge.hpp"
@@ -3760,9 +3762,125 @@ int32_t TR_ProfiledNodeVersioning::perform()
     }
 #endif
 
+    versionProfiledDivisions();
+
     return 123; // TODO: What to return here?
 }
 
+void TR_ProfiledNodeVersioning::versionProfiledDivisions()
+{
+    if (comp()->getMethodProfile() == NULL)
+        return;
+
+    OMR::Logger *log = comp()->log();
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+    typedef std::pair<TR::TreeTop *, TR::Node *> Candidate;
+    TR::vector<Candidate, TR::Region &> candidates(trMemory()->currentStackRegion());
+
+    TR::Block *currentBlock = NULL;
+    for (TR::PreorderNodeIterator iter(comp()->getStartTree(), comp()); iter.currentTree(); ++iter) {
+        TR::Node *node = iter.currentNode();
+        if (node->getOpCodeValue() == TR::BBStart) {
+            currentBlock = node->getBlock();
+            continue;
+        }
+
+        // A check at the root of the tree has to stay with the division it checks
+        if (currentBlock->isCold() || iter.currentTree()->getNode()->getOpCode().isCheck())
+            continue;
+
+        switch (node->getOpCodeValue()) {
+            case TR::idiv:
+            case TR::irem:
+            case TR::ldiv:
+            case TR::lrem:
+                if (comp()->getValueProfile(node) != NULL && !node->getSecondChild()->getOpCode().isLoadConst())
+                    candidates.push_back(Candidate(iter.currentTree(), node));
+                break;
+            default:
+                break;
+        }
+    }
+
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        TR::TreeTop *tt = it->first;
+        TR::Node *node = it->second;
+        TR::ValueProfile *profile = comp()->getValueProfile(node);
+        bool is64Bit = node->getDataType() == TR::Int64;
+
+        int64_t divisor = 0;
+        uint32_t count = profile->getMostFrequentValue(divisor);
+        float probability = (float)count / profile->getTotalCount();
+        if (probability < MIN_PROFILED_FREQUENCY || divisor <= 0 || (!is64Bit && divisor > INT_MAX)) {
+            logprintf(trace(), log, "Not versioning %s node %s: most frequent divisor %lld has probability %.0f%%\n",
+                node->getOpCode().getName(), getDebug()->getName(node), (long long)divisor, 100.0 * probability);
+            continue;
+        }
+
+        if (!performTransformation(comp(), "O^O PROFILED NODE VERSIONING: Versioning %s %s, divisor == %lld %.01f%%\n",
+                node->getOpCode().getName(), getDebug()->getName(node), (long long)divisor, 100.0 * probability))
+            continue;
+
+        //    dividend temp = dividend
+        //    divisor temp = divisor
+        //    if (divisor temp != profiled divisor) goto slow
+        //    result temp = dividend temp / profiled divisor
+        // remainder:
+        //    ... result temp ...
+        //
+        // slow:
+        //    result temp = dividend temp / divisor temp
+        //    goto remainder
+        TR::Block *block = tt->getEnclosingBlock();
+        int16_t originalFrequency = block->getFrequency();
+        TR::DataType type = node->getDataType();
+        TR::SymbolReference *dividendSymRef = getSymRefTab()->createTemporary(comp()->getMethodSymbol(), type);
+        TR::SymbolReference *divisorSymRef = getSymRefTab()->createTemporary(comp()->getMethodSymbol(), type);
+        TR::SymbolReference *resultSymRef = getSymRefTab()->createTemporary(comp()->getMethodSymbol(), type);
+
+        TR::Node *dividendNode = node->getFirstChild();
+        TR::Node *divisorNode = node->getSecondChild();
+        TR::TreeTop *dividendTree
+            = TR::TreeTop::create(comp(), tt->getPrevTreeTop(), TR::Node::createStore(dividendSymRef, dividendNode));
+        TR::TreeTop *divisorTree
+            = TR::TreeTop::create(comp(), dividendTree, TR::Node::createStore(divisorSymRef, divisorNode));
+        node->setAndIncChild(0, TR::Node::createLoad(node, dividendSymRef));
+        node->setAndIncChild(1, TR::Node::createLoad(node, divisorSymRef));
+        dividendNode->decReferenceCount();
+        divisorNode->decReferenceCount();
+
+        // The division is evaluated ahead of the rest of its tree so that it can be versioned
+        TR::TreeTop *anchorTree = TR::TreeTop::create(comp(), divisorTree, TR::Node::create(TR::treetop, 1, node));
+
+        TR::Node *profiledDivisor
+            = is64Bit ? TR::Node::lconst(node, divisor) : TR::Node::iconst(node, static_cast<int32_t>(divisor));
+        TR::TreeTop *compareTree = TR::TreeTop::create(comp(),
+            TR::Node::createif(is64Bit ? TR::iflcmpne : TR::ificmpne, TR::Node::createLoad(node, divisorSymRef),
+                profiledDivisor));
+
+        TR::Node *fastDivision = node->duplicateTree();
+        fastDivision->getSecondChild()->recursivelyDecReferenceCount();
+        fastDivision->setAndIncChild(1, profiledDivisor->duplicateTree());
+        TR::TreeTop *fastTree = TR::TreeTop::create(comp(), TR::Node::createStore(resultSymRef, fastDivision));
+        TR::TreeTop *slowTree
+            = TR::TreeTop::create(comp(), TR::Node::createStore(resultSymRef, node->duplicateTree()));
+
+        block->createConditionalBlocksBeforeTree(anchorTree, compareTree, slowTree, fastTree, comp()->getFlowGraph(),
+            false);
+
+        node->removeAllChildren();
+        TR::Node::recreate(node, comp()->il.opCodeForDirectLoad(type));
+        node->setSymbolReference(resultSymRef);
+
+        if (originalFrequency >= 0) {
+            int16_t fastFrequency = std::max<int16_t>(originalFrequency * probability, MAX_COLD_BLOCK_COUNT + 1);
+            int16_t slowFrequency = std::max<int16_t>(originalFrequency * (1 - probability), MAX_COLD_BLOCK_COUNT + 1);
+            fastTree->getEnclosingBlock()->setFrequency(fastFrequency);
+            slowTree->getEnclosingBlock()->setFrequency(slowFrequency);
+        }
+    }
+}
+
 const char *TR_ProfiledNodeVersioning::optDetailString() const throw() { return "O^O PROFILED NODE VERSIONING: "; }
 
 TR_Rematerialization::TR_Rematerialization(TR::OptimizationManager *manager)
@@ -816,6 +816,13 @@ public:
     //
     static TR_ByteCodeInfo temporarilySetProfilingBcInfoOnNewArrayLengthChild(TR::Node *newArray,
         TR::Compilation *comp);
+
+private:
+    /**
+     * Versions integer divisions and remainders whose divisor was almost always the same value in
+     * the TR::MethodProfile the compilation uses, so that the common case divides by a constant.
+     */
+    void versionProfiledDivisions();
 };
 
 // Look for simple anchored treetops that can be removed
@@ -0,0 +1,838 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/LoopVectorizer.hpp"
+
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "il/Block.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "optimizer/InductionVariable.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+#include "ras/Logger.hpp"
+
+#define MAX_OVERLAP_CHECKS 4
+
+TR::LoopVectorizer::LoopVectorizer(TR::OptimizationManager *manager)
+    : TR::Optimization(manager)
+{}
+
+int32_t TR::LoopVectorizer::perform()
+{
+    if (comp()->getOption(TR_DisableAutoSIMD) || optimizer()->optsThatCanCreateLoopsDisabled()) {
+        return 0;
+    }
+
+    TR_Structure *rootStructure = comp()->getFlowGraph()->getStructure();
+    if (rootStructure == NULL) {
+        return 0;
+    }
+
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+
+    TR::vector<TR_RegionStructure *, TR::Region &> loops(stackRegion);
+    collectInnermostLoops(rootStructure, loops);
+
+    TR::vector<VectorizableLoop *, TR::Region &> candidates(stackRegion);
+    for (auto it = loops.begin(); it != loops.end(); ++it) {
+        VectorizableLoop *info = analyzeLoop(*it);
+        if (info != NULL) {
+            candidates.push_back(info);
+        }
+    }
+
+    if (candidates.empty()) {
+        return 0;
+    }
+
+    // The new blocks and edges invalidate the structure
+    comp()->getFlowGraph()->setStructure(NULL);
+
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        transformLoop(*it);
+    }
+
+    optimizer()->setAliasSetsAreValid(false);
+    requestOpt(OMR::inductionVariableAnalysis);
+    return 1;
+}
+
+const char *TR::LoopVectorizer::optDetailString() const throw() { return "O^O LOOP VECTORIZER: "; }
+
+void TR::LoopVectorizer::collectInnermostLoops(TR_Structure *str,
+    TR::vector<TR_RegionStructure *, TR::Region &> &loops)
+{
+    TR_RegionStructure *region = str->asRegion();
+    if (region == NULL) {
+        return;
+    }
+
+    if (region->isNaturalLoop() && region->numSubNodes() == 1) {
+        loops.push_back(region);
+        return;
+    }
+
+    TR_RegionStructure::Cursor it(*region);
+    for (TR_StructureSubGraphNode *node = it.getFirst(); node != NULL; node = it.getNext()) {
+        collectInnermostLoops(node->getStructure(), loops);
+    }
+}
+
+bool TR::LoopVectorizer::reject(TR_RegionStructure *loop, const char *reason)
+{
+    logprintf(trace(), comp()->log(), "Loop %d is not vectorized: %s\n", loop->getNumber(), reason);
+    return false;
+}
+
+TR::LoopVectorizer::VectorizableLoop *TR::LoopVectorizer::analyzeLoop(TR_RegionStructure *loop)
+{
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+
+    TR_PrimaryInductionVariable *piv = loop->getPrimaryInductionVariable();
+    if (piv == NULL) {
+        reject(loop, "no primary induction variable");
+        return NULL;
+    }
+
+    TR::Block *body = loop->getEntryBlock();
+    if (body->isCold() || !body->getExceptionSuccessors().empty() || !body->getExceptionPredecessors().empty()) {
+        reject(loop, "body is cold or has exception edges");
+        return NULL;
+    }
+
+    if (piv->getDeltaOnBackEdge() != 1 || piv->getBranchBlock() != body || piv->usesUnchangedValueInLoopTest()
+        || piv->isUnsigned() || piv->getSymRef()->getSymbol()->getDataType() != TR::Int32) {
+        reject(loop, "induction variable is not a signed int counting up by one");
+        return NULL;
+    }
+
+    // The preheader is the only predecessor outside the loop and must reach the body by falling
+    // through or through a branch whose target can be redirected.
+    TR::Block *preheader = NULL;
+    for (auto edge = body->getPredecessors().begin(); edge != body->getPredecessors().end(); ++edge) {
+        TR::Block *pred = toBlock((*edge)->getFrom());
+        if (pred == body) {
+            continue;
+        }
+
+        if (preheader != NULL) {
+            reject(loop, "more than one entry edge");
+            return NULL;
+        }
+
+        preheader = pred;
+    }
+
+    if (preheader == NULL || preheader->getEntry() == NULL || body->getEntry()->getPrevTreeTop() == NULL) {
+        reject(loop, "no preheader");
+        return NULL;
+    }
+
+    TR::TreeTop *preheaderLastTree = preheader->getLastRealTreeTop();
+    TR::Node *preheaderLast = preheaderLastTree != NULL ? preheaderLastTree->getNode() : NULL;
+    if (preheaderLast != NULL
+        && (preheaderLast->getOpCode().isSwitch() || preheaderLast->getOpCode().isJumpWithMultipleTargets())) {
+        reject(loop, "preheader ends in a multi-way branch");
+        return NULL;
+    }
+
+    bool preheaderBranchesToBody = preheaderLast != NULL && preheaderLast->getOpCode().isBranch()
+        && preheaderLast->getBranchDestination() == body->getEntry();
+    if (preheaderBranchesToBody ? preheaderLast->getOpCode().isIf() && preheader->getNextBlock() == body
+                                : preheader->getNextBlock() != body) {
+        reject(loop, "preheader does not enter the body in a single way");
+        return NULL;
+    }
+
+    // do { ...; istore i (iadd (iload i) 1); } while (i < n); where the simplifier may have turned the
+    // increment into isub (iload i) -1
+    TR::TreeTop *branchTree = body->getLastRealTreeTop();
+    TR::Node *branch = branchTree->getNode();
+    if ((branch->getOpCodeValue() != TR::ificmplt && branch->getOpCodeValue() != TR::ificmpgt)
+        || branch->getNumChildren() != 2 || branch->getBranchDestination() != body->getEntry()
+        || body->getNextBlock() == NULL) {
+        reject(loop, "loop test is not a signed less than comparison");
+        return NULL;
+    }
+
+    bool ivOnLeft = branch->getOpCodeValue() == TR::ificmplt;
+    TR::Node *ivValue = ivOnLeft ? branch->getFirstChild() : branch->getSecondChild();
+    TR::Node *bound = ivOnLeft ? branch->getSecondChild() : branch->getFirstChild();
+
+    TR::SymbolReference *ivSymRef = piv->getSymRef();
+    TR::TreeTop *ivStoreTree = branchTree->getPrevRealTreeTop();
+    TR::Node *ivStore = ivStoreTree != body->getEntry() ? ivStoreTree->getNode() : NULL;
+    TR::Node *increment = ivStore != NULL && ivStore->getNumChildren() == 1 ? ivStore->getFirstChild() : NULL;
+    if (ivStore == NULL || ivStore->getOpCodeValue() != TR::istore || ivStore->getSymbolReference() != ivSymRef
+        || (increment->getOpCodeValue() != TR::iadd && increment->getOpCodeValue() != TR::isub)
+        || increment->getFirstChild()->getOpCodeValue() != TR::iload
+        || increment->getFirstChild()->getSymbolReference() != ivSymRef
+        || increment->getSecondChild()->getOpCodeValue() != TR::iconst
+        || increment->getSecondChild()->getInt() != (increment->getOpCodeValue() == TR::iadd ? 1 : -1)) {
+        reject(loop, "induction variable is not incremented right before the loop test");
+        return NULL;
+    }
+
+    if (ivValue != increment
+        && !(ivValue->getOpCodeValue() == TR::iload && ivValue->getSymbolReference() == ivSymRef
+            && ivValue->getReferenceCount() == 1)) {
+        reject(loop, "loop test does not compare the incremented induction variable");
+        return NULL;
+    }
+
+    VectorizableLoop *info = new (stackRegion) VectorizableLoop(stackRegion);
+    info->_body = body;
+    info->_preheader = preheader;
+    info->_exit = body->getNextBlock();
+    info->_ivSymRef = ivSymRef;
+    info->_bound = bound;
+    info->_elementType = TR::NoType;
+    info->_vectorLength = TR::NoVectorLength;
+    info->_lanes = 0;
+
+    for (TR::TreeTop *tt = body->getFirstRealTreeTop(); tt != ivStoreTree; tt = tt->getNextTreeTop()) {
+        TR::Node *node = tt->getNode();
+        if (node->getOpCode().isStoreIndirect()) {
+            info->_stores.push_back(node);
+        } else if (node->getOpCode().isStore()) {
+            reject(loop, "body stores to a local");
+            return NULL;
+        }
+    }
+
+    if (info->_stores.empty()) {
+        reject(loop, "body has no array stores");
+        return NULL;
+    }
+
+    info->_elementType = info->_stores.front()->getDataType();
+    if (!info->_elementType.isVectorElement()) {
+        reject(loop, "stored type has no vector form");
+        return NULL;
+    }
+
+    if (bound->getDataType() != TR::Int32 || !isLoopInvariant(info, bound)) {
+        reject(loop, "loop bound is not invariant");
+        return NULL;
+    }
+
+    if (!analyzeBody(loop, info) || !chooseVectorLength(info)) {
+        return NULL;
+    }
+
+    if (!analyzeDependences(loop, info)) {
+        return NULL;
+    }
+
+    if (!performTransformation(comp(), "%sVectorizing loop %d as %d lanes of %s with %d overlap checks\n",
+            optDetailString(), loop->getNumber(), info->_lanes, TR::DataType::getName(info->_elementType),
+            (int32_t)info->_overlapChecks.size())) {
+        return NULL;
+    }
+
+    return info;
+}
+
+bool TR::LoopVectorizer::analyzeBody(TR_RegionStructure *loop, VectorizableLoop *info)
+{
+    TR::TreeTop *ivStoreTree = info->_body->getLastRealTreeTop()->getPrevRealTreeTop();
+    int32_t treeIndex = 0;
+    for (TR::TreeTop *tt = info->_body->getFirstRealTreeTop(); tt != ivStoreTree;
+         tt = tt->getNextTreeTop(), treeIndex++) {
+        TR::Node *node = tt->getNode();
+        if (node->getOpCode().isStoreIndirect()) {
+            if (node->getOpCode().isWrtBar() || node->getDataType() != info->_elementType
+                || node->getNumChildren() != 2) {
+                return reject(loop, "array stores have different types");
+            }
+
+            if (!recordAccess(info, node, treeIndex)
+                || !analyzeVectorExpression(info, node->getSecondChild(), treeIndex)) {
+                return reject(loop, "stored value cannot be computed as a vector");
+            }
+        } else if (node->getOpCodeValue() == TR::treetop) {
+            TR::Node *child = node->getFirstChild();
+            if (!isPureScalar(info, child) && !analyzeVectorExpression(info, child, treeIndex)) {
+                return reject(loop, "anchored tree cannot be computed as a vector");
+            }
+        } else {
+            return reject(loop, "body contains a tree other than array stores");
+        }
+    }
+
+    return true;
+}
+
+bool TR::LoopVectorizer::chooseVectorLength(VectorizableLoop *info)
+{
+    static const TR::VectorLength lengths[] = { TR::VectorLength512, TR::VectorLength256, TR::VectorLength128 };
+
+    TR::VectorLength preferred = cg()->getMaxPreferredVectorLength();
+    if (preferred == TR::NoVectorLength || preferred == TR::VectorLength64) {
+        return false;
+    }
+
+    for (int32_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        TR::VectorLength length = lengths[i];
+        if (length > preferred) {
+            continue;
+        }
+
+        TR::DataType vectorType = TR::DataType::createVectorType(info->_elementType, length);
+        if (vectorType.getVectorNumLanes() < 2
+            || !cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType))
+            || !cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType))
+            || (info->_needsSplat
+                && !cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType)))) {
+            continue;
+        }
+
+        bool supported = true;
+        for (auto op = info->_vectorOps.begin(); supported && op != info->_vectorOps.end(); ++op) {
+            TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(*op, length);
+            supported = vectorOp != TR::BadILOp && cg()->getSupportsOpCodeForAutoSIMD(vectorOp);
+        }
+
+        if (supported) {
+            info->_vectorLength = length;
+            info->_lanes = vectorType.getVectorNumLanes();
+            return true;
+        }
+    }
+
+    logprintf(trace(), comp()->log(), "No supported vector length for %s\n",
+        TR::DataType::getName(info->_elementType));
+    return false;
+}
+
+/**
+ * A vector iteration loads every element it uses before storing any, so a store must not feed a
+ * load of a later scalar iteration that falls into the same vector, and a load that follows a store
+ * in the body must not read an element that a later iteration of the same vector stores. Accesses
+ * that are a whole vector apart are always independent.
+ *
+ * Accesses off the same base are checked here. Accesses off different bases that alias analysis
+ * cannot separate get an overlap check that runs before the vector loop.
+ */
+bool TR::LoopVectorizer::analyzeDependences(TR_RegionStructure *loop, VectorizableLoop *info)
+{
+    int64_t vectorBytes = (int64_t)info->_lanes * TR::DataType::getSize(info->_elementType);
+
+    for (size_t s = 0; s < info->_accesses.size(); s++) {
+        ArrayAccess &store = info->_accesses[s];
+        if (!store._node->getOpCode().isStore()) {
+            continue;
+        }
+
+        for (size_t m = 0; m < info->_accesses.size(); m++) {
+            ArrayAccess &other = info->_accesses[m];
+            bool otherIsStore = other._node->getOpCode().isStore();
+            if (m == s || (otherIsStore && m < s)) {
+                continue;
+            }
+
+            if (isSameBase(store._base, other._base)) {
+                int64_t distance = other._offset - store._offset;
+                if (distance >= vectorBytes || distance <= -vectorBytes) {
+                    continue;
+                }
+
+                bool independent = otherIsStore ? distance == 0
+                                                : (other._treeIndex <= store._treeIndex ? distance >= 0 : distance <= 0);
+                if (!independent) {
+                    return reject(loop, "loop carried dependence within one vector");
+                }
+
+                continue;
+            }
+
+            TR::SymbolReference *otherSymRef = other._node->getSymbolReference();
+            if (store._node->getSymbolReference() != otherSymRef
+                && !store._node->mayKill().contains(otherSymRef, comp())) {
+                continue;
+            }
+
+            bool known = false;
+            for (auto check = info->_overlapChecks.begin(); !known && check != info->_overlapChecks.end(); ++check) {
+                known = isSameBase(check->_storeBase, store._base) && isSameBase(check->_otherBase, other._base)
+                    && check->_storeOffset == store._offset && check->_otherOffset == other._offset;
+            }
+
+            if (known) {
+                continue;
+            }
+
+            if (info->_overlapChecks.size() >= MAX_OVERLAP_CHECKS) {
+                return reject(loop, "too many arrays may overlap");
+            }
+
+            OverlapCheck check = { store._base, store._offset, other._base, other._offset };
+            info->_overlapChecks.push_back(check);
+        }
+    }
+
+    return true;
+}
+
+bool TR::LoopVectorizer::isLoopInvariant(VectorizableLoop *info, TR::Node *node)
+{
+    TR::ILOpCode &op = node->getOpCode();
+    if (op.isLoadConst() || node->getOpCodeValue() == TR::loadaddr) {
+        return true;
+    }
+
+    if (op.isLoadVarDirect()) {
+        TR::SymbolReference *symRef = node->getSymbolReference();
+        if (symRef == info->_ivSymRef || !symRef->getSymbol()->isAutoOrParm() || symRef->getSymbol()->isVolatile()) {
+            return false;
+        }
+
+        for (auto store = info->_stores.begin(); store != info->_stores.end(); ++store) {
+            if ((*store)->mayKill().contains(symRef, comp())) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    if ((op.isArithmetic() || op.isConversion()) && !op.isDiv() && !op.isRem()) {
+        for (int32_t i = 0; i < node->getNumChildren(); i++) {
+            if (!isLoopInvariant(info, node->getChild(i))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+bool TR::LoopVectorizer::isPureScalar(VectorizableLoop *info, TR::Node *node)
+{
+    if (isLoopInvariant(info, node)) {
+        return true;
+    }
+
+    TR::ILOpCode &op = node->getOpCode();
+    if (op.isLoadVarDirect()) {
+        return node->getSymbolReference() == info->_ivSymRef;
+    }
+
+    if ((op.isArithmetic() || op.isConversion()) && !op.isDiv() && !op.isRem()) {
+        for (int32_t i = 0; i < node->getNumChildren(); i++) {
+            if (!isPureScalar(info, node->getChild(i))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Express an integer node as scale * i + offset where i is the induction variable.
+ */
+bool TR::LoopVectorizer::getAffineForm(VectorizableLoop *info, TR::Node *node, int64_t &scale, int64_t &offset)
+{
+    static const int64_t limit = (int64_t)1 << 31;
+
+    TR::ILOpCodes op = node->getOpCodeValue();
+    int64_t scale1, offset1, scale2, offset2;
+
+    switch (op) {
+        case TR::iconst:
+        case TR::lconst:
+            scale = 0;
+            offset = node->get64bitIntegralValue();
+            break;
+        case TR::iload:
+            if (node->getSymbolReference() != info->_ivSymRef) {
+                return false;
+            }
+
+            scale = 1;
+            offset = 0;
+            break;
+        case TR::i2l:
+            return getAffineForm(info, node->getFirstChild(), scale, offset);
+        case TR::iadd:
+        case TR::ladd:
+        case TR::isub:
+        case TR::lsub:
+            if (!getAffineForm(info, node->getFirstChild(), scale1, offset1)
+                || !getAffineForm(info, node->getSecondChild(), scale2, offset2)) {
+                return false;
+            }
+
+            if (node->getOpCode().isAdd()) {
+                scale = scale1 + scale2;
+                offset = offset1 + offset2;
+            } else {
+                scale = scale1 - scale2;
+                offset = offset1 - offset2;
+            }
+            break;
+        case TR::imul:
+        case TR::lmul:
+            if (!getAffineForm(info, node->getFirstChild(), scale1, offset1)
+                || !getAffineForm(info, node->getSecondChild(), scale2, offset2)) {
+                return false;
+            }
+
+            if (scale1 != 0 && scale2 != 0) {
+                return false;
+            }
+
+            scale = scale1 * offset2 + scale2 * offset1;
+            offset = offset1 * offset2;
+            break;
+        case TR::ishl:
+        case TR::lshl:
+            if (!node->getSecondChild()->getOpCode().isLoadConst() || node->getSecondChild()->getInt() < 0
+                || node->getSecondChild()->getInt() > 31
+                || !getAffineForm(info, node->getFirstChild(), scale1, offset1)) {
+                return false;
+            }
+
+            scale = scale1 << node->getSecondChild()->getInt();
+            offset = offset1 << node->getSecondChild()->getInt();
+            break;
+        default:
+            return false;
+    }
+
+    return scale > -limit && scale < limit && offset > -limit && offset < limit;
+}
+
+/**
+ * Express an address as base + scale * i + offset where base is loop invariant.
+ */
+bool TR::LoopVectorizer::analyzeAddress(VectorizableLoop *info, TR::Node *node, TR::Node *&base, int64_t &scale,
+    int64_t &offset)
+{
+    if (node->getOpCodeValue() == TR::aladd || node->getOpCodeValue() == TR::aiadd) {
+        int64_t indexScale, indexOffset;
+        if (getAffineForm(info, node->getSecondChild(), indexScale, indexOffset)
+            && analyzeAddress(info, node->getFirstChild(), base, scale, offset)) {
+            scale += indexScale;
+            offset += indexOffset;
+            return true;
+        }
+    }
+
+    if (node->getDataType() == TR::Address && isLoopInvariant(info, node)) {
+        base = node;
+        scale = 0;
+        offset = 0;
+        return true;
+    }
+
+    return false;
+}
+
+bool TR::LoopVectorizer::recordAccess(VectorizableLoop *info, TR::Node *node, int32_t treeIndex)
+{
+    TR::SymbolReference *symRef = node->getSymbolReference();
+    if (symRef == NULL || symRef->getSymbol()->isVolatile()) {
+        return false;
+    }
+
+    ArrayAccess access;
+    int64_t scale;
+    if (!analyzeAddress(info, node->getFirstChild(), access._base, scale, access._offset)
+        || scale != TR::DataType::getSize(info->_elementType)) {
+        return false;
+    }
+
+    access._node = node;
+    access._offset += symRef->getOffset();
+    access._treeIndex = treeIndex;
+    info->_accesses.push_back(access);
+    return true;
+}
+
+static bool isVectorizableOperation(TR::ILOpCode &op)
+{
+    if (op.isAdd() || op.isSub() || op.isMul() || op.isNeg()) {
+        return true;
+    }
+
+    if (op.isFloatingPoint()) {
+        return op.isDiv();
+    }
+
+    return op.isAnd() || op.isOr() || op.isXor();
+}
+
+bool TR::LoopVectorizer::analyzeVectorExpression(VectorizableLoop *info, TR::Node *node, int32_t treeIndex)
+{
+    auto known = info->_vectorNodes.find(node);
+    if (known != info->_vectorNodes.end()) {
+        return known->second;
+    }
+
+    bool isVector = false;
+    TR::ILOpCode &op = node->getOpCode();
+    if (node->getDataType() == info->_elementType) {
+        if (op.isLoadIndirect()) {
+            isVector = recordAccess(info, node, treeIndex);
+        } else if (isLoopInvariant(info, node)) {
+            isVector = true;
+            info->_needsSplat = true;
+        } else if (isVectorizableOperation(op)
+            && TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), TR::VectorLength128) != TR::BadILOp) {
+            isVector = true;
+            for (int32_t i = 0; isVector && i < node->getNumChildren(); i++) {
+                isVector = analyzeVectorExpression(info, node->getChild(i), treeIndex);
+            }
+
+            if (isVector) {
+                info->_vectorOps.push_back(node->getOpCodeValue());
+            }
+        }
+    }
+
+    info->_vectorNodes[node] = isVector;
+    return isVector;
+}
+
+bool TR::LoopVectorizer::isSameBase(TR::Node *base1, TR::Node *base2)
+{
+    if (base1 == base2) {
+        return true;
+    }
+
+    if (base1->getOpCodeValue() != base2->getOpCodeValue()) {
+        return false;
+    }
+
+    return (base1->getOpCode().isLoadVarDirect() || base1->getOpCodeValue() == TR::loadaddr)
+        && base1->getSymbolReference() == base2->getSymbolReference();
+}
+
+/**
+ * The loop becomes
+ *
+ *    preheader
+ *    guard:     if (n - i < lanes) goto body
+ *    overlap:   if (stored and other array are less than a vector apart) goto body   (for each check)
+ *    vector:    vector body; i = i + lanes; if (n - i >= lanes) goto vector
+ *    tail:      if (i >= n) goto exit
+ *    body:      original scalar loop
+ *    exit
+ */
+void TR::LoopVectorizer::transformLoop(VectorizableLoop *info)
+{
+    TR::CFG *cfg = comp()->getFlowGraph();
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+    TR::Block *body = info->_body;
+    TR::Block *preheader = info->_preheader;
+    TR::TreeTop *branchTree = body->getLastRealTreeTop();
+    TR::TreeTop *ivStoreTree = branchTree->getPrevRealTreeTop();
+    TR::Node *origin = branchTree->getNode();
+    TR::DataType vectorType = TR::DataType::createVectorType(info->_elementType, info->_vectorLength);
+
+    TR::vector<TR::Block *, TR::Region &> newBlocks(stackRegion);
+
+    TR::Block *guard = TR::Block::createEmptyBlock(origin, comp(), preheader->getFrequency(), preheader);
+    guard->append(TR::TreeTop::create(comp(),
+        TR::Node::createif(TR::iflcmplt, createRemainingIterations(info, origin),
+            TR::Node::lconst(origin, info->_lanes), body->getEntry())));
+    newBlocks.push_back(guard);
+
+    for (auto check = info->_overlapChecks.begin(); check != info->_overlapChecks.end(); ++check) {
+        TR::Block *overlapGuard = TR::Block::createEmptyBlock(origin, comp(), preheader->getFrequency(), preheader);
+        overlapGuard->append(TR::TreeTop::create(comp(), createOverlapTest(info, *check, origin)));
+        newBlocks.push_back(overlapGuard);
+    }
+
+    TR::map<TR::Node *, TR::Node *> vectorMap(std::less<TR::Node *>(), stackRegion);
+    TR::map<TR::Node *, TR::Node *> scalarMap(std::less<TR::Node *>(), stackRegion);
+
+    TR::Block *vectorBody = TR::Block::createEmptyBlock(origin, comp(), body->getFrequency(), body);
+    for (TR::TreeTop *tt = body->getFirstRealTreeTop(); tt != ivStoreTree; tt = tt->getNextTreeTop()) {
+        TR::Node *node = tt->getNode();
+        if (node->getOpCode().isStoreIndirect()) {
+            TR::Node *address = createAddress(duplicateScalar(node->getFirstChild(), scalarMap),
+                node->getSymbolReference()->getOffset(), origin);
+            TR::Node *value = vectorize(info, node->getSecondChild(), vectorMap, scalarMap);
+            TR::SymbolReference *symRef = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, address);
+            TR::Node *store = TR::Node::createWithSymRef(TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType), 2,
+                2, address, value, symRef);
+            vectorBody->append(TR::TreeTop::create(comp(), store));
+        } else if (!isPureScalar(info, node->getFirstChild())) {
+            TR::Node *value = vectorize(info, node->getFirstChild(), vectorMap, scalarMap);
+            vectorBody->append(TR::TreeTop::create(comp(), TR::Node::create(origin, TR::treetop, 1, value)));
+        }
+    }
+
+    TR::Node *increment = TR::Node::create(origin, TR::iadd, 2, TR::Node::createLoad(origin, info->_ivSymRef),
+        TR::Node::iconst(origin, info->_lanes));
+    vectorBody->append(TR::TreeTop::create(comp(), TR::Node::createStore(origin, info->_ivSymRef, increment)));
+    vectorBody->append(TR::TreeTop::create(comp(),
+        TR::Node::createif(TR::iflcmpge, createRemainingIterations(info, origin),
+            TR::Node::lconst(origin, info->_lanes), vectorBody->getEntry())));
+    newBlocks.push_back(vectorBody);
+
+    TR::Block *tail = TR::Block::createEmptyBlock(origin, comp(), preheader->getFrequency(), preheader);
+    tail->append(TR::TreeTop::create(comp(),
+        TR::Node::createif(TR::ificmpge, TR::Node::createLoad(origin, info->_ivSymRef), info->_bound->duplicateTree(),
+            info->_exit->getEntry())));
+    newBlocks.push_back(tail);
+
+    TR::TreeTop *prevTree = body->getEntry()->getPrevTreeTop();
+    for (auto it = newBlocks.begin(); it != newBlocks.end(); ++it) {
+        cfg->addNode(*it);
+        prevTree->join((*it)->getEntry());
+        prevTree = (*it)->getExit();
+    }
+    prevTree->join(body->getEntry());
+
+    for (size_t i = 0; i + 2 < newBlocks.size(); i++) {
+        cfg->addEdge(newBlocks[i], body);
+        cfg->addEdge(newBlocks[i], newBlocks[i + 1]);
+    }
+    cfg->addEdge(vectorBody, vectorBody);
+    cfg->addEdge(vectorBody, tail);
+    cfg->addEdge(tail, info->_exit);
+    cfg->addEdge(tail, body);
+
+    TR::TreeTop *preheaderLastTree = preheader->getLastRealTreeTop();
+    TR::Node *preheaderLast = preheaderLastTree != NULL ? preheaderLastTree->getNode() : NULL;
+    if (preheaderLast != NULL && preheaderLast->getOpCode().isBranch()
+        && preheaderLast->getBranchDestination() == body->getEntry()) {
+        preheader->changeBranchDestination(guard->getEntry(), cfg);
+    } else {
+        cfg->addEdge(preheader, guard);
+        cfg->removeEdge(preheader, body);
+    }
+}
+
+TR::Node *TR::LoopVectorizer::vectorize(VectorizableLoop *info, TR::Node *node,
+    TR::map<TR::Node *, TR::Node *> &vectorMap, TR::map<TR::Node *, TR::Node *> &scalarMap)
+{
+    auto known = vectorMap.find(node);
+    if (known != vectorMap.end()) {
+        return known->second;
+    }
+
+    TR::DataType vectorType = TR::DataType::createVectorType(info->_elementType, info->_vectorLength);
+    TR::Node *result;
+    if (node->getOpCode().isLoadIndirect()) {
+        TR::Node *address = createAddress(duplicateScalar(node->getFirstChild(), scalarMap),
+            node->getSymbolReference()->getOffset(), node);
+        TR::SymbolReference *symRef = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, address);
+        result = TR::Node::createWithSymRef(node, TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType), 1,
+            address, symRef);
+    } else if (isLoopInvariant(info, node)) {
+        result = TR::Node::create(node, TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType), 1,
+            duplicateScalar(node, scalarMap));
+    } else {
+        result = TR::Node::create(node, TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), info->_vectorLength),
+            node->getNumChildren());
+        for (int32_t i = 0; i < node->getNumChildren(); i++) {
+            result->setAndIncChild(i, vectorize(info, node->getChild(i), vectorMap, scalarMap));
+        }
+    }
+
+    vectorMap[node] = result;
+    return result;
+}
+
+TR::Node *TR::LoopVectorizer::duplicateScalar(TR::Node *node, TR::map<TR::Node *, TR::Node *> &scalarMap)
+{
+    auto known = scalarMap.find(node);
+    if (known != scalarMap.end()) {
+        return known->second;
+    }
+
+    TR::Node *copy = node->duplicateTree();
+    scalarMap[node] = copy;
+    return copy;
+}
+
+TR::Node *TR::LoopVectorizer::createAddress(TR::Node *address, int32_t offset, TR::Node *origin)
+{
+    if (offset == 0) {
+        return address;
+    }
+
+    if (comp()->target().is64Bit()) {
+        return TR::Node::create(origin, TR::aladd, 2, address, TR::Node::lconst(origin, offset));
+    }
+
+    return TR::Node::create(origin, TR::aiadd, 2, address, TR::Node::iconst(origin, offset));
+}
+
+/**
+ * (long)n - (long)i
+ */
+TR::Node *TR::LoopVectorizer::createRemainingIterations(VectorizableLoop *info, TR::Node *origin)
+{
+    TR::Node *bound = TR::Node::create(origin, TR::i2l, 1, info->_bound->duplicateTree());
+    TR::Node *iv = TR::Node::create(origin, TR::i2l, 1, TR::Node::createLoad(origin, info->_ivSymRef));
+    return TR::Node::create(origin, TR::lsub, 2, bound, iv);
+}
+
+/**
+ * Branch to the scalar loop when the store and the other access are less than a vector apart,
+ * that is when (storeBase + storeOffset) - (otherBase + otherOffset) + bytes - 1 is unsigned
+ * less than 2 * bytes - 1.
+ */
+TR::Node *TR::LoopVectorizer::createOverlapTest(VectorizableLoop *info, OverlapCheck &check, TR::Node *origin)
+{
+    int64_t vectorBytes = (int64_t)info->_lanes * TR::DataType::getSize(info->_elementType);
+    int64_t adjustment = check._storeOffset - check._otherOffset + vectorBytes - 1;
+
+    if (comp()->target().is64Bit()) {
+        TR::Node *storeAddress = TR::Node::create(origin, TR::a2l, 1, check._storeBase->duplicateTree());
+        TR::Node *otherAddress = TR::Node::create(origin, TR::a2l, 1, check._otherBase->duplicateTree());
+        TR::Node *delta = TR::Node::create(origin, TR::lsub, 2, storeAddress, otherAddress);
+        delta = TR::Node::create(origin, TR::ladd, 2, delta, TR::Node::lconst(origin, adjustment));
+        return TR::Node::createif(TR::iflucmplt, delta, TR::Node::lconst(origin, 2 * vectorBytes - 1),
+            info->_body->getEntry());
+    }
+
+    TR::Node *storeAddress = TR::Node::create(origin, TR::a2i, 1, check._storeBase->duplicateTree());
+    TR::Node *otherAddress = TR::Node::create(origin, TR::a2i, 1, check._otherBase->duplicateTree());
+    TR::Node *delta = TR::Node::create(origin, TR::isub, 2, storeAddress, otherAddress);
+    delta = TR::Node::create(origin, TR::iadd, 2, delta, TR::Node::iconst(origin, (int32_t)adjustment));
+    return TR::Node::createif(TR::ifiucmplt, delta, TR::Node::iconst(origin, (int32_t)(2 * vectorBytes - 1)),
+        info->_body->getEntry());
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef LOOPVECTORIZER_INCL
+#define LOOPVECTORIZER_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "infra/map.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_RegionStructure;
+class TR_Structure;
+
+namespace TR {
+class Block;
+class Node;
+class SymbolReference;
+class TreeTop;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * Loop auto-vectorization.
+ *
+ * Rewrites innermost counted loops of the form
+ *
+ *    do { a[i + c0] = f(b[i + c1], ..., invariants); i = i + 1; } while (i < n);
+ *
+ * whose body is a single block, so that most iterations run as a vector loop that processes one
+ * vector of array elements per iteration. The original loop is kept as the scalar epilogue for the
+ * remaining iterations and as the fallback when too few iterations remain or when a runtime check
+ * finds that a stored array overlaps another accessed array closely enough to carry a dependence.
+ *
+ * The loop shape comes from the primary induction variable found by inductionVariableAnalysis, so
+ * this must run after loopCanonicalization and inductionVariableAnalysis. Only the vector opcodes
+ * the code generator reports as supported for auto-SIMD are generated.
+ */
+class LoopVectorizer : public TR::Optimization {
+public:
+    LoopVectorizer(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) LoopVectorizer(manager);
+    }
+
+    virtual int32_t perform();
+    virtual const char *optDetailString() const throw();
+
+private:
+    /**
+     * A load or store of an array element whose address is base + offset + elementSize * i.
+     */
+    struct ArrayAccess {
+        TR::Node *_node;
+        TR::Node *_base;
+        int64_t _offset;
+        int32_t _treeIndex; ///< index of the tree that first evaluates the access
+    };
+
+    /**
+     * Two accesses whose bases may refer to the same array and must be at least one vector apart.
+     */
+    struct OverlapCheck {
+        TR::Node *_storeBase;
+        int64_t _storeOffset;
+        TR::Node *_otherBase;
+        int64_t _otherOffset;
+    };
+
+    struct VectorizableLoop {
+        VectorizableLoop(TR::Region &region)
+            : _stores(region)
+            , _accesses(region)
+            , _overlapChecks(region)
+            , _vectorOps(region)
+            , _vectorNodes(std::less<TR::Node *>(), region)
+            , _needsSplat(false)
+        {}
+
+        TR::Block *_body;
+        TR::Block *_preheader;
+        TR::Block *_exit;
+        TR::SymbolReference *_ivSymRef;
+        TR::Node *_bound;
+        TR::DataType _elementType;
+        TR::VectorLength _vectorLength;
+        int32_t _lanes;
+        TR::vector<TR::Node *, TR::Region &> _stores; ///< indirect stores in the body
+        TR::vector<ArrayAccess, TR::Region &> _accesses;
+        TR::vector<OverlapCheck, TR::Region &> _overlapChecks;
+        TR::vector<TR::ILOpCodes, TR::Region &> _vectorOps; ///< scalar operations that are computed as vectors
+        TR::map<TR::Node *, bool> _vectorNodes; ///< nodes already classified, mapped to whether they are vectors
+        bool _needsSplat;
+    };
+
+    void collectInnermostLoops(TR_Structure *str, TR::vector<TR_RegionStructure *, TR::Region &> &loops);
+    VectorizableLoop *analyzeLoop(TR_RegionStructure *loop);
+    bool analyzeBody(TR_RegionStructure *loop, VectorizableLoop *info);
+    bool chooseVectorLength(VectorizableLoop *info);
+    bool analyzeDependences(TR_RegionStructure *loop, VectorizableLoop *info);
+    bool reject(TR_RegionStructure *loop, const char *reason);
+
+    bool isLoopInvariant(VectorizableLoop *info, TR::Node *node);
+    bool isPureScalar(VectorizableLoop *info, TR::Node *node);
+    bool getAffineForm(VectorizableLoop *info, TR::Node *node, int64_t &scale, int64_t &offset);
+    bool analyzeAddress(VectorizableLoop *info, TR::Node *node, TR::Node *&base, int64_t &scale, int64_t &offset);
+    bool analyzeVectorExpression(VectorizableLoop *info, TR::Node *node, int32_t treeIndex);
+    bool recordAccess(VectorizableLoop *info, TR::Node *node, int32_t treeIndex);
+    bool isSameBase(TR::Node *base1, TR::Node *base2);
+
+    void transformLoop(VectorizableLoop *info);
+    TR::Node *vectorize(VectorizableLoop *info, TR::Node *node, TR::map<TR::Node *, TR::Node *> &vectorMap,
+        TR::map<TR::Node *, TR::Node *> &scalarMap);
+    TR::Node *duplicateScalar(TR::Node *node, TR::map<TR::Node *, TR::Node *> &scalarMap);
+    TR::Node *createAddress(TR::Node *address, int32_t offset, TR::Node *origin);
+    TR::Node *createRemainingIterations(VectorizableLoop *info, TR::Node *origin);
+    TR::Node *createOverlapTest(VectorizableLoop *info, OverlapCheck &check, TR::Node *origin);
+};
+
+} // namespace TR
+
+#endif // LOOPVECTORIZER_INCL
@@ -88,6 +88,7 @@
 #include "optimizer/LocalOpts.hpp"
 #include "optimizer/LocalReordering.hpp"
 #include "optimizer/LoopCanonicalizer.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
 #include "optimizer/LoopVersioner.hpp"
@@ -104,6 +105,8 @@
 #include "optimizer/OSRDefAnalysis.hpp"
 #include "optimizer/RegDepCopyRemoval.hpp"
 #include "optimizer/SinkStores.hpp"
+#include "optimizer/SLPVectorizer.hpp"
+#include "optimizer/AllocationEscapeAnalysis.hpp"
 #include "optimizer/PartialRedundancy.hpp"
 #include "optimizer/StripMiner.hpp"
 #include "optimizer/FieldPrivatizer.hpp"
@@ -196,6 +199,8 @@ static const OptimizationStrategy partialRedundancyEliminationOpts[] = {
     { OMR::preEscapeAnalysis, OMR::IfOSR },
     { OMR::escapeAnalysis, OMR::IfEAOpportunitiesMarkLastRun }, // to stack-allocate after loopversioner and localCSE
     { OMR::postEscapeAnalysis, OMR::IfOSR },
+#else
+    { OMR::escapeAnalysis, OMR::IfEAOpportunitiesMarkLastRun }, // replace or stack-allocate non-escaping objects
 #endif
     { OMR::basicBlockOrdering, OMR::IfLoops }, // early ordering with no extension
     { OMR::globalCopyPropagation, OMR::IfLoops }, // for Loop Versioner
@@ -427,6 +432,8 @@ static const OptimizationStrategy fullColdStrategyOpts[] = {
 };
 
 static const OptimizationStrategy fullWarmStrategyOpts[] = {
+    { OMR::profiledNodeVersioning, OMR::IfMethodProfile }, // before other opts replace the profiled nodes
+    { OMR::basicBlockOrdering, OMR::IfMethodProfile }, // lay out the blocks by their profiled frequencies
     { OMR::basicBlockExtension },
     { OMR::localCSE },
     { OMR::treeSimplification },
@@ -455,10 +462,14 @@ static const OptimizationStrategy fullHotStrategyOpts[] = {
     { OMR::inductionVariableAnalysis },
     { OMR::loopSpecializerGroup },
     { OMR::inductionVariableAnalysis },
+    { OMR::loopVectorizer },
+    { OMR::inductionVariableAnalysis, OMR::IfEnabled },
     { OMR::generalLoopUnroller }, // unroll Loops
     { OMR::blockSplitter, OMR::MarkLastRun },
     { OMR::blockManipulationGroup },
     { OMR::lateLocalGroup },
+    { OMR::slpVectorizer }, // pack the stores of unrolled loop bodies
+    { OMR::deadTreesElimination, OMR::IfEnabled }, // remove anchors of the scalar values that were packed
     { OMR::redundantAsyncCheckRemoval }, // optimize async check placement
 #ifdef J9_PROJECT_SPECIFIC
     { OMR::recompilationModifier }, // do before GRA to avoid commoning of longs afterwards
@@ -593,6 +604,12 @@ OMR::FullOptimizer::FullOptimizer(TR::Compilation *comp, TR::ResolvedMethodSymbo
         TR::OptimizationManager(self(), TR::TrivialDeadStoreElimination::create, OMR::trivialDeadStoreElimination);
     _opts[OMR::loopSpecializer]
         = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopSpecializer::create, OMR::loopSpecializer);
+    _opts[OMR::loopVectorizer]
+        = new (comp->allocator()) TR::OptimizationManager(self(), TR::LoopVectorizer::create, OMR::loopVectorizer);
+    _opts[OMR::slpVectorizer]
+        = new (comp->allocator()) TR::OptimizationManager(self(), TR::SLPVectorizer::create, OMR::slpVectorizer);
+    _opts[OMR::escapeAnalysis] = new (comp->allocator())
+        TR::OptimizationManager(self(), TR::AllocationEscapeAnalysis::create, OMR::escapeAnalysis);
     // NOTE: Please add new OMR optimizations here!
 
     // initialize OMR optimization groups
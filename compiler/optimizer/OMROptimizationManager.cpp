@@ -129,12 +129,18 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
         case OMR::fieldPrivatization:
             _flags.set(requiresStructure);
             break;
+        case OMR::escapeAnalysis:
+            _flags.set(requiresStructure);
+            break;
         case OMR::catchBlockRemoval:
             _flags.set(verifyTrees | verifyBlocks | checkTheCFG);
             break;
         case OMR::generalLoopUnroller:
             _flags.set(requiresStructure | checkStructure | dumpStructure);
             break;
+        case OMR::loopVectorizer:
+            _flags.set(requiresStructure);
+            break;
         case OMR::redundantAsyncCheckRemoval:
             _flags.set(requiresStructure);
             break;
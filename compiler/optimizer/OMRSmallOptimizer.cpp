@@ -80,8 +80,11 @@
 #include "optimizer/LocalDeadStoreElimination.hpp"
 #include "optimizer/LocalOpts.hpp"
 #include "optimizer/LoopCanonicalizer.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/Simplifier.hpp"
+#include "optimizer/SLPVectorizer.hpp"
+#include "optimizer/AllocationEscapeAnalysis.hpp"
 #include "optimizer/Inliner.hpp"
 #include "ras/Debug.hpp"
 #include "optimizer/InductionVariable.hpp"
@@ -140,6 +143,7 @@ static const OptimizationStrategy smallColdStrategyOpts[] = {
 };
 
 static const OptimizationStrategy smallWarmStrategyOpts[] = {
+    { OMR::profiledNodeVersioning, OMR::IfMethodProfile }, // before other opts replace the profiled nodes
     { OMR::deadTreesElimination },
     { OMR::inlining },
     { OMR::treeSimplification },
@@ -160,11 +164,15 @@ static const OptimizationStrategy smallWarmStrategyOpts[] = {
     { OMR::basicBlockOrdering, OMR::IfLoops }, // clean up block order for loop canonicalization, if it will run
     { OMR::loopCanonicalization,
      OMR::IfLoops }, // canonicalization must run before inductionVariableAnalysis else indvar data gets messed up
-    { OMR::inductionVariableAnalysis, OMR::IfLoops }, // needed for loop unroller
+    { OMR::inductionVariableAnalysis, OMR::IfLoops }, // needed for loop vectorizer and unroller
+    { OMR::loopVectorizer, OMR::IfLoops },
+    { OMR::inductionVariableAnalysis, OMR::IfEnabledAndLoops }, // vectorized loops need a new primary induction variable
     { OMR::generalLoopUnroller, OMR::IfLoops },
     { OMR::basicBlockExtension, OMR::MarkLastRun }, // clean up order and extend blocks now
     { OMR::treeSimplification },
     { OMR::localCSE },
+    { OMR::slpVectorizer }, // pack the stores of unrolled loop bodies
+    { OMR::deadTreesElimination, OMR::IfEnabled }, // remove anchors of the scalar values that were packed
     { OMR::treeSimplification, OMR::IfEnabled },
     { OMR::trivialDeadTreeRemoval, OMR::IfEnabled },
     { OMR::cheapTacticalGlobalRegisterAllocatorGroup },
@@ -234,6 +242,7 @@ OMR::SmallOptimizer::SmallOptimizer(TR::Compilation *comp, TR::ResolvedMethodSym
     , _eliminatedCheckcastNodes(comp->trMemory())
     , _classPointerNodes(comp->trMemory())
     , _optMessageIndex(0)
+    , _optDepth(1)
     , _seenBlocksGRA(NULL)
     , _resetExitsGRA(NULL)
     , _successorBitsGRA(NULL)
@@ -293,6 +302,14 @@ OMR::SmallOptimizer::SmallOptimizer(TR::Compilation *comp, TR::ResolvedMethodSym
         TR::OptimizationManager(self(), TR_GlobalRegisterAllocator::create, OMR::tacticalGlobalRegisterAllocator);
     _opts[OMR::switchAnalyzer]
         = new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
+    _opts[OMR::loopVectorizer]
+        = new (comp->allocator()) TR::OptimizationManager(self(), TR::LoopVectorizer::create, OMR::loopVectorizer);
+    _opts[OMR::slpVectorizer]
+        = new (comp->allocator()) TR::OptimizationManager(self(), TR::SLPVectorizer::create, OMR::slpVectorizer);
+    _opts[OMR::escapeAnalysis] = new (comp->allocator())
+        TR::OptimizationManager(self(), TR::AllocationEscapeAnalysis::create, OMR::escapeAnalysis);
+    _opts[OMR::profiledNodeVersioning] = new (comp->allocator())
+        TR::OptimizationManager(self(), TR_ProfiledNodeVersioning::create, OMR::profiledNodeVersioning);
     // NOTE: Please add new OMR optimizations here!
 
     // initialize OMR small optimization groups
@@ -876,6 +893,10 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
             if (comp()->mayHaveLoops() && comp()->getOption(TR_NotCompileTimeSensitive))
                 doThisOptimization = true;
         } break;
+        case IfMethodProfile: {
+            if (comp()->getMethodProfile() != NULL)
+                doThisOptimization = true;
+        } break;
         case MarkLastRun:
             doThisOptimization = true;
             TR_ASSERT(optNum < OMR::numOpts, "No current support for marking groups as last (optNum=%d,numOpt=%d\n",
@@ -891,7 +912,6 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
         doThisOptimization = false;
 
     int32_t actualCost = 0;
-    static int32_t optDepth = 1;
 
     TR_FrontEnd *fe = comp()->fe();
 
@@ -901,10 +921,10 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
     if (optNum > OMR::numOpts && doThisOptimization && isEnabled(optNum)) {
         if (comp()->getOption(TR_TraceOptDetails) || comp()->getOption(TR_TraceOpts)) {
             if (comp()->isOutermostMethod())
-                log->printf("%*s<optgroup name=%s>\n", optDepth * 3, " ", manager->name());
+                log->printf("%*s<optgroup name=%s>\n", _optDepth * 3, " ", manager->name());
         }
 
-        optDepth++;
+        _optDepth++;
 
         // Find the subgroup. It is either referenced directly from this
         // optimization or picked up from the table of groups using the
@@ -951,11 +971,11 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
                 break;
         }
 
-        optDepth--;
+        _optDepth--;
 
         if (comp()->getOption(TR_TraceOptDetails) || comp()->getOption(TR_TraceOpts)) {
             if (comp()->isOutermostMethod())
-                log->printf("%*s</optgroup>\n", optDepth * 3, " ");
+                log->printf("%*s</optgroup>\n", _optDepth * 3, " ");
         }
 
         return actualCost;
@@ -1013,7 +1033,7 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
 
         if (comp()->getOption(TR_TraceOpts)) {
             if (comp()->isOutermostMethod())
-                log->printf("%*s%s\n", optDepth * 3, " ", manager->name());
+                log->printf("%*s%s\n", _optDepth * 3, " ", manager->name());
         }
 
         if (!_aliasSetsAreValid && !manager->getDoesNotRequireAliasSets()) {
@@ -140,6 +140,7 @@ enum {
     IfLoopsAndNotCompileTimeSensitive, // If loops and compile time is not that important
     IfKnownIdiomRecognitionOpportunity,
     IfNotKnownIdiomRecognitionOpportunity,
+    IfMethodProfile, // If a profile collected by an earlier body of the method is available
     MarkLastRun
 };
 
@@ -415,6 +416,7 @@ private:
     int32_t _firstDumpOptPhaseTrees;
     int32_t _lastDumpOptPhaseTrees;
     int32_t _optMessageIndex;
+    int32_t _optDepth; ///< nesting depth of optimization groups, for indenting traces
 
     bool _aliasSetsAreValid;
     bool _cantBuildGlobalsUseDefInfo;
@@ -26,6 +26,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "AtomicSupport.hpp"
 #include "env/FrontEnd.hpp"
 #include "compile/Compilation.hpp"
 #include "control/Options.hpp"
@@ -59,11 +60,10 @@
 
 #define OPT_DETAILS "O^O ORDER BLOCKS: "
 
-// statistics collectors
-static unsigned numberOfReorderings = 0;
-static unsigned numberOfCompiles = 0;
-static unsigned numberMethodReplicationCandidates = 0;
-static unsigned numberReplicationCandidates = 0;
+// statistics collectors, updated atomically because methods can be compiled concurrently
+static volatile uint32_t numberOfReorderings = 0;
+static volatile uint32_t numberOfCompiles = 0;
+static volatile uint32_t numberReplicationCandidates = 0;
 static unsigned numberHazardCandidates = 0;
 
 void printReorderingStatistics(void)
@@ -748,7 +748,7 @@ TR::CFGNode *TR_OrderBlocks::chooseBestFallThroughSuccessor(TR::CFG *cfg, TR::CF
                 logprintf(trace(), log, "\t\tbut it has another predecessor %d for which it is the hottest successor\n",
                     pred->getNumber());
                 logprints(trace(), log, "\t\tcounting this block as a candidate for replication\n");
-                numberMethodReplicationCandidates++;
+                _numReplicationCandidates++;
             }
         }
     }
@@ -1721,7 +1721,7 @@ void TR_BlockOrderingOptimization::connectTreesAccordingToOrder(TR_BlockList &ne
         numberOfBlocks++;
 
         if (fallThroughTT != block->getEntry()) {
-            numberOfReorderings++;
+            VM_AtomicSupport::addU32(&numberOfReorderings, 1);
 
             // if prevBlock is exit, or prevBlock was originally the last block, then there's no special work to do
             // also, if there is no flow edge from prevBlock to the original fall through block, nothing to worry about
@@ -1816,9 +1816,9 @@ void TR_BlockOrderingOptimization::connectTreesAccordingToOrder(TR_BlockList &ne
 
     static char *reorderingStats = feGetEnv("TR_reorderingStats");
     if (reorderingStats)
-        fprintf(stderr, "%d replication candidates in method %s (has %d blocks)\n", numberMethodReplicationCandidates,
+        fprintf(stderr, "%d replication candidates in method %s (has %d blocks)\n", _numReplicationCandidates,
             comp()->signature(), numberOfBlocks);
-    numberReplicationCandidates += numberMethodReplicationCandidates;
+    VM_AtomicSupport::addU32(&numberReplicationCandidates, _numReplicationCandidates);
 }
 
 bool TR_OrderBlocks::doBlockExtension()
@@ -1926,8 +1926,8 @@ bool TR_OrderBlocks::shouldPerform()
 
 int32_t TR_OrderBlocks::perform()
 {
-    numberOfCompiles++;
-    numberMethodReplicationCandidates = 0;
+    VM_AtomicSupport::addU32(&numberOfCompiles, 1);
+    _numReplicationCandidates = 0;
 
     TR::StackMemoryRegion stackMemoryRegion(*trMemory());
 
@@ -52,11 +52,14 @@ public:
 protected:
     TR_BlockOrderingOptimization(TR::OptimizationManager *manager)
         : TR::Optimization(manager)
+        , _numReplicationCandidates(0)
     {}
 
     void connectTreesAccordingToOrder(TR_BlockList &newBlockOrder);
     TR::Block *insertGotoFallThroughBlock(TR::TreeTop *fallThroughTT, TR::Node *node, TR::CFGNode *prevBlock,
         TR::CFGNode *origSucc, TR_RegionStructure *parent = NULL);
+
+    uint32_t _numReplicationCandidates; ///< blocks of this method that are candidates for replication
 };
 
 /*
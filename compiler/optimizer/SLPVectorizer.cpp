@@ -0,0 +1,928 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/SLPVectorizer.hpp"
+
+#include <algorithm>
+#include <limits.h>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "il/Block.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "ras/Logger.hpp"
+
+// Keeps the constants and coefficients of linear forms small enough that sums of them cannot overflow
+#define LINEAR_FORM_LIMIT ((int64_t)1 << 31)
+
+TR::SLPVectorizer::SLPVectorizer(TR::OptimizationManager *manager)
+    : TR::Optimization(manager)
+{}
+
+int32_t TR::SLPVectorizer::perform()
+{
+    if (comp()->getOption(TR_DisableAutoSIMD)) {
+        return 0;
+    }
+
+    TR::VectorLength preferred = cg()->getMaxPreferredVectorLength();
+    if (preferred == TR::NoVectorLength || preferred == TR::VectorLength64) {
+        return 0;
+    }
+
+    int32_t numGroups = 0;
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt != NULL;) {
+        TR::Block *block = tt->getNode()->getBlock();
+        tt = block->getExit()->getNextTreeTop();
+        if (block->isCold()) {
+            continue;
+        }
+
+        // Every group replaces at least two stores, so this terminates
+        while (vectorizeBlock(block)) {
+            numGroups++;
+        }
+    }
+
+    if (numGroups == 0) {
+        return 0;
+    }
+
+    optimizer()->setAliasSetsAreValid(false);
+    requestOpt(OMR::deadTreesElimination);
+    return numGroups;
+}
+
+const char *TR::SLPVectorizer::optDetailString() const throw() { return "O^O SLP VECTORIZER: "; }
+
+/**
+ * Vectorize the first group of adjacent stores in the block that can be vectorized profitably.
+ */
+bool TR::SLPVectorizer::vectorizeBlock(TR::Block *block)
+{
+    static const TR::VectorLength lengths[] = { TR::VectorLength512, TR::VectorLength256, TR::VectorLength128 };
+
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+
+    BlockInfo info(stackRegion);
+    analyzeTrees(block, info);
+
+    TR::vector<StoreCandidate, TR::Region &> candidates(stackRegion);
+    for (int32_t i = 0; i < (int32_t)info._trees.size(); i++) {
+        TR::Node *node = info._trees[i]->getNode();
+        if (!node->getOpCode().isStoreIndirect() || node->getOpCode().isWrtBar() || node->getNumChildren() != 2
+            || !node->getDataType().isVectorElement()) {
+            continue;
+        }
+
+        TR::SymbolReference *symRef = node->getSymbolReference();
+        StoreCandidate candidate;
+        if (symRef->isUnresolved() || symRef->getSymbol()->isVolatile()
+            || !getAddressForm(info, node, candidate._address)) {
+            continue;
+        }
+
+        candidate._store = node;
+        candidate._treeIndex = i;
+        candidates.push_back(candidate);
+    }
+
+    if (candidates.size() < 2) {
+        return false;
+    }
+
+    TR::vector<StoreCandidate, TR::Region &> sorted(candidates.begin(), candidates.end(), stackRegion);
+    std::sort(sorted.begin(), sorted.end(), candidateLessThan);
+
+    TR::VectorLength preferred = cg()->getMaxPreferredVectorLength();
+    TR::vector<TR::Node *, TR::Region &> stores(stackRegion);
+
+    // Try each store as the first lane of a group in tree order, preferring the widest vectors
+    for (auto first = candidates.begin(); first != candidates.end(); ++first) {
+        TR::DataType elementType = first->_store->getDataType();
+        int64_t elementSize = TR::DataType::getSize(elementType);
+
+        for (int32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+            if (lengths[l] > preferred) {
+                continue;
+            }
+
+            TR::DataType vectorType = TR::DataType::createVectorType(elementType, lengths[l]);
+            int32_t numLanes = vectorType.getVectorNumLanes();
+            if (numLanes < 2 || numLanes > 64 || numLanes > (int32_t)candidates.size()
+                || !isSupported(TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType))) {
+                continue;
+            }
+
+            stores.clear();
+            stores.push_back(first->_store);
+            StoreCandidate key = *first;
+            for (int32_t lane = 1; lane < numLanes; lane++) {
+                key._address._constant = first->_address._constant + lane * elementSize;
+                key._treeIndex = -1;
+                auto found = std::lower_bound(sorted.begin(), sorted.end(), key, candidateLessThan);
+                if (found == sorted.end() || found->_store->getDataType() != elementType
+                    || !sameTerms(found->_address, key._address)
+                    || found->_address._constant != key._address._constant) {
+                    break;
+                }
+
+                stores.push_back(found->_store);
+            }
+
+            if ((int32_t)stores.size() == numLanes && vectorizeGroup(block, info, stores, lengths[l])) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool TR::SLPVectorizer::candidateLessThan(const StoreCandidate &candidate1, const StoreCandidate &candidate2)
+{
+    TR::DataTypes type1 = candidate1._store->getDataType().getDataType();
+    TR::DataTypes type2 = candidate2._store->getDataType().getDataType();
+    if (type1 != type2) {
+        return type1 < type2;
+    }
+
+    const LinearForm &form1 = candidate1._address;
+    const LinearForm &form2 = candidate2._address;
+    if (form1._numTerms != form2._numTerms) {
+        return form1._numTerms < form2._numTerms;
+    }
+
+    for (int32_t i = 0; i < form1._numTerms; i++) {
+        const Term &term1 = form1._terms[i];
+        const Term &term2 = form2._terms[i];
+        if (term1._key != term2._key) {
+            return (uintptr_t)term1._key < (uintptr_t)term2._key;
+        }
+
+        if (term1._version != term2._version) {
+            return term1._version < term2._version;
+        }
+
+        if (term1._coefficient != term2._coefficient) {
+            return term1._coefficient < term2._coefficient;
+        }
+    }
+
+    if (form1._constant != form2._constant) {
+        return form1._constant < form2._constant;
+    }
+
+    return candidate1._treeIndex < candidate2._treeIndex;
+}
+
+/**
+ * Record where each node of the block is first evaluated and the linear form of every integer and
+ * address node, following the values stored to locals so that the copies of an unrolled loop body
+ * that each increment the induction variable still address adjacent elements.
+ */
+void TR::SLPVectorizer::analyzeTrees(TR::Block *block, BlockInfo &info)
+{
+    vcount_t visitCount = comp()->incVisitCount();
+    info._nextVersion = 1;
+    info._defaultVersion = 0;
+
+    int32_t treeIndex = 0;
+    for (TR::TreeTop *tt = block->getEntry()->getNextTreeTop(); tt != block->getExit();
+         tt = tt->getNextTreeTop(), treeIndex++) {
+        TR::Node *node = tt->getNode();
+        info._trees.push_back(tt);
+        analyzeNode(node, treeIndex, info, visitCount);
+
+        if (node->getOpCode().isStoreDirect() && node->getSymbolReference()->getSymbol()->isAutoOrParm()) {
+            LinearForm form;
+            if (!node->getDataType().isIntegral() || !getLinearForm(info, node->getFirstChild(), form)) {
+                setLeaf(form, node->getSymbolReference(), info._nextVersion++);
+            }
+
+            info._localValues[node->getSymbolReference()] = form;
+        } else if (node->getOpCode().isCall()
+            || (node->getNumChildren() > 0 && node->getFirstChild()->getOpCode().isCall())) {
+            // The callee may change locals whose address has been taken
+            info._localValues.clear();
+            info._defaultVersion = info._nextVersion++;
+        }
+    }
+}
+
+void TR::SLPVectorizer::analyzeNode(TR::Node *node, int32_t treeIndex, BlockInfo &info, vcount_t visitCount)
+{
+    if (node->getVisitCount() == visitCount) {
+        return;
+    }
+
+    node->setVisitCount(visitCount);
+    for (int32_t i = 0; i < node->getNumChildren(); i++) {
+        analyzeNode(node->getChild(i), treeIndex, info, visitCount);
+    }
+
+    info._firstTree[node] = treeIndex;
+    // Loads of locals of other types get a form too, so that loads of the same value can be recognized
+    if (!node->getOpCode().isStore() && !node->getOpCode().isTreeTop()
+        && (node->getDataType().isIntegral() || node->getDataType() == TR::Address
+            || node->getOpCode().isLoadVarDirect())) {
+        computeLinearForm(info, node);
+    }
+}
+
+int32_t TR::SLPVectorizer::getTreeIndex(BlockInfo &info, TR::Node *node)
+{
+    auto found = info._firstTree.find(node);
+    return found != info._firstTree.end() ? found->second : -1;
+}
+
+void TR::SLPVectorizer::setLeaf(LinearForm &form, void *key, int32_t version)
+{
+    form._numTerms = 1;
+    form._terms[0]._key = key;
+    form._terms[0]._version = version;
+    form._terms[0]._coefficient = 1;
+    form._constant = 0;
+}
+
+/**
+ * result = form1 + scale2 * form2, with the terms kept sorted so that equal forms have equal terms.
+ */
+bool TR::SLPVectorizer::addForms(LinearForm &result, const LinearForm &form1, const LinearForm &form2,
+    int64_t scale2)
+{
+    LinearForm sum;
+    sum._numTerms = 0;
+    sum._constant = form1._constant + scale2 * form2._constant;
+
+    int32_t i1 = 0, i2 = 0;
+    while (i1 < form1._numTerms || i2 < form2._numTerms) {
+        Term term;
+        bool take1 = i2 == form2._numTerms;
+        bool take2 = i1 == form1._numTerms;
+        if (!take1 && !take2) {
+            const Term &term1 = form1._terms[i1];
+            const Term &term2 = form2._terms[i2];
+            if (term1._key == term2._key && term1._version == term2._version) {
+                take1 = take2 = true;
+            } else if ((uintptr_t)term1._key < (uintptr_t)term2._key
+                || (term1._key == term2._key && term1._version < term2._version)) {
+                take1 = true;
+            } else {
+                take2 = true;
+            }
+        }
+
+        term = take1 ? form1._terms[i1] : form2._terms[i2];
+        term._coefficient = (take1 ? form1._terms[i1]._coefficient : 0)
+            + (take2 ? scale2 * form2._terms[i2]._coefficient : 0);
+        i1 += take1 ? 1 : 0;
+        i2 += take2 ? 1 : 0;
+
+        if (term._coefficient == 0) {
+            continue;
+        }
+
+        if (sum._numTerms == MaxTerms || term._coefficient <= -LINEAR_FORM_LIMIT
+            || term._coefficient >= LINEAR_FORM_LIMIT) {
+            return false;
+        }
+
+        sum._terms[sum._numTerms++] = term;
+    }
+
+    if (sum._constant <= -LINEAR_FORM_LIMIT || sum._constant >= LINEAR_FORM_LIMIT) {
+        return false;
+    }
+
+    result = sum;
+    return true;
+}
+
+bool TR::SLPVectorizer::scaleForm(LinearForm &form, int64_t scale)
+{
+    LinearForm zero;
+    zero._numTerms = 0;
+    zero._constant = 0;
+    return addForms(form, zero, form, scale);
+}
+
+bool TR::SLPVectorizer::sameTerms(const LinearForm &form1, const LinearForm &form2)
+{
+    if (form1._numTerms != form2._numTerms) {
+        return false;
+    }
+
+    for (int32_t i = 0; i < form1._numTerms; i++) {
+        if (form1._terms[i]._key != form2._terms[i]._key || form1._terms[i]._version != form2._terms[i]._version
+            || form1._terms[i]._coefficient != form2._terms[i]._coefficient) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool TR::SLPVectorizer::getLinearForm(BlockInfo &info, TR::Node *node, LinearForm &form)
+{
+    auto found = info._forms.find(node);
+    if (found == info._forms.end()) {
+        return false;
+    }
+
+    form = found->second;
+    return true;
+}
+
+/**
+ * Overflow of the integer operations is ignored, as it is by the loop vectorizer, since array
+ * addresses computed from overflowing indices are not valid anyway.
+ */
+void TR::SLPVectorizer::computeLinearForm(BlockInfo &info, TR::Node *node)
+{
+    TR::ILOpCode &op = node->getOpCode();
+    LinearForm form, form1, form2;
+    bool known = false;
+
+    switch (node->getOpCodeValue()) {
+        case TR::bconst:
+        case TR::sconst:
+        case TR::iconst:
+        case TR::lconst:
+            form._numTerms = 0;
+            form._constant = node->get64bitIntegralValue();
+            known = form._constant > -LINEAR_FORM_LIMIT && form._constant < LINEAR_FORM_LIMIT;
+            break;
+        case TR::loadaddr:
+            setLeaf(form, node->getSymbolReference(), -1);
+            known = true;
+            break;
+        case TR::i2l:
+            known = getLinearForm(info, node->getFirstChild(), form);
+            break;
+        case TR::iadd:
+        case TR::ladd:
+        case TR::aiadd:
+        case TR::aladd:
+            known = getLinearForm(info, node->getFirstChild(), form1) && getLinearForm(info, node->getSecondChild(), form2)
+                && addForms(form, form1, form2, 1);
+            break;
+        case TR::isub:
+        case TR::lsub:
+            known = getLinearForm(info, node->getFirstChild(), form1) && getLinearForm(info, node->getSecondChild(), form2)
+                && addForms(form, form1, form2, -1);
+            break;
+        case TR::imul:
+        case TR::lmul:
+            if (getLinearForm(info, node->getFirstChild(), form1) && getLinearForm(info, node->getSecondChild(), form2)) {
+                if (form2._numTerms == 0) {
+                    form = form1;
+                    known = scaleForm(form, form2._constant);
+                } else if (form1._numTerms == 0) {
+                    form = form2;
+                    known = scaleForm(form, form1._constant);
+                }
+            }
+            break;
+        case TR::ishl:
+        case TR::lshl:
+            if (node->getSecondChild()->getOpCode().isLoadConst() && node->getSecondChild()->getInt() >= 0
+                && node->getSecondChild()->getInt() <= 31 && getLinearForm(info, node->getFirstChild(), form)) {
+                known = scaleForm(form, (int64_t)1 << node->getSecondChild()->getInt());
+            }
+            break;
+        default:
+            if (op.isLoadVarDirect() && node->getSymbolReference()->getSymbol()->isAutoOrParm()
+                && !node->getSymbolReference()->getSymbol()->isVolatile()) {
+                TR::SymbolReference *symRef = node->getSymbolReference();
+                auto value = info._localValues.find(symRef);
+                if (value != info._localValues.end()) {
+                    form = value->second;
+                } else {
+                    setLeaf(form, symRef, info._defaultVersion);
+                }
+
+                known = true;
+            }
+            break;
+    }
+
+    if (!known) {
+        setLeaf(form, node, 0);
+    }
+
+    info._forms[node] = form;
+}
+
+bool TR::SLPVectorizer::getAddressForm(BlockInfo &info, TR::Node *node, LinearForm &form)
+{
+    LinearForm offset;
+    offset._numTerms = 0;
+    offset._constant = node->getSymbolReference()->getOffset();
+    return getLinearForm(info, node->getFirstChild(), form) && addForms(form, form, offset, 1);
+}
+
+bool TR::SLPVectorizer::isSupported(TR::ILOpCodes op)
+{
+    return op != TR::BadILOp && cg()->getSupportsOpCodeForAutoSIMD(op);
+}
+
+static bool isVectorizableOperation(TR::ILOpCode &op)
+{
+    if (op.isAdd() || op.isSub() || op.isMul() || op.isNeg()) {
+        return true;
+    }
+
+    if (op.isFloatingPoint()) {
+        return op.isDiv();
+    }
+
+    return op.isAnd() || op.isOr() || op.isXor();
+}
+
+/**
+ * Whether two nodes are known to have the same value: they are the same node, equal constants or
+ * loads of a local that has not been stored to in between.
+ */
+bool TR::SLPVectorizer::isSameValue(BlockInfo &info, TR::Node *node1, TR::Node *node2)
+{
+    if (node1 == node2) {
+        return true;
+    }
+
+    if (node1->getOpCodeValue() != node2->getOpCodeValue()) {
+        return false;
+    }
+
+    LinearForm form1, form2;
+    if (node1->getOpCode().isLoadVarDirect()) {
+        return getLinearForm(info, node1, form1) && getLinearForm(info, node2, form2) && sameTerms(form1, form2)
+            && form1._constant == form2._constant;
+    }
+
+    if (!node1->getOpCode().isLoadConst()) {
+        return false;
+    }
+
+    switch (node1->getDataType().getDataType()) {
+        case TR::Float:
+            return node1->getFloatBits() == node2->getFloatBits();
+        case TR::Double:
+            return node1->getDoubleBits() == node2->getDoubleBits();
+        default:
+            return node1->get64bitIntegralValue() == node2->get64bitIntegralValue();
+    }
+}
+
+/**
+ * Build the pack computing the given lanes as one vector, together with the packs of its operands.
+ */
+TR::SLPVectorizer::Pack *TR::SLPVectorizer::buildPack(BlockInfo &info, TR::vector<TR::Node *, TR::Region &> &lanes,
+    TR::VectorLength vectorLength)
+{
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+    TR::Node *first = lanes[0];
+    int32_t numLanes = (int32_t)lanes.size();
+
+    auto known = info._packs.find(first);
+    if (known != info._packs.end()) {
+        Pack *pack = known->second;
+        for (int32_t i = 0; i < numLanes; i++) {
+            if (pack->_lanes[i] != lanes[i]) {
+                return NULL;
+            }
+        }
+
+        return pack;
+    }
+
+    TR::DataType type = first->getDataType();
+    if (!type.isVectorElement()) {
+        return NULL;
+    }
+
+    TR::DataType vectorType = TR::DataType::createVectorType(type, vectorLength);
+    TR::ILOpCode &op = first->getOpCode();
+    bool sameValue = true;
+    bool sameOp = true;
+    for (int32_t i = 1; i < numLanes; i++) {
+        sameValue = sameValue && isSameValue(info, first, lanes[i]);
+        sameOp = sameOp && lanes[i]->getOpCodeValue() == first->getOpCodeValue()
+            && lanes[i]->getNumChildren() == first->getNumChildren();
+    }
+
+    Pack *pack = new (stackRegion) Pack(stackRegion);
+    pack->_lanes.assign(lanes.begin(), lanes.end());
+
+    if (op.isStoreIndirect()) {
+        // The stores have already been found to write adjacent elements
+        pack->_kind = StorePack;
+        TR::vector<TR::Node *, TR::Region &> values(stackRegion);
+        for (int32_t i = 0; i < numLanes; i++) {
+            values.push_back(lanes[i]->getSecondChild());
+        }
+
+        Pack *value = buildPack(info, values, vectorLength);
+        if (value == NULL) {
+            return NULL;
+        }
+
+        pack->_children.push_back(value);
+    } else if (sameValue) {
+        if (!isSupported(TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType))) {
+            return NULL;
+        }
+
+        pack->_kind = SplatPack;
+    } else if (!sameOp) {
+        return NULL;
+    } else if (op.isLoadIndirect()) {
+        if (!isSupported(TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType))) {
+            return NULL;
+        }
+
+        int64_t elementSize = TR::DataType::getSize(type);
+        LinearForm firstAddress, address;
+        if (!getAddressForm(info, first, firstAddress)) {
+            return NULL;
+        }
+
+        for (int32_t i = 0; i < numLanes; i++) {
+            TR::SymbolReference *symRef = lanes[i]->getSymbolReference();
+            if (symRef->isUnresolved() || symRef->getSymbol()->isVolatile() || !getAddressForm(info, lanes[i], address)
+                || !sameTerms(firstAddress, address) || address._constant != firstAddress._constant + i * elementSize) {
+                return NULL;
+            }
+        }
+
+        pack->_kind = LoadPack;
+    } else if (isVectorizableOperation(op)
+        && isSupported(TR::ILOpCode::convertScalarToVector(first->getOpCodeValue(), vectorLength))) {
+        pack->_kind = OperationPack;
+        TR::vector<TR::Node *, TR::Region &> operands(stackRegion);
+        for (int32_t c = 0; c < first->getNumChildren(); c++) {
+            operands.clear();
+            for (int32_t i = 0; i < numLanes; i++) {
+                operands.push_back(lanes[i]->getChild(c));
+            }
+
+            Pack *operand = buildPack(info, operands, vectorLength);
+            if (operand == NULL) {
+                return NULL;
+            }
+
+            pack->_children.push_back(operand);
+        }
+    } else {
+        return NULL;
+    }
+
+    info._packs[first] = pack;
+    return pack;
+}
+
+/**
+ * The number of scalar operations removed minus the number of vector operations added. A lane of an
+ * operand is only removed when it is not used by anything but the lane of a removed operation.
+ */
+int32_t TR::SLPVectorizer::estimateSavings(BlockInfo &info, Pack *pack, uint64_t removedParentLanes,
+    TR::map<Pack *, bool> &counted)
+{
+    int32_t savings = 0;
+    uint64_t removedLanes = 0;
+    if (pack->_kind != SplatPack) {
+        for (int32_t i = 0; i < (int32_t)pack->_lanes.size(); i++) {
+            if (pack->_kind == StorePack
+                || ((removedParentLanes & ((uint64_t)1 << i)) && pack->_lanes[i]->getReferenceCount() == 1)) {
+                removedLanes |= (uint64_t)1 << i;
+                savings++;
+            }
+        }
+    }
+
+    if (counted.find(pack) == counted.end()) {
+        counted[pack] = true;
+        savings--;
+    }
+
+    for (auto child = pack->_children.begin(); child != pack->_children.end(); ++child) {
+        savings += estimateSavings(info, *child, removedLanes, counted);
+    }
+
+    return savings;
+}
+
+void TR::SLPVectorizer::collectMemoryNodes(BlockInfo &info, Pack *pack, TR::vector<TR::Node *, TR::Region &> &loads,
+    TR::map<Pack *, bool> &visited)
+{
+    if (visited.find(pack) != visited.end()) {
+        return;
+    }
+
+    visited[pack] = true;
+    if (pack->_kind == LoadPack) {
+        loads.insert(loads.end(), pack->_lanes.begin(), pack->_lanes.end());
+    }
+
+    for (auto child = pack->_children.begin(); child != pack->_children.end(); ++child) {
+        collectMemoryNodes(info, *child, loads, visited);
+    }
+}
+
+/**
+ * The vector loads and the vector store are evaluated where the last store of the group was. That
+ * is only correct when no tree from the first load of the group onwards writes memory the loads
+ * read, and no tree after a store of the group reads or writes the memory it stores to. The trees
+ * in between must not be able to throw or call out either, as the stores would then be missing.
+ */
+bool TR::SLPVectorizer::isLegal(BlockInfo &info, Pack *storePack)
+{
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+    TR::vector<TR::Node *, TR::Region &> loads(stackRegion);
+    TR::map<Pack *, bool> visited(std::less<Pack *>(), stackRegion);
+    collectMemoryNodes(info, storePack, loads, visited);
+
+    int32_t firstTree = INT_MAX;
+    int32_t lastTree = -1;
+    for (auto store = storePack->_lanes.begin(); store != storePack->_lanes.end(); ++store) {
+        int32_t treeIndex = getTreeIndex(info, *store);
+        firstTree = std::min(firstTree, treeIndex);
+        lastTree = std::max(lastTree, treeIndex);
+    }
+
+    for (auto load = loads.begin(); load != loads.end(); ++load) {
+        firstTree = std::min(firstTree, getTreeIndex(info, *load));
+    }
+
+    for (int32_t treeIndex = firstTree; treeIndex <= lastTree; treeIndex++) {
+        if (!checkTree(info, info._trees[treeIndex]->getNode(), treeIndex, storePack, loads)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool TR::SLPVectorizer::checkTree(BlockInfo &info, TR::Node *node, int32_t treeIndex, Pack *storePack,
+    TR::vector<TR::Node *, TR::Region &> &loads)
+{
+    for (int32_t i = 0; i < node->getNumChildren(); i++) {
+        TR::Node *child = node->getChild(i);
+        if (getTreeIndex(info, child) == treeIndex && !checkTree(info, child, treeIndex, storePack, loads)) {
+            return false;
+        }
+    }
+
+    TR::ILOpCode &op = node->getOpCode();
+    if (op.isCall() || op.isCheck() || node->exceptionsRaised() || node->canCauseGC()) {
+        logprintf(trace(), comp()->log(), "Tree %d of the group has side effects at n%dn\n", treeIndex,
+            node->getGlobalIndex());
+        return false;
+    }
+
+    if (!op.hasSymbolReference() || op.isLoadAddr()) {
+        return true;
+    }
+
+    if (!op.isLoadVar() && !op.isStore()) {
+        logprintf(trace(), comp()->log(), "Tree %d of the group accesses memory at n%dn\n", treeIndex,
+            node->getGlobalIndex());
+        return false;
+    }
+
+    if (node->getSymbolReference()->getSymbol()->isVolatile()) {
+        return false;
+    }
+
+    bool isGroupStore = false;
+    for (auto store = storePack->_lanes.begin(); store != storePack->_lanes.end(); ++store) {
+        isGroupStore = isGroupStore || *store == node;
+    }
+
+    // A store of the group that came earlier now happens after this access
+    for (auto store = storePack->_lanes.begin(); store != storePack->_lanes.end(); ++store) {
+        if (*store != node && getTreeIndex(info, *store) < treeIndex && mayOverlap(info, *store, node)) {
+            logprintf(trace(), comp()->log(), "Store n%dn would move past n%dn\n", (*store)->getGlobalIndex(),
+                node->getGlobalIndex());
+            return false;
+        }
+    }
+
+    // The loads of the group now happen after this store
+    if (op.isStore() && !isGroupStore) {
+        for (auto load = loads.begin(); load != loads.end(); ++load) {
+            if (getTreeIndex(info, *load) <= treeIndex && mayOverlap(info, node, *load)) {
+                logprintf(trace(), comp()->log(), "Load n%dn would move past n%dn\n", (*load)->getGlobalIndex(),
+                    node->getGlobalIndex());
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool TR::SLPVectorizer::mayOverlap(BlockInfo &info, TR::Node *store, TR::Node *other)
+{
+    LinearForm storeAddress, otherAddress;
+    if (store->getOpCode().isIndirect() && other->getOpCode().isIndirect() && getAddressForm(info, store, storeAddress)
+        && getAddressForm(info, other, otherAddress) && sameTerms(storeAddress, otherAddress)) {
+        int64_t distance = otherAddress._constant - storeAddress._constant;
+        return distance < (int64_t)TR::DataType::getSize(store->getDataType())
+            && -distance < (int64_t)TR::DataType::getSize(other->getDataType());
+    }
+
+    if (store->getDataType().isVector() || other->getDataType().isVector()) {
+        return true;
+    }
+
+    TR::SymbolReference *otherSymRef = other->getSymbolReference();
+    return store->getSymbolReference() == otherSymRef || store->mayKill().contains(otherSymRef, comp());
+}
+
+/**
+ * Replace the stores of the group by one vector store after the last of them. Nodes that were
+ * first evaluated under the removed stores and are still used elsewhere, including the addresses
+ * and scalars reused by the vector trees, are anchored where the stores were.
+ */
+bool TR::SLPVectorizer::vectorizeGroup(TR::Block *block, BlockInfo &info, TR::vector<TR::Node *, TR::Region &> &stores,
+    TR::VectorLength vectorLength)
+{
+    TR::Region &stackRegion = trMemory()->currentStackRegion();
+    TR::Node *firstStore = stores.front();
+    int32_t numLanes = (int32_t)stores.size();
+
+    info._packs.clear();
+    Pack *storePack = buildPack(info, stores, vectorLength);
+    if (storePack == NULL) {
+        logprintf(trace(), comp()->log(), "%d stores starting at n%dn in block_%d cannot be packed\n", numLanes,
+            firstStore->getGlobalIndex(), block->getNumber());
+        return false;
+    }
+
+    TR::map<Pack *, bool> counted(std::less<Pack *>(), stackRegion);
+    int32_t savings = estimateSavings(info, storePack, 0, counted);
+    if (savings <= 0) {
+        logprintf(trace(), comp()->log(), "%d stores starting at n%dn in block_%d are not worth packing (%d)\n",
+            numLanes, firstStore->getGlobalIndex(), block->getNumber(), savings);
+        return false;
+    }
+
+    if (!isLegal(info, storePack)) {
+        return false;
+    }
+
+    if (!performTransformation(comp(), "%sPacking %d stores of %s starting at n%dn in block_%d, saving %d operations\n",
+            optDetailString(), numLanes, TR::DataType::getName(firstStore->getDataType()),
+            firstStore->getGlobalIndex(), block->getNumber(), savings)) {
+        return false;
+    }
+
+    if (trace()) {
+        tracePack(storePack, 1);
+    }
+
+    int32_t lastTree = -1;
+    for (auto store = stores.begin(); store != stores.end(); ++store) {
+        lastTree = std::max(lastTree, getTreeIndex(info, *store));
+    }
+
+    TR::Node *vectorStore = createVectorNode(storePack, vectorLength);
+    info._trees[lastTree]->insertAfter(TR::TreeTop::create(comp(), vectorStore));
+
+    vcount_t visitCount = comp()->incVisitCount();
+    for (int32_t treeIndex = 0; treeIndex <= lastTree; treeIndex++) {
+        TR::TreeTop *tree = info._trees[treeIndex];
+        if (std::find(stores.begin(), stores.end(), tree->getNode()) != stores.end()) {
+            anchorSharedNodes(info, tree, tree->getNode(), treeIndex, visitCount);
+            tree->unlink(true);
+        }
+    }
+
+    return true;
+}
+
+TR::Node *TR::SLPVectorizer::createVectorNode(Pack *pack, TR::VectorLength vectorLength)
+{
+    if (pack->_vectorNode != NULL) {
+        return pack->_vectorNode;
+    }
+
+    TR::Node *first = pack->_lanes[0];
+    TR::DataType vectorType = TR::DataType::createVectorType(first->getDataType(), vectorLength);
+    TR::Node *result;
+    switch (pack->_kind) {
+        case StorePack: {
+            TR::Node *address = createAddress(first);
+            TR::Node *value = createVectorNode(pack->_children[0], vectorLength);
+            TR::SymbolReference *symRef = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, address);
+            result = TR::Node::createWithSymRef(TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType), 2, 2,
+                address, value, symRef);
+            break;
+        }
+        case LoadPack: {
+            TR::Node *address = createAddress(first);
+            TR::SymbolReference *symRef = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, address);
+            result = TR::Node::createWithSymRef(first, TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType), 1,
+                address, symRef);
+            break;
+        }
+        case SplatPack:
+            result = TR::Node::create(first, TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType), 1, first);
+            break;
+        default:
+            result = TR::Node::create(first, TR::ILOpCode::convertScalarToVector(first->getOpCodeValue(), vectorLength),
+                first->getNumChildren());
+            for (int32_t i = 0; i < first->getNumChildren(); i++) {
+                result->setAndIncChild(i, createVectorNode(pack->_children[i], vectorLength));
+            }
+            break;
+    }
+
+    pack->_vectorNode = result;
+    return result;
+}
+
+/**
+ * The address of the first lane of a load or store, including the offset of its symbol reference
+ * since the vector access goes through an array shadow.
+ */
+TR::Node *TR::SLPVectorizer::createAddress(TR::Node *access)
+{
+    TR::Node *address = access->getFirstChild();
+    int32_t offset = access->getSymbolReference()->getOffset();
+    if (offset == 0) {
+        return address;
+    }
+
+    if (comp()->target().is64Bit()) {
+        return TR::Node::create(access, TR::aladd, 2, address, TR::Node::lconst(access, offset));
+    }
+
+    return TR::Node::create(access, TR::aiadd, 2, address, TR::Node::iconst(access, offset));
+}
+
+void TR::SLPVectorizer::anchorSharedNodes(BlockInfo &info, TR::TreeTop *tree, TR::Node *node, int32_t treeIndex,
+    vcount_t visitCount)
+{
+    for (int32_t i = 0; i < node->getNumChildren(); i++) {
+        TR::Node *child = node->getChild(i);
+        if (child->getVisitCount() == visitCount || getTreeIndex(info, child) != treeIndex) {
+            continue;
+        }
+
+        child->setVisitCount(visitCount);
+        if (child->getReferenceCount() > 1) {
+            TR::TreeTop::create(comp(), tree->getPrevTreeTop(), TR::Node::create(child, TR::treetop, 1, child));
+        } else {
+            anchorSharedNodes(info, tree, child, treeIndex, visitCount);
+        }
+    }
+}
+
+void TR::SLPVectorizer::tracePack(Pack *pack, int32_t depth)
+{
+    static const char *kindNames[] = { "store", "load", "splat", "operation" };
+
+    OMR::Logger *log = comp()->log();
+    TR::Node *first = pack->_lanes[0];
+    log->printf("%*s%s pack of %s", depth * 3, "", kindNames[pack->_kind], first->getOpCode().getName());
+    for (auto lane = pack->_lanes.begin(); lane != pack->_lanes.end(); ++lane) {
+        log->printf(" n%dn", (*lane)->getGlobalIndex());
+    }
+    log->prints("\n");
+
+    for (auto child = pack->_children.begin(); child != pack->_children.end(); ++child) {
+        tracePack(*child, depth + 1);
+    }
+}
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef SLPVECTORIZER_INCL
+#define SLPVECTORIZER_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "infra/map.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR {
+class Block;
+class Node;
+class SymbolReference;
+class TreeTop;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * Superword level parallelism.
+ *
+ * Looks for indirect stores within a basic block that write adjacent elements of the same type,
+ * such as the copies of a loop body left behind by unrolling,
+ *
+ *    a[i] = b[i] * c[i]; a[i + 1] = b[i + 1] * c[i + 1]; ...
+ *
+ * and replaces each group of them by a single vector store whose value is computed by vector
+ * operations. The lanes of every operand must either load adjacent elements, be the same scalar
+ * value, or apply the same operation to operands that can be vectorized in turn.
+ *
+ * A group is only rewritten when the code generator supports all of the vector opcodes for
+ * auto-SIMD, when fewer operations are left afterwards, and when moving the loads and stores of
+ * the group to the last of its stores cannot change what any of them read or write.
+ */
+class SLPVectorizer : public TR::Optimization {
+public:
+    SLPVectorizer(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) SLPVectorizer(manager);
+    }
+
+    virtual int32_t perform();
+    virtual const char *optDetailString() const throw();
+
+private:
+    enum { MaxTerms = 4 };
+
+    /**
+     * A variable part of an integer or address expression. The key is either the symbol reference
+     * of a local together with the number of stores to it that could not be followed, or a node
+     * whose value is not understood.
+     */
+    struct Term {
+        void *_key;
+        int32_t _version;
+        int64_t _coefficient;
+    };
+
+    /**
+     * An integer or address expression written as a sum of terms plus a constant, so that two
+     * addresses with the same terms differ by a known number of bytes.
+     */
+    struct LinearForm {
+        int32_t _numTerms;
+        Term _terms[MaxTerms];
+        int64_t _constant;
+    };
+
+    enum PackKind {
+        StorePack,
+        LoadPack,
+        SplatPack,
+        OperationPack
+    };
+
+    /**
+     * Scalar nodes of one type, one per lane, that are computed together as one vector node.
+     */
+    struct Pack {
+        Pack(TR::Region &region)
+            : _lanes(region)
+            , _children(region)
+            , _vectorNode(NULL)
+        {}
+
+        PackKind _kind;
+        TR::vector<TR::Node *, TR::Region &> _lanes;
+        TR::vector<Pack *, TR::Region &> _children;
+        TR::Node *_vectorNode;
+    };
+
+    /**
+     * The state of the block whose trees are being examined.
+     */
+    struct StoreCandidate {
+        TR::Node *_store;
+        LinearForm _address;
+        int32_t _treeIndex;
+    };
+
+    struct BlockInfo {
+        BlockInfo(TR::Region &region)
+            : _trees(region)
+            , _firstTree(std::less<TR::Node *>(), region)
+            , _forms(std::less<TR::Node *>(), region)
+            , _localValues(std::less<TR::SymbolReference *>(), region)
+            , _packs(std::less<TR::Node *>(), region)
+        {}
+
+        TR::vector<TR::TreeTop *, TR::Region &> _trees;
+        TR::map<TR::Node *, int32_t> _firstTree; ///< index of the tree where each node is first evaluated
+        TR::map<TR::Node *, LinearForm> _forms;
+        TR::map<TR::SymbolReference *, LinearForm> _localValues; ///< current value of each local stored to
+        TR::map<TR::Node *, Pack *> _packs; ///< packs of the current group keyed by their first lane
+        int32_t _nextVersion;
+        int32_t _defaultVersion; ///< version of the locals not stored to since the last call
+    };
+
+    bool vectorizeBlock(TR::Block *block);
+    void analyzeTrees(TR::Block *block, BlockInfo &info);
+    void analyzeNode(TR::Node *node, int32_t treeIndex, BlockInfo &info, vcount_t visitCount);
+    bool vectorizeGroup(TR::Block *block, BlockInfo &info, TR::vector<TR::Node *, TR::Region &> &stores,
+        TR::VectorLength vectorLength);
+    static bool candidateLessThan(const StoreCandidate &candidate1, const StoreCandidate &candidate2);
+
+    bool getLinearForm(BlockInfo &info, TR::Node *node, LinearForm &form);
+    void computeLinearForm(BlockInfo &info, TR::Node *node);
+    bool getAddressForm(BlockInfo &info, TR::Node *node, LinearForm &form);
+    int32_t getTreeIndex(BlockInfo &info, TR::Node *node);
+    static void setLeaf(LinearForm &form, void *key, int32_t version);
+    static bool addForms(LinearForm &result, const LinearForm &form1, const LinearForm &form2, int64_t scale2);
+    static bool scaleForm(LinearForm &form, int64_t scale);
+    static bool sameTerms(const LinearForm &form1, const LinearForm &form2);
+
+    Pack *buildPack(BlockInfo &info, TR::vector<TR::Node *, TR::Region &> &lanes, TR::VectorLength vectorLength);
+    bool isSameValue(BlockInfo &info, TR::Node *node1, TR::Node *node2);
+    bool isSupported(TR::ILOpCodes op);
+    int32_t estimateSavings(BlockInfo &info, Pack *pack, uint64_t removedParentLanes,
+        TR::map<Pack *, bool> &counted);
+    void collectMemoryNodes(BlockInfo &info, Pack *pack, TR::vector<TR::Node *, TR::Region &> &loads,
+        TR::map<Pack *, bool> &visited);
+    bool isLegal(BlockInfo &info, Pack *storePack);
+    bool checkTree(BlockInfo &info, TR::Node *node, int32_t treeIndex, Pack *storePack,
+        TR::vector<TR::Node *, TR::Region &> &loads);
+    bool mayOverlap(BlockInfo &info, TR::Node *store, TR::Node *other);
+
+    TR::Node *createVectorNode(Pack *pack, TR::VectorLength vectorLength);
+    TR::Node *createAddress(TR::Node *access);
+    void anchorSharedNodes(BlockInfo &info, TR::TreeTop *tree, TR::Node *node, int32_t treeIndex,
+        vcount_t visitCount);
+    void tracePack(Pack *pack, int32_t depth);
+};
+
+} // namespace TR
+
+#endif // SLPVECTORIZER_INCL
@@ -872,6 +872,9 @@ void OMR::CodeCacheManager::repositoryCodeCacheCreated()
 void OMR::CodeCacheManager::registerCompiledMethod(const char *sig, uint8_t *startPC, uint32_t codeSize)
 {
 #if (HOST_OS == OMR_LINUX)
+    // Compilation threads register their methods concurrently
+    CacheListCriticalSection updateSymbols(self());
+
 
     TR::CodeCacheSymbol *newSymbol = static_cast<TR::CodeCacheSymbol *>(self()->getMemory(sizeof(TR::CodeCacheSymbol)));
     uint32_t nameLength = strlen(sig) + 1;
@@ -914,6 +917,8 @@ void OMR::CodeCacheManager::registerStaticRelocation(const TR::StaticRelocation
 {
 #if (HOST_OS == OMR_LINUX)
     if (_elfRelocatableGenerator) {
+        CacheListCriticalSection updateSymbols(self());
+
         const char * const symbolName(relocation.symbol());
         uint32_t nameLength = strlen(symbolName) + 1;
         char *name = static_cast<char *>(self()->getMemory(nameLength * sizeof(char)));
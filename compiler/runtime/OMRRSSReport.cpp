@@ -19,6 +19,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 #include "compiler/infra/String.hpp"
+#include "env/CompilerEnv.hpp"
 #include "runtime/OMRRSSReport.hpp"
 
 OMR::RSSReport *OMR::RSSReport::_instance = NULL;
@@ -363,4 +364,21 @@ void OMR::RSSReport::printRegions()
 
     TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "RSS Region rss/size:    %s  all %u regions %5zu/%5zu(%3.0f%%) KB",
         rssLine, regionNum, totalRSSKb, totalKb, (float)totalRSSKb * 100.0 / totalKb);
+
+    printPersistentAllocatorStatistics();
+}
+
+void OMR::RSSReport::printPersistentAllocatorStatistics()
+{
+    TR::PersistentAllocator::Statistics stats;
+    TR::Compiler->persistentAllocator().getStatistics(stats);
+
+    size_t heldBytes = stats.segmentBytes + stats.largeBlockBytes;
+    size_t freeBytes = stats.freeBlockBytes + stats.unusedSegmentBytes;
+    TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+        "RSS persistent allocator: held=%zu KB small in use=%zu KB large in use=%zu KB free blocks=%zu KB unused "
+        "segment=%zu KB free=%3.0f%% thread caches=%zu",
+        heldBytes / 1024, stats.smallBlockBytes / 1024, stats.largeBlockBytes / 1024, stats.freeBlockBytes / 1024,
+        stats.unusedSegmentBytes / 1024, heldBytes ? (float)freeBytes * 100.0 / heldBytes : 0.0,
+        stats.numThreadCaches);
 }
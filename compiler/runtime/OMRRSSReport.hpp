@@ -243,6 +243,12 @@ public:
      */
     void printRegions();
 
+    /**
+     * \brief
+     *        Prints how much memory the persistent allocator holds and how much of it is free
+     */
+    void printPersistentAllocatorStatistics();
+
     /**
      * \brief
      *        Adds RSSRegion to the list
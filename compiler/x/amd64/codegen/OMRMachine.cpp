@@ -27,7 +27,7 @@
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 
-bool OMR::X86::AMD64::Machine::_disableNewPickRegister, OMR::X86::AMD64::Machine::_dnprIsInitialized = false;
+bool OMR::X86::AMD64::Machine::_disableNewPickRegister = false;
 
 OMR::X86::AMD64::Machine::Machine(TR::CodeGenerator *cg)
     : OMR::X86::Machine(cg)
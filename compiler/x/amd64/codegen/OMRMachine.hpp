@@ -74,18 +74,12 @@ public:
     static uint8_t numGPRRegsWithheld(TR::CodeGenerator *cg);
     static uint8_t numRegsWithheld(TR::CodeGenerator *cg);
 
-    static bool disableNewPickRegister()
-    {
-        if (!_dnprIsInitialized) {
-            _dnprIsInitialized = true;
-        }
-        return _disableNewPickRegister;
-    }
+    static bool disableNewPickRegister() { return _disableNewPickRegister; }
 
     static bool enableNewPickRegister();
 
 private:
-    static bool _disableNewPickRegister, _dnprIsInitialized;
+    static bool _disableNewPickRegister;
 };
 
 }}} // namespace OMR::X86::AMD64
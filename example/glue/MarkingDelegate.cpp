@@ -23,9 +23,13 @@
 #include "omrhashtable.h"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
 #include "omrExampleVM.hpp"
 #include "OMRVMThreadListIterator.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 
 #include "MarkingDelegate.hpp"
 
@@ -68,4 +72,22 @@ MM_MarkingDelegate::mainCleanupAfterGC(MM_EnvironmentBase *env)
 		}
 		objEntry = (ObjectEntry *)hashTableNextDo(&state);
 	}
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* drop remembered objects that are about to be swept, or the scavenger would find their reused memory in the remembered set */
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->scavengerEnabled) {
+		MM_SublistPuddle *puddle = NULL;
+		GC_SublistIterator rememberedSetIterator(&extensions->rememberedSet);
+		while (NULL != (puddle = rememberedSetIterator.nextList())) {
+			omrobjectptr_t *slotPtr = NULL;
+			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+			while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+				if ((NULL == *slotPtr) || !_markingScheme->isMarked(*slotPtr)) {
+					rememberedSetSlotIterator.removeSlot();
+				}
+			}
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 }
@@ -72,6 +72,9 @@ public:
 	 */
 	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags = 0)
 		: MM_AllocateInitialization(env, allocation_category_example, requiredSizeInBytes, allocateObjectFlags)
-	{}
+	{
+		/* example objects have no class, so objects of the same size share an allocation site for pretenuring */
+		setAllocationSiteToken(env->getExtensions()->objectModel.adjustSizeInBytes(requiredSizeInBytes));
+	}
 };
 #endif /* OBJECTALLOCATIONMODEL_HPP_ */
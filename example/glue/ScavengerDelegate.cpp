@@ -110,6 +110,22 @@ MM_ScavengerDelegate::getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr
 	return objectScanner;
 }
 
+uintptr_t
+MM_ScavengerDelegate::getHotFieldProfileToken(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	/* Example objects have no class; every slot after the header is a reference, so the
+	 * object size is enough to identify the field layout.
+	 */
+	return _extensions->objectModel.getSizeInBytesWithHeader(objectPtr);
+}
+
+uintptr_t
+MM_ScavengerDelegate::getAllocationSiteToken(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	/* Example objects have no class or allocation site; the allocation model uses the object size as the site token */
+	return _extensions->objectModel.getSizeInBytesWithHeader(objectPtr);
+}
+
 void
 MM_ScavengerDelegate::flushReferenceObjects(MM_EnvironmentStandard *env)
 {
@@ -138,6 +138,30 @@ public:
 	 */
 	GC_ObjectScanner *getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, void *allocSpace, uintptr_t flags, MM_ScavengeScanReason reason, bool *shouldRemember);
 
+	/**
+	 * If hot field profiling is enabled (see MM_GCExtensionsBase::scavengerHotFieldProfiling), scavenger calls this method
+	 * for sampled objects while scanning them and for objects it tenures. The implementation must return a non-zero token
+	 * that is shared by all objects with the same reference field layout (eg, the class of the object), or 0 if the object
+	 * is not to be profiled. Field samples are aggregated per token to select the hot fields of each class.
+	 *
+	 * @param[in] env The environment for the calling thread.
+	 * @param[in] objectPtr The object being scanned or tenured (never an object in evacuate space)
+	 * @return The class token of the object, or 0 if the object is not to be profiled
+	 */
+	uintptr_t getHotFieldProfileToken(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * If pretenuring is enabled (see MM_GCExtensionsBase::scavengerPretenuring), scavenger calls this method for every
+	 * object it tenures. The implementation must return the token that was given to the allocation of the object through
+	 * MM_AllocateInitialization::setAllocationSiteToken() (eg, its class or an allocation site kept in its header), or 0
+	 * if the object is not to be profiled. Tenure rates are aggregated per token to decide which sites are pretenured.
+	 *
+	 * @param[in] env The environment for the calling thread.
+	 * @param[in] objectPtr The tenured copy of the object
+	 * @return The allocation site token of the object, or 0 if the object is not to be profiled
+	 */
+	uintptr_t getAllocationSiteToken(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
 	/**
 	 * Scavenger calls this method when required to force GC threads to flush any locally-held references into
 	 * associated global buffers.
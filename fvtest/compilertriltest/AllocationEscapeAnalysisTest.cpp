@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "il/Node.hpp"
+#include "il/Symbol.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+#include "ras/IlVerifierHelpers.hpp"
+
+/**
+ * Records how allocations were handled. The test code generator cannot evaluate
+ * allocations, so compilation is stopped by returning a non-zero return code when
+ * one is left in the trees.
+ */
+class AllocationIlVerifier : public TR::IlVerifier {
+public:
+    AllocationIlVerifier()
+        : _foundAllocation(false)
+        , _foundLocalObject(false)
+    {}
+
+    int32_t verify(TR::ResolvedMethodSymbol *sym)
+    {
+        for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter) {
+            TR::Node *node = iter.currentNode();
+            if (node->getOpCodeValue() == TR::New)
+                _foundAllocation = true;
+            else if (node->getOpCodeValue() == TR::loadaddr && node->getSymbol()->isLocalObject())
+                _foundLocalObject = true;
+        }
+
+        return _foundAllocation ? 1 : 0;
+    }
+
+    bool foundAllocation() { return _foundAllocation; }
+
+    bool foundLocalObject() { return _foundLocalObject; }
+
+private:
+    bool _foundAllocation;
+    bool _foundLocalObject;
+};
+
+class AllocationEscapeAnalysisTest : public TRTest::JitOptTest {
+public:
+    AllocationEscapeAnalysisTest() { addOptimization(OMR::escapeAnalysis); }
+};
+
+TEST_F(AllocationEscapeAnalysisTest, FieldsAreReplacedByScalars)
+{
+    // The field at offset 16 is never stored, so it reads as zero
+    auto inputTrees = "(method return=Int32 args=[Int32] "
+                      "  (block "
+                      "    (astore temp=\"o\" (new (aconst 0))) "
+                      "    (istorei offset=8 (aload temp=\"o\") (iload parm=0)) "
+                      "    (istorei offset=12 (aload temp=\"o\") (iconst 5)) "
+                      "    (ireturn "
+                      "      (iadd "
+                      "        (iadd (iloadi offset=8 (aload temp=\"o\")) (iloadi offset=12 (aload temp=\"o\"))) "
+                      "        (iloadi offset=16 (aload temp=\"o\"))))))";
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    AllocationIlVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Allocation was not removed\n"
+                                                          << "Input trees: " << inputTrees;
+    EXPECT_FALSE(verifier.foundLocalObject()) << "Allocation was not replaced by scalars";
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(8, entry_point(3));
+    EXPECT_EQ(-5, entry_point(-10));
+}
+
+TEST_F(AllocationEscapeAnalysisTest, ComparedObjectIsAllocatedOnStack)
+{
+    SKIP_IF(sizeof(void *) != 8, MissingImplementation) << "Test uses 64-bit reference fields";
+
+    // A comparison needs the object's address, so it cannot be replaced by scalars
+    auto inputTrees = "(method return=Int32 args=[Address] "
+                      "  (block "
+                      "    (astore temp=\"o\" (new (aconst 0))) "
+                      "    (lstorei offset=8 (aload temp=\"o\") (lconst 7)) "
+                      "    (astorei offset=16 (aload temp=\"o\") (aload parm=0)) "
+                      "    (ireturn "
+                      "      (iadd "
+                      "        (iadd "
+                      "          (acmpeq (aload temp=\"o\") (aload parm=0)) "
+                      "          (acmpeq (aloadi offset=16 (aload temp=\"o\")) (aload parm=0))) "
+                      "        (l2i (lloadi offset=8 (aload temp=\"o\")))))))";
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    AllocationIlVerifier verifier;
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Allocation was not removed\n"
+                                                          << "Input trees: " << inputTrees;
+    EXPECT_TRUE(verifier.foundLocalObject()) << "Allocation was not moved to the stack";
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(void *)>();
+    int32_t value = 0;
+    EXPECT_EQ(8, entry_point(&value));
+    EXPECT_EQ(8, entry_point(NULL));
+}
+
+TEST_F(AllocationEscapeAnalysisTest, ObjectStoredToMemoryEscapes)
+{
+    auto inputTrees = "(method return=NoType args=[Address] "
+                      "  (block "
+                      "    (astore temp=\"o\" (new (aconst 0))) "
+                      "    (istorei offset=8 (aload temp=\"o\") (iconst 1)) "
+                      "    (astorei offset=0 (aload parm=0) (aload temp=\"o\")) "
+                      "    (return)))";
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    AllocationIlVerifier verifier;
+    EXPECT_NE(0, compiler.compileWithVerifier(&verifier));
+    EXPECT_TRUE(verifier.foundAllocation()) << "Escaping allocation was removed";
+}
+
+TEST_F(AllocationEscapeAnalysisTest, ObjectSharingLocalWithOtherValuesEscapes)
+{
+    // o may refer to the caller's object, so accesses through it cannot be redirected
+    auto inputTrees = "(method return=Int32 args=[Address, Int32] "
+                      "  (block "
+                      "    (astore temp=\"o\" (aload parm=0)) "
+                      "    (ificmpeq target=\"load\" (iload parm=1) (iconst 0))) "
+                      "  (block "
+                      "    (astore temp=\"o\" (new (aconst 0))) "
+                      "    (istorei offset=8 (aload temp=\"o\") (iconst 1))) "
+                      "  (block name=\"load\" "
+                      "    (ireturn (iloadi offset=8 (aload temp=\"o\")))))";
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    AllocationIlVerifier verifier;
+    EXPECT_NE(0, compiler.compileWithVerifier(&verifier));
+    EXPECT_TRUE(verifier.foundAllocation()) << "Escaping allocation was removed";
+}
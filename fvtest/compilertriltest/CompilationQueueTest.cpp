@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "JitTest.hpp"
+#include "TrilMethod.hpp"
+#include "compile/Compilation.hpp"
+#include "control/CompilationQueue.hpp"
+#include "ras/IlVerifier.hpp"
+
+#include <atomic>
+#include <vector>
+
+/**
+ * Records the order in which methods are compiled, optionally holding the compilation
+ * thread until it is allowed to continue.
+ */
+class OrderIlVerifier : public TR::IlVerifier {
+public:
+    OrderIlVerifier(int32_t id, std::vector<int32_t> *order, std::atomic<bool> *block = NULL)
+        : _id(id)
+        , _order(order)
+        , _block(block)
+    {}
+
+    int32_t verify(TR::ResolvedMethodSymbol *sym)
+    {
+        _order->push_back(_id);
+        while (_block != NULL && _block->load())
+            omrthread_yield();
+        return 0;
+    }
+
+private:
+    int32_t _id;
+    std::vector<int32_t> *_order;
+    std::atomic<bool> *_block;
+};
+
+class CompilationQueueTest : public TRTest::JitTest {
+protected:
+    static const char *addConstantTrees(char *buffer, size_t size, int32_t constant)
+    {
+        std::snprintf(buffer, size,
+            "(method return=Int32 args=[Int32] "
+            "  (block "
+            "    (ireturn (iadd (iload parm=0) (iconst %d)))))",
+            constant);
+        return buffer;
+    }
+};
+
+TEST_F(CompilationQueueTest, CompilesInBackground)
+{
+    TR::CompilationQueue *queue = TR::CompilationQueue::create(2);
+    ASSERT_NOTNULL(queue);
+
+    const int32_t numMethods = 8;
+    std::vector<TrilMethod *> methods;
+    std::vector<TR::CompilationFuture *> futures;
+    for (int32_t i = 0; i < numMethods; i++) {
+        char inputTrees[256];
+        auto trees = parseString(addConstantTrees(inputTrees, sizeof(inputTrees), i));
+        ASSERT_NOTNULL(trees);
+        methods.push_back(new TrilMethod(trees));
+        futures.push_back(queue->submit(methods[i]->details(), warm));
+    }
+
+    for (int32_t i = 0; i < numMethods; i++) {
+        int32_t rc = -1;
+        auto entry_point = reinterpret_cast<int32_t (*)(int32_t)>(futures[i]->wait(rc));
+        EXPECT_TRUE(futures[i]->isDone());
+        ASSERT_EQ(COMPILATION_SUCCEEDED, rc) << "Compilation " << i << " failed";
+        ASSERT_NOTNULL(entry_point);
+        EXPECT_EQ(40 + i, entry_point(40));
+        futures[i]->release();
+    }
+
+    EXPECT_EQ(0, queue->getNumQueued());
+    TR::CompilationQueue::destroy(queue);
+    for (int32_t i = 0; i < numMethods; i++)
+        delete methods[i];
+}
+
+TEST_F(CompilationQueueTest, DuplicateSubmissionsShareCompilation)
+{
+    TR::CompilationQueue *queue = TR::CompilationQueue::create(1);
+    ASSERT_NOTNULL(queue);
+
+    char inputTrees[256];
+    auto trees = parseString(addConstantTrees(inputTrees, sizeof(inputTrees), 3));
+    ASSERT_NOTNULL(trees);
+
+    TrilMethod method(trees);
+    std::vector<int32_t> order;
+    OrderIlVerifier verifier(0, &order);
+    method.details().setIlVerifier(&verifier);
+
+    TR::CompilationFuture *future1 = queue->submit(method.details(), warm);
+    TR::CompilationFuture *future2 = queue->submit(method.details(), warm);
+    ASSERT_EQ(future1, future2);
+
+    int32_t rc = -1;
+    auto entry_point = reinterpret_cast<int32_t (*)(int32_t)>(future2->wait(rc));
+    ASSERT_EQ(COMPILATION_SUCCEEDED, rc);
+    EXPECT_EQ(7, entry_point(4));
+    EXPECT_EQ(1, order.size()) << "Method was compiled more than once";
+
+    future1->release();
+    future2->release();
+    TR::CompilationQueue::destroy(queue);
+}
+
+TEST_F(CompilationQueueTest, QueuedCompilationsAreCancelledAndPrioritized)
+{
+    TR::CompilationQueue *queue = TR::CompilationQueue::create(1);
+    ASSERT_NOTNULL(queue);
+
+    const int32_t numMethods = 4;
+    std::vector<TrilMethod *> methods;
+    for (int32_t i = 0; i < numMethods; i++) {
+        char inputTrees[256];
+        auto trees = parseString(addConstantTrees(inputTrees, sizeof(inputTrees), i));
+        ASSERT_NOTNULL(trees);
+        methods.push_back(new TrilMethod(trees));
+    }
+
+    // Hold the compilation thread in the first compilation while the others are queued
+    std::vector<int32_t> order;
+    std::atomic<bool> block(true);
+    std::vector<OrderIlVerifier *> verifiers;
+    for (int32_t i = 0; i < numMethods; i++) {
+        verifiers.push_back(new OrderIlVerifier(i, &order, i == 0 ? &block : NULL));
+        methods[i]->details().setIlVerifier(verifiers[i]);
+    }
+
+    TR::CompilationFuture *blocker = queue->submit(methods[0]->details(), warm);
+    while (queue->getNumQueued() != 0)
+        omrthread_yield();
+
+    TR::CompilationFuture *low = queue->submit(methods[1]->details(), warm, 1);
+    TR::CompilationFuture *cancelled = queue->submit(methods[2]->details(), warm, 5);
+    TR::CompilationFuture *high = queue->submit(methods[3]->details(), warm, 1);
+    ASSERT_EQ(high, queue->submit(methods[3]->details(), warm, 10));
+    high->release();
+    EXPECT_EQ(3, queue->getNumQueued());
+
+    EXPECT_FALSE(blocker->cancel()) << "Compilation in progress was cancelled";
+    EXPECT_TRUE(cancelled->cancel());
+    EXPECT_TRUE(cancelled->isDone());
+    int32_t rc = -1;
+    EXPECT_EQ(NULL, cancelled->wait(rc));
+    EXPECT_EQ(COMPILATION_REQUESTED, rc);
+    EXPECT_EQ(2, queue->getNumQueued());
+
+    block.store(false);
+    for (TR::CompilationFuture *future : { blocker, low, high }) {
+        future->wait(rc);
+        EXPECT_EQ(COMPILATION_SUCCEEDED, rc);
+        future->release();
+    }
+    cancelled->release();
+
+    // The resubmission with a higher priority overtakes the earlier request
+    ASSERT_EQ(3, order.size());
+    EXPECT_EQ(0, order[0]);
+    EXPECT_EQ(3, order[1]);
+    EXPECT_EQ(1, order[2]);
+
+    TR::CompilationQueue::destroy(queue);
+    for (int32_t i = 0; i < numMethods; i++) {
+        delete methods[i];
+        delete verifiers[i];
+    }
+}
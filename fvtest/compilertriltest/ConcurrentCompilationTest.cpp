@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "JitTest.hpp"
+#include "TrilMethod.hpp"
+#include "control/CompilationQueue.hpp"
+#include "control/CompileMethod.hpp"
+
+#include <vector>
+
+/**
+ * Stress test for simultaneous compilations. Hundreds of methods of a few shapes are
+ * compiled by a pool of compilation threads, each method with its own constants so that
+ * every compiled body can be checked.
+ */
+class ConcurrentCompilationTest : public TRTest::JitTest {
+protected:
+    static const int32_t numShapes = 4;
+
+    static const char *methodTrees(char *buffer, size_t size, int32_t shape, int32_t c)
+    {
+        switch (shape) {
+            case 0:
+                std::snprintf(buffer, size,
+                    "(method return=Int32 args=[Int32] "
+                    "  (block "
+                    "    (ireturn (iadd (imul (iload parm=0) (iconst %d)) (iconst %d)))))",
+                    c, c + 1);
+                break;
+            case 1:
+                std::snprintf(buffer, size,
+                    "(method return=Int32 args=[Int32] "
+                    "  (block "
+                    "    (istore temp=\"sum\" (iconst %d)) "
+                    "    (istore temp=\"i\" (iconst 0)) "
+                    "    (ificmple target=\"exit\" (iload parm=0) (iconst 0))) "
+                    "  (block name=\"loop\" "
+                    "    (istore temp=\"sum\" (iadd (iload temp=\"sum\") (iload temp=\"i\"))) "
+                    "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                    "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=0))) "
+                    "  (block name=\"exit\" "
+                    "    (ireturn (iload temp=\"sum\"))))",
+                    c);
+                break;
+            case 2:
+                std::snprintf(buffer, size,
+                    "(method return=Int32 args=[Int32] "
+                    "  (block "
+                    "    (ificmpge target=\"large\" (iload parm=0) (iconst %d))) "
+                    "  (block "
+                    "    (ireturn (imul (iload parm=0) (iconst 3)))) "
+                    "  (block name=\"large\" "
+                    "    (ireturn (isub (iload parm=0) (iconst %d)))))",
+                    c, c);
+                break;
+            default:
+                std::snprintf(buffer, size,
+                    "(method return=Int32 args=[Int32] "
+                    "  (block "
+                    "    (ireturn (l2i (ldiv (lmul (i2l (iload parm=0)) (lconst %d)) (lconst 7))))))",
+                    c + 1);
+                break;
+        }
+        return buffer;
+    }
+
+    static int32_t expectedResult(int32_t shape, int32_t c, int32_t x)
+    {
+        switch (shape) {
+            case 0:
+                return x * c + c + 1;
+            case 1:
+                return c + (x > 0 ? x * (x - 1) / 2 : 0);
+            case 2:
+                return x >= c ? x - c : x * 3;
+            default:
+                return static_cast<int32_t>(static_cast<int64_t>(x) * (c + 1) / 7);
+        }
+    }
+
+    static void checkMethod(int32_t shape, int32_t c, int32_t (*entry_point)(int32_t))
+    {
+        const int32_t arguments[] = { -100, -1, 0, 1, 2, 50, 1000 };
+        for (size_t i = 0; i < sizeof(arguments) / sizeof(arguments[0]); i++)
+            EXPECT_EQ(expectedResult(shape, c, arguments[i]), entry_point(arguments[i]))
+                << "shape " << shape << " constant " << c << " argument " << arguments[i];
+    }
+};
+
+TEST_F(ConcurrentCompilationTest, CompilesMethodsInParallel)
+{
+    TR::CompilationQueue *queue = TR::CompilationQueue::create(8);
+    ASSERT_NOTNULL(queue);
+
+    const int32_t numMethods = 256;
+    std::vector<TrilMethod *> methods;
+    std::vector<TR::CompilationFuture *> futures;
+    for (int32_t i = 0; i < numMethods; i++) {
+        char inputTrees[1024];
+        auto trees = parseString(methodTrees(inputTrees, sizeof(inputTrees), i % numShapes, i));
+        ASSERT_NOTNULL(trees);
+        methods.push_back(new TrilMethod(trees));
+        futures.push_back(queue->submit(methods[i]->details(), i % 2 == 0 ? warm : cold));
+    }
+
+    for (int32_t i = 0; i < numMethods; i++) {
+        int32_t rc = -1;
+        auto entry_point = reinterpret_cast<int32_t (*)(int32_t)>(futures[i]->wait(rc));
+        ASSERT_EQ(COMPILATION_SUCCEEDED, rc) << "Compilation " << i << " failed";
+        ASSERT_NOTNULL(entry_point);
+        checkMethod(i % numShapes, i, entry_point);
+        futures[i]->release();
+    }
+
+    TR::CompilationQueue::destroy(queue);
+    for (int32_t i = 0; i < numMethods; i++)
+        delete methods[i];
+}
+
+TEST_F(ConcurrentCompilationTest, CompilesSynchronouslyWhileQueueCompiles)
+{
+    TR::CompilationQueue *queue = TR::CompilationQueue::create(4);
+    ASSERT_NOTNULL(queue);
+
+    const int32_t numQueued = 128;
+    std::vector<TrilMethod *> methods;
+    std::vector<TR::CompilationFuture *> futures;
+    for (int32_t i = 0; i < numQueued; i++) {
+        char inputTrees[1024];
+        auto trees = parseString(methodTrees(inputTrees, sizeof(inputTrees), i % numShapes, i));
+        ASSERT_NOTNULL(trees);
+        methods.push_back(new TrilMethod(trees));
+        futures.push_back(queue->submit(methods[i]->details(), warm));
+    }
+
+    // The application thread compiles its own methods while the compilation threads are busy
+    for (int32_t i = 0; i < 32; i++) {
+        char inputTrees[1024];
+        auto trees = parseString(methodTrees(inputTrees, sizeof(inputTrees), i % numShapes, -i));
+        ASSERT_NOTNULL(trees);
+        TrilMethod method(trees);
+        int32_t rc = -1;
+        auto entry_point
+            = reinterpret_cast<int32_t (*)(int32_t)>(compileMethodFromDetails(NULL, method.details(), warm, rc));
+        ASSERT_EQ(COMPILATION_SUCCEEDED, rc) << "Synchronous compilation " << i << " failed";
+        checkMethod(i % numShapes, -i, entry_point);
+    }
+
+    for (int32_t i = 0; i < numQueued; i++) {
+        int32_t rc = -1;
+        auto entry_point = reinterpret_cast<int32_t (*)(int32_t)>(futures[i]->wait(rc));
+        ASSERT_EQ(COMPILATION_SUCCEEDED, rc) << "Compilation " << i << " failed";
+        checkMethod(i % numShapes, i, entry_point);
+        futures[i]->release();
+    }
+
+    TR::CompilationQueue::destroy(queue);
+    for (int32_t i = 0; i < numQueued; i++)
+        delete methods[i];
+}
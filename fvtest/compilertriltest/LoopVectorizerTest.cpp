@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "codegen/CodeGenerator.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+#include "ras/IlVerifierHelpers.hpp"
+
+/**
+ * Checks whether the loop was rewritten to use vector stores. Compilation is
+ * stopped by returning a non-zero return code when the outcome differs from
+ * the expected one.
+ */
+class VectorStoreIlVerifier : public TR::IlVerifier {
+public:
+    VectorStoreIlVerifier(bool expectVectorStores)
+        : _expectVectorStores(expectVectorStores)
+    {}
+
+    int32_t verify(TR::ResolvedMethodSymbol *sym)
+    {
+        bool foundVectorStore = false;
+        for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter) {
+            TR::ILOpCode &op = iter.currentNode()->getOpCode();
+            if (op.isVectorOpCode() && op.isStore())
+                foundVectorStore = true;
+        }
+
+        return foundVectorStore == _expectVectorStores ? 0 : 1;
+    }
+
+private:
+    bool _expectVectorStores;
+};
+
+class LoopVectorizerTest : public TRTest::JitOptTest {
+public:
+    LoopVectorizerTest()
+    {
+        addOptimization(OMR::loopCanonicalization);
+        addOptimization(OMR::inductionVariableAnalysis);
+        addOptimization(OMR::loopVectorizer);
+    }
+
+protected:
+    bool platformSupportsDoubleMultiply()
+    {
+        TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+        TR::DataType vt = TR::DataType::createVectorType(TR::Double, TR::VectorLength128);
+        return TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu,
+                   TR::ILOpCode::createVectorOpCode(TR::vloadi, vt))
+            && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vstorei, vt))
+            && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vmul, vt));
+    }
+};
+
+/*
+ * void method(double *a, double *b, double *c, int32_t n)
+ *   for (int32_t i = 0; i < n; i++)
+ *     a[i + storeOffset / 8] = b[i] * c[i];
+ *
+ * where b is the first parameter instead when loadParm is 0.
+ */
+static void multiplyTrees(char *buffer, size_t size, int32_t storeOffset, int32_t loadParm)
+{
+    std::snprintf(buffer, size,
+        "(method return=NoType args=[Address,Address,Address,Int32] "
+        "  (block "
+        "    (istore temp=\"i\" (iconst 0)) "
+        "    (ificmple target=\"exit\" (iload parm=3) (iconst 0))) "
+        "  (block name=\"loop\" "
+        "    (dstorei offset=%d "
+        "      (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 8))) "
+        "      (dmul "
+        "        (dloadi offset=0 (aladd (aload parm=%d) (lmul (i2l (iload temp=\"i\")) (lconst 8)))) "
+        "        (dloadi offset=0 (aladd (aload parm=2) (lmul (i2l (iload temp=\"i\")) (lconst 8)))))) "
+        "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+        "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=3))) "
+        "  (block name=\"exit\" "
+        "    (return)))",
+        storeOffset, loadParm);
+}
+
+TEST_F(LoopVectorizerTest, ElementWiseMultiply)
+{
+    SKIP_IF(sizeof(void *) != 8, MissingImplementation) << "Test uses 64-bit address arithmetic";
+    SKIP_IF(!platformSupportsDoubleMultiply(), MissingImplementation)
+        << "Vector double multiply is not supported by the target platform";
+
+    char inputTrees[1024];
+    multiplyTrees(inputTrees, sizeof(inputTrees), 0, 1);
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreIlVerifier verifier(true);
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Loop was not vectorized\n"
+                                                          << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double *, double *, double *, int32_t)>();
+
+    const int32_t lengths[] = { 0, 1, 2, 3, 7, 8, 9, 31, 100 };
+    for (int32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        int32_t n = lengths[l];
+        double a[101], b[100], c[100];
+        for (int32_t i = 0; i < 100; i++) {
+            a[i] = -1.0;
+            b[i] = i + 0.5;
+            c[i] = 100 - i;
+        }
+        a[100] = -1.0;
+
+        entry_point(a, b, c, n);
+
+        for (int32_t i = 0; i < n; i++)
+            EXPECT_EQ(b[i] * c[i], a[i]) << "n = " << n << ", i = " << i;
+        for (int32_t i = n; i <= 100; i++)
+            EXPECT_EQ(-1.0, a[i]) << "n = " << n << ", i = " << i;
+    }
+}
+
+TEST_F(LoopVectorizerTest, InPlaceMultiply)
+{
+    SKIP_IF(sizeof(void *) != 8, MissingImplementation) << "Test uses 64-bit address arithmetic";
+    SKIP_IF(!platformSupportsDoubleMultiply(), MissingImplementation)
+        << "Vector double multiply is not supported by the target platform";
+
+    // a[i] = a[i] * c[i] only reads the element each iteration stores
+    char inputTrees[1024];
+    multiplyTrees(inputTrees, sizeof(inputTrees), 0, 0);
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreIlVerifier verifier(true);
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Loop was not vectorized\n"
+                                                          << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double *, double *, double *, int32_t)>();
+
+    double a[37], expected[37], c[37];
+    for (int32_t i = 0; i < 37; i++) {
+        a[i] = i;
+        c[i] = (i % 3) + 1.0;
+        expected[i] = a[i] * c[i];
+    }
+
+    entry_point(a, NULL, c, 37);
+
+    for (int32_t i = 0; i < 37; i++)
+        EXPECT_EQ(expected[i], a[i]) << "i = " << i;
+}
+
+TEST_F(LoopVectorizerTest, LoopCarriedDependenceIsNotVectorized)
+{
+    SKIP_IF(sizeof(void *) != 8, MissingImplementation) << "Test uses 64-bit address arithmetic";
+
+    // a[i + 1] = a[i] * c[i] reads the element the previous iteration stored
+    char inputTrees[1024];
+    multiplyTrees(inputTrees, sizeof(inputTrees), 8, 0);
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreIlVerifier verifier(false);
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Loop was vectorized unexpectedly\n"
+                                                          << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double *, double *, double *, int32_t)>();
+
+    double a[65], expected[65], c[64];
+    for (int32_t i = 0; i < 64; i++)
+        c[i] = (i % 3) + 1.0;
+    for (int32_t i = 0; i < 65; i++)
+        a[i] = expected[i] = 1.0;
+    for (int32_t i = 0; i < 64; i++)
+        expected[i + 1] = expected[i] * c[i];
+
+    entry_point(a, NULL, c, 64);
+
+    for (int32_t i = 0; i < 65; i++)
+        EXPECT_EQ(expected[i], a[i]) << "i = " << i;
+}
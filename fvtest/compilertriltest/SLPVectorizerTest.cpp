@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "codegen/CodeGenerator.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+#include "ras/IlVerifierHelpers.hpp"
+
+/**
+ * Checks whether the stores were packed into vector stores. Compilation is
+ * stopped by returning a non-zero return code when the outcome differs from
+ * the expected one.
+ */
+class PackedStoreIlVerifier : public TR::IlVerifier {
+public:
+    PackedStoreIlVerifier(bool expectVectorStores)
+        : _expectVectorStores(expectVectorStores)
+    {}
+
+    int32_t verify(TR::ResolvedMethodSymbol *sym)
+    {
+        bool foundVectorStore = false;
+        for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter) {
+            TR::ILOpCode &op = iter.currentNode()->getOpCode();
+            if (op.isVectorOpCode() && op.isStore())
+                foundVectorStore = true;
+        }
+
+        return foundVectorStore == _expectVectorStores ? 0 : 1;
+    }
+
+private:
+    bool _expectVectorStores;
+};
+
+class SLPVectorizerTest : public TRTest::JitOptTest {
+public:
+    SLPVectorizerTest() { addOptimization(OMR::slpVectorizer); }
+
+protected:
+    bool platformSupports(TR::ILOpCodes scalarOp, bool needsSplat)
+    {
+        TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+        TR::DataType vt = TR::DataType::createVectorType(TR::Double, TR::VectorLength128);
+        return TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vloadi, vt))
+            && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vstorei, vt))
+            && TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu,
+                TR::ILOpCode::convertScalarToVector(scalarOp, TR::VectorLength128))
+            && (!needsSplat
+                || TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu,
+                    TR::ILOpCode::createVectorOpCode(TR::vsplats, vt)));
+    }
+};
+
+TEST_F(SLPVectorizerTest, AdjacentStores)
+{
+    SKIP_IF(!platformSupports(TR::dmul, false), MissingImplementation)
+        << "Vector double multiply is not supported by the target platform";
+
+    // a[k] = b[k] * c[k] for k = 0..3
+    char inputTrees[2048];
+    char *p = inputTrees;
+    p += std::snprintf(p, sizeof(inputTrees), "(method return=NoType args=[Address,Address,Address] (block ");
+    for (int32_t k = 0; k < 4; k++) {
+        p += std::snprintf(p, sizeof(inputTrees) - (p - inputTrees),
+            "(dstorei offset=%d (aload parm=0) "
+            "  (dmul (dloadi offset=%d (aload parm=1)) (dloadi offset=%d (aload parm=2)))) ",
+            k * 8, k * 8, k * 8);
+    }
+    std::snprintf(p, sizeof(inputTrees) - (p - inputTrees), "(return)))");
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    PackedStoreIlVerifier verifier(true);
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Stores were not packed\n"
+                                                          << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double *, double *, double *)>();
+
+    double a[5] = { -1.0, -1.0, -1.0, -1.0, -1.0 };
+    double b[4] = { 1.5, -2.0, 3.25, 1e10 };
+    double c[4] = { 2.0, 0.5, -4.0, 1e-10 };
+    entry_point(a, b, c);
+
+    for (int32_t k = 0; k < 4; k++)
+        EXPECT_EQ(b[k] * c[k], a[k]) << "k = " << k;
+    EXPECT_EQ(-1.0, a[4]);
+}
+
+TEST_F(SLPVectorizerTest, UnrolledLoopBody)
+{
+    SKIP_IF(sizeof(void *) != 8, MissingImplementation) << "Test uses 64-bit address arithmetic";
+    SKIP_IF(!platformSupports(TR::dadd, true), MissingImplementation)
+        << "Vector double add is not supported by the target platform";
+
+    // a[i] = b[i] + s; i = i + 1; repeated four times, as left behind by unrolling
+    char inputTrees[4096];
+    char *p = inputTrees;
+    p += std::snprintf(p, sizeof(inputTrees),
+        "(method return=NoType args=[Address,Address,Double,Int32] (block (istore temp=\"i\" (iload parm=3)) ");
+    for (int32_t k = 0; k < 4; k++) {
+        p += std::snprintf(p, sizeof(inputTrees) - (p - inputTrees),
+            "(dstorei offset=0 (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 8))) "
+            "  (dadd (dloadi offset=0 (aladd (aload parm=1) (lmul (i2l (iload temp=\"i\")) (lconst 8)))) "
+            "        (dload parm=2))) "
+            "(istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) ");
+    }
+    std::snprintf(p, sizeof(inputTrees) - (p - inputTrees), "(return)))");
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    PackedStoreIlVerifier verifier(true);
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Stores were not packed\n"
+                                                          << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double *, double *, double, int32_t)>();
+
+    double a[8], b[8];
+    for (int32_t k = 0; k < 8; k++) {
+        a[k] = -1.0;
+        b[k] = k * 1.25;
+    }
+    entry_point(a, b, 0.5, 3);
+
+    for (int32_t k = 0; k < 8; k++)
+        EXPECT_EQ(k >= 3 && k < 7 ? b[k] + 0.5 : -1.0, a[k]) << "k = " << k;
+}
+
+TEST_F(SLPVectorizerTest, DependentStoresAreNotPacked)
+{
+    // a[k + 1] = a[k] * c[k] for k = 0..3 reads the element stored by the previous statement
+    char inputTrees[2048];
+    char *p = inputTrees;
+    p += std::snprintf(p, sizeof(inputTrees), "(method return=NoType args=[Address,Address] (block ");
+    for (int32_t k = 0; k < 4; k++) {
+        p += std::snprintf(p, sizeof(inputTrees) - (p - inputTrees),
+            "(dstorei offset=%d (aload parm=0) "
+            "  (dmul (dloadi offset=%d (aload parm=0)) (dloadi offset=%d (aload parm=1)))) ",
+            k * 8 + 8, k * 8, k * 8);
+    }
+    std::snprintf(p, sizeof(inputTrees) - (p - inputTrees), "(return)))");
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    PackedStoreIlVerifier verifier(false);
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Stores were packed unexpectedly\n"
+                                                          << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double *, double *)>();
+
+    double a[5] = { 1.5, 1.0, 1.0, 1.0, 1.0 };
+    double c[4] = { 2.0, 3.0, -1.0, 0.25 };
+    entry_point(a, c);
+
+    double expected = 1.5;
+    for (int32_t k = 0; k < 4; k++) {
+        expected *= c[k];
+        EXPECT_EQ(expected, a[k + 1]) << "k = " << k;
+    }
+}
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "JitTest.hpp"
+#include "TrilMethod.hpp"
+#include "compile/Compilation.hpp"
+#include "control/CompileMethod.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "ras/IlVerifier.hpp"
+
+#include <vector>
+
+/**
+ * Records the hotness of every body compiled for a method.
+ */
+class HotnessIlVerifier : public TR::IlVerifier {
+public:
+    int32_t verify(TR::ResolvedMethodSymbol *sym)
+    {
+        _hotness.push_back(sym->comp()->getMethodHotness());
+        return 0;
+    }
+
+    std::vector<TR_Hotness> _hotness;
+};
+
+/**
+ * A cold body is recompiled at warm after tieredCompilationCount invocations and loop
+ * iterations. The warm body is final.
+ */
+class TieredCompilationTest : public TRTest::TestWithPortLib {
+public:
+    TieredCompilationTest()
+    {
+        auto initSuccess = initializeSimpleJitWithOptions(
+            (char *)"-Xjit:acceptHugeMethods,useILValidator,enableTieredCompilation,tieredCompilationCount=5");
+        if (!initSuccess)
+            throw std::runtime_error("Failed to initialize jit");
+    }
+
+    ~TieredCompilationTest() { shutdownSimpleJit(); }
+
+protected:
+    template <typename T> T compileTiered(TrilMethod &method, HotnessIlVerifier &verifier)
+    {
+        method.details().setIlVerifier(&verifier);
+        int32_t rc = -1;
+        uint8_t *entry = compileMethodFromDetails(NULL, method.details(), warm, rc);
+        EXPECT_EQ(COMPILATION_SUCCEEDED, rc);
+        return reinterpret_cast<T>(entry);
+    }
+};
+
+TEST_F(TieredCompilationTest, InvocationsUpgradeBody)
+{
+    auto trees = parseString("(method return=Int64 args=[Int64, Int32] "
+                             "  (block "
+                             "    (lreturn (lmul (lload parm=0) (i2l (iload parm=1))))))");
+    ASSERT_NOTNULL(trees);
+
+    TrilMethod method(trees);
+    HotnessIlVerifier verifier;
+    auto entry_point = compileTiered<int64_t (*)(int64_t, int32_t)>(method, verifier);
+    ASSERT_NOTNULL(entry_point);
+    ASSERT_EQ(1, verifier._hotness.size());
+    EXPECT_EQ(cold, verifier._hotness[0]);
+
+    for (int32_t i = 0; i < 4; i++)
+        EXPECT_EQ(-3000000000LL * i, entry_point(-3000000000LL, i));
+    EXPECT_EQ(1, verifier._hotness.size()) << "Cold body was recompiled too early";
+
+    EXPECT_EQ(20, entry_point(4, 5));
+    ASSERT_EQ(2, verifier._hotness.size()) << "Cold body was not recompiled";
+    EXPECT_EQ(warm, verifier._hotness[1]);
+
+    // Invocations through the original entry point are forwarded to the current body
+    for (int32_t i = 0; i < 100; i++)
+        EXPECT_EQ(7LL * i, entry_point(7, i));
+    EXPECT_EQ(2, verifier._hotness.size()) << "Warm body was recompiled";
+}
+
+TEST_F(TieredCompilationTest, LoopIterationsUpgradeBody)
+{
+    auto trees = parseString("(method return=Int32 args=[Int32] "
+                             "  (block "
+                             "    (istore temp=\"sum\" (iconst 0)) "
+                             "    (istore temp=\"i\" (iconst 0)) "
+                             "    (ificmple target=\"exit\" (iload parm=0) (iconst 0))) "
+                             "  (block name=\"loop\" "
+                             "    (istore temp=\"sum\" (iadd (iload temp=\"sum\") (iload temp=\"i\"))) "
+                             "    (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                             "    (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=0))) "
+                             "  (block name=\"exit\" "
+                             "    (ireturn (iload temp=\"sum\"))))");
+    ASSERT_NOTNULL(trees);
+
+    TrilMethod method(trees);
+    HotnessIlVerifier verifier;
+    auto entry_point = compileTiered<int32_t (*)(int32_t)>(method, verifier);
+    ASSERT_NOTNULL(entry_point);
+
+    // A single invocation that loops long enough upgrades the method; it finishes in the old body
+    EXPECT_EQ(4950, entry_point(100));
+    ASSERT_EQ(2, verifier._hotness.size()) << "Loop iterations did not trigger recompilation";
+    EXPECT_EQ(warm, verifier._hotness[1]);
+
+    EXPECT_EQ(499500, entry_point(1000));
+    EXPECT_EQ(2, verifier._hotness.size()) << "Warm body was recompiled";
+
+    EXPECT_EQ(0, entry_point(0));
+    EXPECT_EQ(1, entry_point(2));
+}
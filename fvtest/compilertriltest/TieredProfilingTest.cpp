@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "TrilMethod.hpp"
+#include "compile/Compilation.hpp"
+#include "control/CompileMethod.hpp"
+#include "il/Block.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+
+#include <vector>
+
+/**
+ * Records, for every body compiled for a method, whether it was compiled with a
+ * profile and how the profile was used.
+ */
+class ProfileIlVerifier : public TR::IlVerifier {
+public:
+    struct Body {
+        TR_Hotness _hotness;
+        bool _hasProfile;
+        bool _versionedOnDivisor; ///< the divisor is compared against the profiled constant
+        int32_t _markerFrequency; ///< frequency of the block returning the marker constant
+    };
+
+    ProfileIlVerifier(int32_t divisor, int32_t marker)
+        : _divisor(divisor)
+        , _marker(marker)
+    {}
+
+    int32_t verify(TR::ResolvedMethodSymbol *sym)
+    {
+        TR::Compilation *comp = sym->comp();
+        Body body = { comp->getMethodHotness(), comp->getMethodProfile() != NULL, false, -1 };
+
+        TR::Block *block = NULL;
+        for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), comp); iter.currentTree(); ++iter) {
+            TR::Node *node = iter.currentNode();
+            if (node->getOpCodeValue() == TR::BBStart)
+                block = node->getBlock();
+            else if (node->getOpCodeValue() == TR::ificmpne && node->getSecondChild()->getOpCode().isLoadConst()
+                && node->getSecondChild()->getInt() == _divisor)
+                body._versionedOnDivisor = true;
+            else if (node->getOpCodeValue() == TR::ireturn && node->getFirstChild()->getOpCode().isLoadConst()
+                && node->getFirstChild()->getInt() == _marker)
+                body._markerFrequency = block->getFrequency();
+        }
+
+        _bodies.push_back(body);
+        return 0;
+    }
+
+    std::vector<Body> _bodies;
+
+private:
+    int32_t _divisor;
+    int32_t _marker;
+};
+
+/**
+ * The cold body of a method records block counts and divisor values; the warm body is
+ * compiled with the block frequencies and divisor values observed in the cold body.
+ */
+class TieredProfilingTest : public TRTest::TestWithPortLib {
+public:
+    TieredProfilingTest()
+    {
+        auto initSuccess = initializeSimpleJitWithOptions((char *)"-Xjit:acceptHugeMethods,useILValidator,"
+                                                                  "enableTieredCompilation,enableTieredProfiling,"
+                                                                  "tieredCompilationCount=5");
+        if (!initSuccess)
+            throw std::runtime_error("Failed to initialize jit");
+    }
+
+    ~TieredProfilingTest() { shutdownSimpleJit(); }
+
+protected:
+    template <typename T> T compileTiered(TrilMethod &method, ProfileIlVerifier &verifier)
+    {
+        method.details().setIlVerifier(&verifier);
+        int32_t rc = -1;
+        uint8_t *entry = compileMethodFromDetails(NULL, method.details(), warm, rc);
+        EXPECT_EQ(COMPILATION_SUCCEEDED, rc);
+        return reinterpret_cast<T>(entry);
+    }
+};
+
+static const char *divisionTrees = "(method return=Int32 args=[Int32, Int32] "
+                                   "  (block "
+                                   "    (ireturn (idiv (iload parm=0) (iload parm=1)))))";
+
+TEST_F(TieredProfilingTest, DominantDivisorIsVersioned)
+{
+    auto trees = parseString(divisionTrees);
+    ASSERT_NOTNULL(trees);
+
+    TrilMethod method(trees);
+    ProfileIlVerifier verifier(8, 0);
+    auto entry_point = compileTiered<int32_t (*)(int32_t, int32_t)>(method, verifier);
+    ASSERT_NOTNULL(entry_point);
+    ASSERT_EQ(1, verifier._bodies.size());
+    EXPECT_FALSE(verifier._bodies[0]._hasProfile);
+
+    for (int32_t i = 0; i < 5; i++)
+        EXPECT_EQ(-i, entry_point(-8 * i - 7, 8));
+    ASSERT_EQ(2, verifier._bodies.size()) << "Cold body was not recompiled";
+    EXPECT_EQ(warm, verifier._bodies[1]._hotness);
+    EXPECT_TRUE(verifier._bodies[1]._hasProfile) << "Warm body was compiled without the profile";
+    EXPECT_TRUE(verifier._bodies[1]._versionedOnDivisor) << "Division was not versioned on the profiled divisor";
+
+    // Both versions of the division compute the original result
+    const int32_t dividends[] = { 0, 1, 7, 8, 9, -1, -7, -8, -9, 123456789, -123456789, INT32_MAX, INT32_MIN };
+    const int32_t divisors[] = { 8, 3, -8, 1, -1, 7 };
+    for (size_t i = 0; i < sizeof(dividends) / sizeof(dividends[0]); i++) {
+        for (size_t j = 0; j < sizeof(divisors) / sizeof(divisors[0]); j++) {
+            if (dividends[i] == INT32_MIN && divisors[j] == -1)
+                continue;
+            EXPECT_EQ(dividends[i] / divisors[j], entry_point(dividends[i], divisors[j]))
+                << dividends[i] << " / " << divisors[j];
+        }
+    }
+}
+
+TEST_F(TieredProfilingTest, VaryingDivisorIsNotVersioned)
+{
+    auto trees = parseString(divisionTrees);
+    ASSERT_NOTNULL(trees);
+
+    TrilMethod method(trees);
+    ProfileIlVerifier verifier(1, 0);
+    auto entry_point = compileTiered<int32_t (*)(int32_t, int32_t)>(method, verifier);
+    ASSERT_NOTNULL(entry_point);
+
+    for (int32_t i = 1; i <= 5; i++)
+        EXPECT_EQ(100 / i, entry_point(100, i));
+    ASSERT_EQ(2, verifier._bodies.size()) << "Cold body was not recompiled";
+    EXPECT_TRUE(verifier._bodies[1]._hasProfile) << "Warm body was compiled without the profile";
+    EXPECT_FALSE(verifier._bodies[1]._versionedOnDivisor) << "Division was versioned without a dominant divisor";
+
+    EXPECT_EQ(-33, entry_point(-100, 3));
+}
+
+TEST_F(TieredProfilingTest, UnexecutedBlockIsCold)
+{
+    auto trees = parseString("(method return=Int32 args=[Int32] "
+                             "  (block "
+                             "    (ificmpge target=\"common\" (iload parm=0) (iconst 0))) "
+                             "  (block "
+                             "    (ireturn (iconst 1234))) "
+                             "  (block name=\"common\" "
+                             "    (ireturn (iadd (iload parm=0) (iconst 1)))))");
+    ASSERT_NOTNULL(trees);
+
+    TrilMethod method(trees);
+    ProfileIlVerifier verifier(0, 1234);
+    auto entry_point = compileTiered<int32_t (*)(int32_t)>(method, verifier);
+    ASSERT_NOTNULL(entry_point);
+
+    for (int32_t i = 0; i < 5; i++)
+        EXPECT_EQ(i + 1, entry_point(i));
+    ASSERT_EQ(2, verifier._bodies.size()) << "Cold body was not recompiled";
+    EXPECT_TRUE(verifier._bodies[1]._hasProfile) << "Warm body was compiled without the profile";
+    EXPECT_EQ(0, verifier._bodies[1]._markerFrequency) << "Block that never ran was given a frequency";
+
+    EXPECT_EQ(1234, entry_point(-1));
+    EXPECT_EQ(11, entry_point(10));
+}
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef TRILMETHOD_HPP
+#define TRILMETHOD_HPP
+
+#include "CallConverter.hpp"
+#include "GenericNodeConverter.hpp"
+#include "ilgen.hpp"
+#include "method_info.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+#include <vector>
+
+/**
+ * A Tril method together with the objects its compilation refers to, for tests whose
+ * compilations outlive a single call into the compiler (asynchronous compilation or
+ * recompilation). Unlike Tril::DefaultCompiler, the objects live as long as this one.
+ */
+class TrilMethod {
+public:
+    explicit TrilMethod(const ASTNode *trees)
+        : _methodInfo(trees)
+        , _callConverter(&_genericNodeConverter)
+        , _ilGenerator(_methodInfo.getBodyAST(), &_types, &_callConverter)
+        , _argTypes(_methodInfo.getArgTypes().begin(), _methodInfo.getArgTypes().end())
+        , _argNames(_argTypes.size(), "(unknown parameter name)")
+        , _resolvedMethod("file", "line", "name", static_cast<int32_t>(_argTypes.size()),
+              _argNames.size() != 0 ? &_argNames[0] : NULL, _argTypes.size() != 0 ? &_argTypes[0] : NULL,
+              _methodInfo.getReturnType(), 0, &_ilGenerator)
+        , _details(&_resolvedMethod)
+    {}
+
+    TR::IlGeneratorMethodDetails &details() { return _details; }
+
+private:
+    Tril::MethodInfo _methodInfo;
+    TR::TypeDictionary _types;
+    Tril::GenericNodeConverter _genericNodeConverter;
+    Tril::CallConverter _callConverter;
+    Tril::TRLangBuilder _ilGenerator;
+    std::vector<TR::DataType> _argTypes;
+    std::vector<const char *> _argNames;
+    TR::ResolvedMethod _resolvedMethod;
+    TR::IlGeneratorMethodDetails _details;
+};
+
+#endif // TRILMETHOD_HPP
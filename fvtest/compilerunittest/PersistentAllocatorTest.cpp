@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "env/PersistentAllocator.hpp"
+
+class PersistentAllocatorTest : public testing::Test {
+public:
+    PersistentAllocatorTest()
+        : _kit(TR::RawAllocator())
+        , _allocator(_kit)
+    {}
+
+protected:
+    TR::PersistentAllocatorKit _kit;
+    TR::PersistentAllocator _allocator;
+};
+
+TEST_F(PersistentAllocatorTest, ReusesFreedBlocks)
+{
+    void *first = _allocator.allocate(40);
+    _allocator.deallocate(first);
+    void *second = _allocator.allocate(40);
+    ASSERT_EQ(first, second);
+    _allocator.deallocate(second);
+}
+
+TEST_F(PersistentAllocatorTest, AlignsAllocations)
+{
+    std::vector<void *> blocks;
+    for (size_t size = 0; size <= 5000; size += 7) {
+        uint8_t *p = static_cast<uint8_t *>(_allocator.allocate(size));
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(p) % 16) << "size " << size;
+        memset(p, 0xa5, size);
+        blocks.push_back(p);
+    }
+
+    for (size_t i = 0; i < blocks.size(); i++)
+        _allocator.deallocate(blocks[i]);
+}
+
+TEST_F(PersistentAllocatorTest, CountsMemoryInUse)
+{
+    std::vector<void *> blocks;
+    for (int32_t i = 0; i < 1000; i++)
+        blocks.push_back(_allocator.allocate(100));
+    void *large = _allocator.allocate(100000);
+
+    TR::PersistentAllocator::Statistics stats;
+    _allocator.getStatistics(stats);
+    EXPECT_LE(1000 * 100, stats.smallBlockBytes);
+    EXPECT_LE(100000, stats.largeBlockBytes);
+    EXPECT_LE(stats.smallBlockBytes + stats.freeBlockBytes + stats.unusedSegmentBytes, stats.segmentBytes);
+
+    for (size_t i = 0; i < blocks.size(); i++)
+        _allocator.deallocate(blocks[i]);
+    _allocator.deallocate(large);
+
+    _allocator.getStatistics(stats);
+    EXPECT_EQ(0, stats.smallBlockBytes);
+    EXPECT_EQ(0, stats.largeBlockBytes);
+}
+
+/*
+ * Threads allocate and free blocks of many sizes, including blocks freed by a thread other than
+ * the one that allocated them, and check that no block is handed out twice.
+ */
+TEST_F(PersistentAllocatorTest, ThreadsAllocateConcurrently)
+{
+    const int32_t numThreads = 8;
+    const int32_t numBlocks = 256;
+    std::vector<uint8_t *> handedOver[numThreads];
+    std::vector<std::thread> threads;
+
+    for (int32_t t = 0; t < numThreads; t++) {
+        threads.push_back(std::thread([this, t, &handedOver]() {
+            std::vector<uint8_t *> live(numBlocks, static_cast<uint8_t *>(NULL));
+            std::vector<size_t> sizes(numBlocks, 0);
+            uint32_t seed = 12345 + t;
+            for (int32_t i = 0; i < 20000; i++) {
+                seed = seed * 1103515245 + 12345;
+                int32_t slot = (seed >> 8) % numBlocks;
+                if (live[slot] != NULL) {
+                    for (size_t b = 0; b < sizes[slot]; b++)
+                        ASSERT_EQ(static_cast<uint8_t>(t + slot), live[slot][b]);
+                    _allocator.deallocate(live[slot]);
+                }
+
+                sizes[slot] = (seed >> 16) % ((slot % 16 == 0) ? 4000 : 300);
+                live[slot] = static_cast<uint8_t *>(_allocator.allocate(sizes[slot]));
+                memset(live[slot], t + slot, sizes[slot]);
+            }
+
+            // Leave the odd blocks for the main thread to free
+            for (int32_t slot = 0; slot < numBlocks; slot++) {
+                if (slot % 2)
+                    handedOver[t].push_back(live[slot]);
+                else
+                    _allocator.deallocate(live[slot]);
+            }
+            _allocator.releaseThreadCache();
+        }));
+    }
+
+    for (int32_t t = 0; t < numThreads; t++)
+        threads[t].join();
+
+    for (int32_t t = 0; t < numThreads; t++) {
+        for (size_t i = 0; i < handedOver[t].size(); i++)
+            _allocator.deallocate(handedOver[t][i]);
+    }
+    _allocator.releaseThreadCache();
+
+    TR::PersistentAllocator::Statistics stats;
+    _allocator.getStatistics(stats);
+    EXPECT_EQ(0, stats.smallBlockBytes);
+    EXPECT_EQ(0, stats.largeBlockBytes);
+    EXPECT_EQ(0, stats.numThreadCaches);
+}
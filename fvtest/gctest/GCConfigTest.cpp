@@ -43,12 +43,18 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_idleHeapRelease_GC_config.xml"
+#if defined(OMR_GC_MODRON_STANDARD)
+                        , "fvtest/gctest/configuration/global_hugeObject_GC_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_hotFieldProfile_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_rememberedSetSummary_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -973,6 +979,11 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "idle")) {
+			/* leave the heap alone for the given number of milliseconds */
+			int64_t millis = (int64_t)atoi(node.attribute("millis").value());
+			gcTestEnv->log("Idling for %lld ms...\n", millis);
+			omrthread_sleep(millis);
 		}
 	}
 done:
@@ -0,0 +1,529 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <algorithm>
+
+#include "EnvironmentBase.hpp"
+#include "GCWorkloadTest.hpp"
+#include "Heap.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ObjectModel.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "SlotObject.hpp"
+#include "StandardWriteBarrier.hpp"
+
+#define MAX_NAME_LENGTH 512
+#define WORKLOAD_RSS_SAMPLE_MASK 0xFFF
+
+const char *workloadTests[] = {"fvtest/gctest/configuration/workload_GC_config.xml"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                            , "fvtest/gctest/configuration/workload_concurrentForecast_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                            , "fvtest/gctest/configuration/workload_gencon_GC_config.xml"
+                            , "fvtest/gctest/configuration/workload_pretenure_GC_config.xml"
+                            , "fvtest/gctest/configuration/workload_remapCopy_GC_config.xml"
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+                            , "fvtest/gctest/configuration/workload_clearAhead_GC_config.xml"
+#endif
+#endif
+                            };
+
+const char *workloadPerfTests[] = {"perftest/gctest/configuration/workload_optavgpause_flat.xml"
+                                , "perftest/gctest/configuration/workload_optavgpause_large.xml"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                                , "perftest/gctest/configuration/workload_concurrent_tree.xml"
+#endif
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                                , "perftest/gctest/configuration/workload_gencon_tree.xml"
+                                , "perftest/gctest/configuration/workload_gencon_batch.xml"
+                                , "perftest/gctest/configuration/workload_gencon_list_mt.xml"
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+                                , "perftest/gctest/configuration/workload_gencon_tree_clear_ahead.xml"
+#endif
+#endif
+                                };
+
+void
+GCWorkloadTest::SetUp()
+{
+	GCConfigTest::SetUp();
+	if (HasFatalFailure()) {
+		return;
+	}
+
+	if ((0 != omrthread_monitor_init_with_name(&workloadMonitor, 0, "GCWorkloadTest::workload"))
+	|| (0 != omrthread_monitor_init_with_name(&collectMutex, 0, "GCWorkloadTest::collect"))) {
+		FAIL() << "Failed to initialize workload monitors.";
+	}
+}
+
+void
+GCWorkloadTest::TearDown()
+{
+	if (NULL != collectMutex) {
+		omrthread_monitor_destroy(collectMutex);
+		collectMutex = NULL;
+	}
+	if (NULL != workloadMonitor) {
+		omrthread_monitor_destroy(workloadMonitor);
+		workloadMonitor = NULL;
+	}
+
+	GCConfigTest::TearDown();
+}
+
+int32_t
+GCWorkloadTest::parseWorkload(pugi::xml_node node)
+{
+	int32_t rt = 0;
+
+	if (!node) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: missing workload node.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	const char *name = node.attribute("name").as_string("workload");
+	strncpy(wc.name, name, sizeof(wc.name) - 1);
+	wc.mutatorThreads = (uintptr_t)node.attribute("mutatorThreads").as_uint(1);
+	wc.operations = (uintptr_t)node.attribute("operations").as_uint(100000);
+	wc.objectFields = (uintptr_t)node.attribute("objectFields").as_uint(4);
+	wc.largeObjectFields = (uintptr_t)node.attribute("largeObjectFields").as_uint(0);
+	wc.largeObjectRate = (uintptr_t)node.attribute("largeObjectRate").as_uint(0);
+	wc.liveSlots = (uintptr_t)node.attribute("liveSlots").as_uint(1024);
+	wc.breadth = (uintptr_t)node.attribute("breadth").as_uint(2);
+	wc.depth = (uintptr_t)node.attribute("depth").as_uint(4);
+	wc.survivalRate = (uintptr_t)node.attribute("survivalRate").as_uint(10);
+	wc.mutationRate = (uintptr_t)node.attribute("mutationRate").as_uint(5);
+	wc.batchSize = (uintptr_t)node.attribute("batchSize").as_uint(1);
+	wc.seed = (uintptr_t)node.attribute("seed").as_uint(1);
+	wc.report = node.attribute("report").value();
+
+	if ((0 == wc.mutatorThreads) || (WORKLOAD_MAX_MUTATOR_THREADS < wc.mutatorThreads)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: mutatorThreads must be between 1 and %d.\n", __FILE__, __LINE__, WORKLOAD_MAX_MUTATOR_THREADS);
+		rt = 1;
+	}
+	if ((0 == wc.batchSize) || (WORKLOAD_MAX_BATCH_SIZE < wc.batchSize)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: batchSize must be between 1 and %d.\n", __FILE__, __LINE__, WORKLOAD_MAX_BATCH_SIZE);
+		rt = 1;
+	}
+	if ((0 == wc.breadth) || (wc.objectFields < wc.breadth) || ((0 != wc.largeObjectFields) && (wc.largeObjectFields < wc.breadth))) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: breadth must be non zero and fit in objectFields and largeObjectFields.\n", __FILE__, __LINE__);
+		rt = 1;
+	}
+	if ((0 == wc.liveSlots) || (100 < wc.survivalRate) || (100 < wc.mutationRate) || (1000 < wc.largeObjectRate)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: liveSlots must be non zero, rates must be in range.\n", __FILE__, __LINE__);
+		rt = 1;
+	}
+
+	gcTestEnv->log("Workload %s: %zu mutator thread(s) x %zu operations, batchSize=%zu, objectFields=%zu, liveSlots=%zu, breadth=%zu, depth=%zu, survivalRate=%zu%%, mutationRate=%zu%%\n",
+			wc.name, wc.mutatorThreads, wc.operations, wc.batchSize, wc.objectFields, wc.liveSlots, wc.breadth, wc.depth, wc.survivalRate, wc.mutationRate);
+	return rt;
+}
+
+int32_t
+GCWorkloadTest::createLiveSets()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uintptr_t size = nodeSize(wc.liveSlots);
+
+	/* The calling thread does not hold VM access, so allocating with GC is safe here and the
+	 * live set arrays allocated so far are kept alive and updated through the root table.
+	 */
+	for (uintptr_t i = 0; i < wc.mutatorThreads; i++) {
+		WorkloadThread *thread = &threads[i];
+		thread->test = this;
+		thread->index = i;
+		thread->random = ((uint64_t)wc.seed << 32) + i + 1;
+		omrstr_printf(thread->liveSetName, sizeof(thread->liveSetName), "%s_liveSet_%zu", wc.name, i);
+
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+		RootEntry rEntry;
+		rEntry.name = thread->liveSetName;
+		rEntry.rootPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc);
+		if (NULL == rEntry.rootPtr) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate live set of size 0x%llx.\n", __FILE__, __LINE__, size);
+			return 1;
+		}
+		if (NULL == hashTableAdd(exampleVM->rootTable, &rEntry)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to add new root entry to root table!\n", __FILE__, __LINE__);
+			return 1;
+		}
+	}
+
+	/* root entries can move while entries are added, find them once the table is complete */
+	for (uintptr_t i = 0; i < wc.mutatorThreads; i++) {
+		RootEntry searchEntry;
+		searchEntry.name = threads[i].liveSetName;
+		threads[i].liveSetRoot = (RootEntry *)hashTableFind(exampleVM->rootTable, &searchEntry);
+		if (NULL == threads[i].liveSetRoot) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to find root entry %s.\n", __FILE__, __LINE__, threads[i].liveSetName);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int32_t
+GCWorkloadTest::runWorkload(uint64_t *elapsedMicros)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	uintptr_t startedThreads = 0;
+	uint64_t startTime = omrtime_hires_clock();
+
+	finishedThreads = 0;
+	for (; startedThreads < wc.mutatorThreads; startedThreads++) {
+		omrthread_t handle = NULL;
+		if (0 != omrthread_create(&handle, 0, J9THREAD_PRIORITY_NORMAL, 0, workerMain, &threads[startedThreads])) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to start mutator thread %zu.\n", __FILE__, __LINE__, startedThreads);
+			rt = 1;
+			break;
+		}
+	}
+
+	omrthread_monitor_enter(workloadMonitor);
+	while (finishedThreads < startedThreads) {
+		omrthread_monitor_wait(workloadMonitor);
+	}
+	omrthread_monitor_exit(workloadMonitor);
+
+	*elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	samplePhysicalMemory();
+
+	for (uintptr_t i = 0; i < startedThreads; i++) {
+		if (NULL == threads[i].omrVMThread) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Mutator thread %zu failed to attach.\n", __FILE__, __LINE__, i);
+			rt = 1;
+		} else if (0 != threads[i].failedAllocations) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Mutator thread %zu ran out of memory.\n", __FILE__, __LINE__, i);
+			rt = 1;
+		}
+	}
+	return rt;
+}
+
+int J9THREAD_PROC
+GCWorkloadTest::workerMain(void *arg)
+{
+	WorkloadThread *thread = (WorkloadThread *)arg;
+	GCWorkloadTest *test = thread->test;
+	OMR_VMThread *omrVMThread = NULL;
+
+	if (OMR_ERROR_NONE == OMR_Thread_Init(test->exampleVM->_omrVM, NULL, &omrVMThread, "GCWorkloadThread")) {
+		thread->omrVMThread = omrVMThread;
+		test->mutate(thread);
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(test->workloadMonitor);
+	test->finishedThreads += 1;
+	omrthread_monitor_notify_all(test->workloadMonitor);
+	omrthread_monitor_exit(test->workloadMonitor);
+	return 0;
+}
+
+void
+GCWorkloadTest::mutate(WorkloadThread *thread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(thread->omrVMThread);
+
+	env->acquireVMAccess();
+	uintptr_t count = 0;
+	for (uintptr_t op = 0, iteration = 0; op < wc.operations; op += count, iteration++) {
+		/* no object references are held across this point, all live objects are reached from the live set root */
+		if (env->isExclusiveAccessRequestWaiting()) {
+			yieldVMAccess(env);
+		}
+
+		omrobjectptr_t nodes[WORKLOAD_MAX_BATCH_SIZE];
+		uintptr_t fields = wc.objectFields;
+		count = OMR_MIN(wc.batchSize, wc.operations - op);
+		if ((0 != wc.largeObjectFields) && (nextRandom(thread, 1000) < wc.largeObjectRate)) {
+			/* large nodes are allocated on their own */
+			fields = wc.largeObjectFields;
+			count = 1;
+		}
+		if (!allocateNodes(env, thread, fields, count, nodes)) {
+			thread->failedAllocations += 1;
+			break;
+		}
+		for (uintptr_t i = 0; i < count; i++) {
+			if (nextRandom(thread, 100) < wc.survivalRate) {
+				attachNode(env, thread, nodes[i]);
+			}
+		}
+
+		if ((0 == thread->index) && (0 == (iteration & WORKLOAD_RSS_SAMPLE_MASK))) {
+			samplePhysicalMemory();
+		}
+	}
+	env->releaseVMAccess();
+}
+
+void
+GCWorkloadTest::yieldVMAccess(MM_EnvironmentBase *env)
+{
+	/* VM access is a reader preferring lock, so wait for the exclusive request to be served
+	 * before reacquiring it or the requesting thread may never see all mutators out at once.
+	 */
+	env->releaseVMAccess();
+	while (0 < exampleVM->_vmExclusiveAccessCount) {
+		omrthread_yield();
+	}
+	env->acquireVMAccess();
+}
+
+bool
+GCWorkloadTest::allocateBatch(WorkloadThread *thread, uintptr_t size, uintptr_t count, omrobjectptr_t *nodes, bool noGc)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(thread->omrVMThread);
+	uint8_t objectAllocationModelSpace[WORKLOAD_MAX_BATCH_SIZE][sizeof(MM_ObjectAllocationModel)];
+	MM_AllocateInitialization *allocators[WORKLOAD_MAX_BATCH_SIZE];
+
+	for (uintptr_t i = 0; i < count; i++) {
+		allocators[i] = new(objectAllocationModelSpace[i])
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, noGc));
+	}
+	if (1 == count) {
+		nodes[0] = OMR_GC_AllocateObject(thread->omrVMThread, allocators[0]);
+		return NULL != nodes[0];
+	}
+	return OMR_GC_AllocateObjects(thread->omrVMThread, allocators, count, nodes);
+}
+
+bool
+GCWorkloadTest::allocateNodes(MM_EnvironmentBase *env, WorkloadThread *thread, uintptr_t fields, uintptr_t count, omrobjectptr_t *nodes)
+{
+	uintptr_t size = nodeSize(fields);
+	bool allocated = allocateBatch(thread, size, count, nodes, true);
+
+	if (!allocated) {
+		/* the collection needs exclusive access, which cannot be acquired while holding shared access */
+		env->releaseVMAccess();
+		omrthread_monitor_enter(collectMutex);
+		allocated = allocateBatch(thread, size, count, nodes, false);
+		env->acquireVMAccess();
+		omrthread_monitor_exit(collectMutex);
+	}
+
+	if (allocated) {
+		for (uintptr_t i = 0; i < count; i++) {
+			thread->allocatedBytes += env->getExtensions()->objectModel.getConsumedSizeInBytesWithHeader(nodes[i]);
+		}
+	}
+	return allocated;
+}
+
+void
+GCWorkloadTest::attachNode(MM_EnvironmentBase *env, WorkloadThread *thread, omrobjectptr_t node)
+{
+	omrobjectptr_t parent = thread->liveSetRoot->rootPtr;
+	fomrobject_t *slot = (fomrobject_t *)parent + 1 + nextRandom(thread, wc.liveSlots);
+
+	for (uintptr_t level = 0; level < wc.depth; level++) {
+		GC_SlotObject slotObject(env->getOmrVM(), slot);
+		omrobjectptr_t child = slotObject.readReferenceFromSlot();
+		if ((NULL == child) || (nextRandom(thread, 100) < wc.mutationRate)) {
+			break;
+		}
+		parent = child;
+		slot = (fomrobject_t *)parent + 1 + nextRandom(thread, wc.breadth);
+	}
+
+	standardWriteBarrierStore(thread->omrVMThread, parent, slot, node);
+}
+
+void
+GCWorkloadTest::samplePhysicalMemory()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uint64_t physical = 0;
+	if ((0 == omrvmem_get_process_memory_size(OMRPORT_VMEM_PROCESS_PHYSICAL, &physical)) && (peakRSS < physical)) {
+		peakRSS = physical;
+	}
+}
+
+void
+GCWorkloadTest::parseVerboseDocument(pugi::xml_document *verboseDoc, std::vector<double> *pauses, WorkloadPhase *phases, uintptr_t *phaseCount)
+{
+	pugi::xpath_node_set exclusiveEnds = verboseDoc->select_nodes("/verbosegc/exclusive-end");
+	for (pugi::xpath_node_set::const_iterator it = exclusiveEnds.begin(); it != exclusiveEnds.end(); ++it) {
+		pauses->push_back(it->node().attribute("durationms").as_double());
+	}
+
+	pugi::xpath_node_set gcOps = verboseDoc->select_nodes("/verbosegc/gc-op");
+	for (pugi::xpath_node_set::const_iterator it = gcOps.begin(); it != gcOps.end(); ++it) {
+		const char *type = it->node().attribute("type").value();
+		double timeMs = it->node().attribute("timems").as_double();
+		WorkloadPhase *phase = NULL;
+		for (uintptr_t i = 0; i < *phaseCount; i++) {
+			if (0 == strcmp(phases[i].type, type)) {
+				phase = &phases[i];
+				break;
+			}
+		}
+		if ((NULL == phase) && (WORKLOAD_MAX_PHASES > *phaseCount)) {
+			phase = &phases[*phaseCount];
+			*phaseCount += 1;
+			strncpy(phase->type, type, sizeof(phase->type) - 1);
+		}
+		if (NULL != phase) {
+			phase->count += 1;
+			phase->totalMs += timeMs;
+			phase->maxMs = OMR_MAX(phase->maxMs, timeMs);
+		}
+	}
+}
+
+int32_t
+GCWorkloadTest::parseVerboseLog(std::vector<double> *pauses, WorkloadPhase *phases, uintptr_t *phaseCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	if (0 == numOfFiles) {
+		pugi::xml_document verboseDoc;
+		pugi::xml_parse_result result = verboseDoc.load_file(verboseFile);
+		if (!result) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to parse verbose log %s: %s.\n", __FILE__, __LINE__, verboseFile, result.description());
+			return 1;
+		}
+		parseVerboseDocument(&verboseDoc, pauses, phases, phaseCount);
+	} else {
+		/* Loop through multiple files if rolling log is enabled */
+		for (uintptr_t seq = 1; seq <= numOfFiles; seq++) {
+			char currentVerboseFile[MAX_NAME_LENGTH];
+			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq);
+			pugi::xml_document verboseDoc;
+			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			if (pugi::status_file_not_found == result.status) {
+				break;
+			}
+			parseVerboseDocument(&verboseDoc, pauses, phases, phaseCount);
+		}
+	}
+	return 0;
+}
+
+static double
+percentile(std::vector<double> *sorted, uintptr_t percent)
+{
+	double result = 0.0;
+	if (!sorted->empty()) {
+		/* nearest rank */
+		uintptr_t rank = (uintptr_t)((percent * sorted->size() + 99) / 100);
+		result = (*sorted)[OMR_MAX(rank, 1) - 1];
+	}
+	return result;
+}
+
+int32_t
+GCWorkloadTest::reportResults(uint64_t elapsedMicros)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	std::vector<double> pauses;
+	WorkloadPhase phases[WORKLOAD_MAX_PHASES];
+	uintptr_t phaseCount = 0;
+
+	memset(phases, 0, sizeof(phases));
+	if (0 != parseVerboseLog(&pauses, phases, &phaseCount)) {
+		return 1;
+	}
+	std::sort(pauses.begin(), pauses.end());
+
+	double pauseTotalMs = 0.0;
+	for (std::vector<double>::const_iterator it = pauses.begin(); it != pauses.end(); ++it) {
+		pauseTotalMs += *it;
+	}
+	uintptr_t allocatedBytes = 0;
+	for (uintptr_t i = 0; i < wc.mutatorThreads; i++) {
+		allocatedBytes += threads[i].allocatedBytes;
+	}
+	double wallMs = (double)elapsedMicros / 1000.0;
+	double throughput = (0.0 < wallMs) ? OMR_MAX(0.0, (wallMs - pauseTotalMs) / wallMs) : 0.0;
+	double allocationRate = (0.0 < wallMs) ? ((double)allocatedBytes / (1024.0 * 1024.0)) / (wallMs / 1000.0) : 0.0;
+	uintptr_t localCollections = 0;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (extensions->scavengerEnabled) {
+		localCollections = extensions->scavengerStats._gcCount;
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	pugi::xml_node optionNode = doc.select_node("/gc-config/option").node();
+	const char *policy = optionNode.attribute("GCPolicy").as_string("optavgpause");
+	bool concurrentMark = (0 == j9_cmdla_stricmp(optionNode.attribute("concurrentMark").value(), "true"));
+
+	gcTestEnv->log("Workload %s: wall %.3f ms, allocated %zu bytes (%.1f MB/s), throughput %.4f, peak RSS %llu bytes\n",
+			wc.name, wallMs, allocatedBytes, allocationRate, throughput, peakRSS);
+	gcTestEnv->log("Pauses: count %zu, total %.3f ms, p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+			pauses.size(), pauseTotalMs, percentile(&pauses, 50), percentile(&pauses, 90), percentile(&pauses, 99), percentile(&pauses, 100));
+	for (uintptr_t i = 0; i < phaseCount; i++) {
+		gcTestEnv->log("Phase %s: count %zu, total %.3f ms, max %.3f ms\n", phases[i].type, phases[i].count, phases[i].totalMs, phases[i].maxMs);
+	}
+
+	if (0 == strcmp(wc.report, "")) {
+		return 0;
+	}
+
+	/* one JSON record per line so that results of successive runs can be appended and compared */
+	intptr_t fd = omrfile_open(wc.report, EsOpenWrite | EsOpenCreate | EsOpenAppend, 0666);
+	if (-1 == fd) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to open workload report %s.\n", __FILE__, __LINE__, wc.report);
+		return 1;
+	}
+	omrfile_printf(fd, "{\"workload\":\"%s\",\"config\":\"%s\",\"policy\":\"%s\",\"concurrentMark\":%s", wc.name, GetParam(), policy, concurrentMark ? "true" : "false");
+	omrfile_printf(fd, ",\"mutatorThreads\":%zu,\"batchSize\":%zu,\"gcThreads\":%zu,\"heapBytes\":%zu", wc.mutatorThreads, wc.batchSize, extensions->gcThreadCount, extensions->heap->getActiveMemorySize());
+	omrfile_printf(fd, ",\"wallMs\":%.3f,\"allocatedBytes\":%zu,\"allocationRateMBps\":%.3f,\"throughput\":%.5f", wallMs, allocatedBytes, allocationRate, throughput);
+	omrfile_printf(fd, ",\"globalCollections\":%zu,\"localCollections\":%zu,\"peakRssBytes\":%llu", extensions->globalGCStats.gcCount, localCollections, peakRSS);
+	omrfile_printf(fd, ",\"pauses\":{\"count\":%zu,\"totalMs\":%.3f,\"p50Ms\":%.3f,\"p90Ms\":%.3f,\"p99Ms\":%.3f,\"maxMs\":%.3f}",
+			pauses.size(), pauseTotalMs, percentile(&pauses, 50), percentile(&pauses, 90), percentile(&pauses, 99), percentile(&pauses, 100));
+	omrfile_printf(fd, ",\"phases\":{");
+	for (uintptr_t i = 0; i < phaseCount; i++) {
+		omrfile_printf(fd, "%s\"%s\":{\"count\":%zu,\"totalMs\":%.3f,\"maxMs\":%.3f}", (0 == i) ? "" : ",", phases[i].type, phases[i].count, phases[i].totalMs, phases[i].maxMs);
+	}
+	omrfile_printf(fd, "}}\n");
+	omrfile_close(fd);
+	gcTestEnv->log("Workload report appended to %s\n", wc.report);
+	return 0;
+}
+
+TEST_P(GCWorkloadTest, workload)
+{
+	uint64_t elapsedMicros = 0;
+
+	ASSERT_EQ(0, parseWorkload(doc.select_node("/gc-config/workload").node())) << "Invalid workload in " << GetParam() << ".";
+	ASSERT_EQ(0, createLiveSets()) << "Failed to create mutator live sets.";
+	ASSERT_EQ(0, runWorkload(&elapsedMicros)) << "Failed to run workload.";
+
+	/* flush and close the verbose log so that it can be parsed */
+	verboseManager->disableVerboseGC();
+	verboseManager->closeStreams(env);
+	ASSERT_EQ(0, reportResults(elapsedMicros)) << "Failed to report workload results.";
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, GCWorkloadTest,
+        ::testing::ValuesIn(workloadTests));
+
+INSTANTIATE_TEST_CASE_P(perfTest, GCWorkloadTest,
+        ::testing::ValuesIn(workloadPerfTests));
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(GCWORKLOADTEST_HPP_)
+#define GCWORKLOADTEST_HPP_
+
+#include "GCConfigTest.hpp"
+
+#define WORKLOAD_MAX_MUTATOR_THREADS 64
+#define WORKLOAD_MAX_BATCH_SIZE 16
+#define WORKLOAD_MAX_PHASES 16
+#define WORKLOAD_MAX_NAME_LENGTH 64
+
+/**
+ * Parameters of a synthetic workload, read from the <workload> node of a gc-config file.
+ *
+ * Every mutator thread owns a rooted live set array of liveSlots references. Each iteration
+ * allocates batchSize nodes of objectFields reference slots together. With probability
+ * survivalRate a node is attached to a tree hanging off a random live set slot, otherwise
+ * it dies immediately.
+ * Attachment walks down at most depth levels below the live set through random slots among
+ * the first breadth slots of each node (breadth 1 builds lists, depth 0 replaces live set
+ * slots directly), stopping early at an empty slot or, with probability mutationRate at each
+ * level, to replace an existing subtree so that old nodes are mutated to refer to young ones.
+ * Every node hangs at most depth levels below the live set, which bounds the live data.
+ */
+typedef struct WorkloadConfig {
+	char name[WORKLOAD_MAX_NAME_LENGTH]; /**< name reported for the workload */
+	uintptr_t mutatorThreads; /**< number of mutator threads */
+	uintptr_t operations; /**< number of allocations performed by each mutator thread */
+	uintptr_t batchSize; /**< number of nodes allocated together through OMR_GC_AllocateObjects() */
+	uintptr_t objectFields; /**< reference slots per allocated node */
+	uintptr_t largeObjectFields; /**< reference slots per large node (0 for none) */
+	uintptr_t largeObjectRate; /**< per mille of allocations that are large nodes */
+	uintptr_t liveSlots; /**< number of slots in each live set array */
+	uintptr_t breadth; /**< number of node slots used for children */
+	uintptr_t depth; /**< maximum depth of the trees hanging off the live set */
+	uintptr_t survivalRate; /**< percentage of allocated nodes attached to the live set */
+	uintptr_t mutationRate; /**< percentage chance per level of replacing an existing subtree */
+	uintptr_t seed; /**< seed for the per thread random number generators */
+	const char *report; /**< file the result record is appended to */
+} WorkloadConfig;
+
+class GCWorkloadTest;
+
+/**
+ * Per mutator thread state.
+ */
+typedef struct WorkloadThread {
+	GCWorkloadTest *test; /**< owning test */
+	uintptr_t index; /**< mutator thread index */
+	OMR_VMThread *omrVMThread; /**< attached VM thread, valid while the thread runs */
+	RootEntry *liveSetRoot; /**< root table entry holding the live set array */
+	char liveSetName[WORKLOAD_MAX_NAME_LENGTH]; /**< root table key of the live set array */
+	uint64_t random; /**< xorshift state */
+	uintptr_t allocatedBytes; /**< bytes allocated by this thread */
+	uintptr_t failedAllocations; /**< allocations that failed even after a collection */
+} WorkloadThread;
+
+/**
+ * Timings of one gc-op type found in the verbose log.
+ */
+typedef struct WorkloadPhase {
+	char type[WORKLOAD_MAX_NAME_LENGTH]; /**< gc-op type attribute */
+	uintptr_t count; /**< number of operations */
+	double totalMs; /**< sum of operation times */
+	double maxMs; /**< longest operation */
+} WorkloadPhase;
+
+/**
+ * Runs a synthetic allocation/survival/mutation workload on the example glue and appends one
+ * JSON record per run (throughput, pause percentiles, per phase timings and RSS) to a report
+ * file so that collector performance can be compared between builds.
+ *
+ * Mutator threads hold shared VM access while they run and release it when a collection is
+ * waiting. An allocation that needs a collection is made without VM access under collectMutex,
+ * which is held until VM access is reacquired so no other collection can move the new object
+ * before it is linked into the live set. This relies on non-GC allocations never acquiring
+ * exclusive access, which holds because they are never at a safe point.
+ */
+class GCWorkloadTest : public GCConfigTest
+{
+	/*
+	 * Data members
+	 */
+protected:
+	WorkloadConfig wc;
+	WorkloadThread threads[WORKLOAD_MAX_MUTATOR_THREADS];
+	omrthread_monitor_t workloadMonitor; /**< guards finishedThreads */
+	omrthread_monitor_t collectMutex; /**< serializes allocations that may collect with VM access reacquisition */
+	volatile uintptr_t finishedThreads;
+	volatile uint64_t peakRSS; /**< largest physical footprint sampled while running */
+
+	/*
+	 * Function members
+	 */
+protected:
+	int32_t parseWorkload(pugi::xml_node node);
+	int32_t createLiveSets();
+	int32_t runWorkload(uint64_t *elapsedMicros);
+	int32_t reportResults(uint64_t elapsedMicros);
+	int32_t parseVerboseLog(std::vector<double> *pauses, WorkloadPhase *phases, uintptr_t *phaseCount);
+	void parseVerboseDocument(pugi::xml_document *verboseDoc, std::vector<double> *pauses, WorkloadPhase *phases, uintptr_t *phaseCount);
+	void samplePhysicalMemory();
+
+	static int J9THREAD_PROC workerMain(void *arg);
+	void mutate(WorkloadThread *thread);
+	bool allocateBatch(WorkloadThread *thread, uintptr_t size, uintptr_t count, omrobjectptr_t *nodes, bool noGc);
+	bool allocateNodes(MM_EnvironmentBase *env, WorkloadThread *thread, uintptr_t fields, uintptr_t count, omrobjectptr_t *nodes);
+	void attachNode(MM_EnvironmentBase *env, WorkloadThread *thread, omrobjectptr_t node);
+	void yieldVMAccess(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t
+	nextRandom(WorkloadThread *thread, uintptr_t bound)
+	{
+		uint64_t x = thread->random;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		thread->random = x;
+		return (uintptr_t)(x % bound);
+	}
+
+	MMINLINE uintptr_t
+	nodeSize(uintptr_t fields)
+	{
+		return fields * sizeof(fomrobject_t) + sizeof(uintptr_t);
+	}
+
+	virtual void SetUp();
+	virtual void TearDown();
+
+public:
+	GCWorkloadTest()
+		: GCConfigTest()
+		, workloadMonitor(NULL)
+		, collectMutex(NULL)
+		, finishedThreads(0)
+		, peakRSS(0)
+	{
+		memset(&wc, 0, sizeof(wc));
+		memset(threads, 0, sizeof(threads));
+	}
+};
+
+#endif /* GCWORKLOADTEST_HPP_ */
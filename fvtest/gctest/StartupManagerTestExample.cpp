@@ -83,7 +83,21 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountSpecified = (0 < extensions->gcThreadCount);
+					extensions->gcThreadCountForced = extensions->gcThreadCountSpecified;
+				} else if (0 == strcmp(attr.name(), "idleHeapReleaseDelay")) {
+					extensions->idleHeapReleaseDelay = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "decommitMinimumFree")) {
+					extensions->decommitMinimumFree = atoi(attr.value());
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+				} else if (0 == strcmp(attr.name(), "batchClearTLH")) {
+					extensions->batchClearTLH = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+				} else if (0 == strcmp(attr.name(), "tlhClearAheadSize")) {
+					extensions->tlhClearAheadSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "tlhPrefetchDistance")) {
+					extensions->tlhPrefetchDistance = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -101,11 +115,45 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentKickoffForecast")) {
+					extensions->concurrentKickoffForecast = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentKickoffForecastMargin")) {
+					extensions->concurrentKickoffForecastMargin = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_STANDARD)
+				} else if (0 == strcmp(attr.name(), "hugeObjectThreshold")) {
+					extensions->hugeObjectThreshold = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "hugeObjectSpaceMaximumSize")) {
+					extensions->hugeObjectSpaceMaximumSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "verifyHeapBeforeGC")) {
+					extensions->verifyHeapBeforeGC = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verifyHeapAfterGC")) {
+					extensions->verifyHeapAfterGC = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hotFieldProfiling")) {
+					extensions->scavengerHotFieldProfiling = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hotFieldProfileSampleInterval")) {
+					extensions->scavengerHotFieldProfileSampleInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "pretenuring")) {
+					extensions->scavengerPretenuring = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "pretenureThreshold")) {
+					extensions->scavengerPretenureThreshold = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "pretenureReport")) {
+					extensions->scavengerPretenureReport = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "remapCopyThreshold")) {
+					extensions->scavengerRemapCopyThreshold = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "rememberedSetMaximumSize")) {
+					extensions->scavengerRememberedSetMaximumSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "rememberedSetSummaryChunkSize")) {
+					extensions->scavengerRememberedSetSummaryChunkSize = atoi(attr.value()) * unitSize;
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
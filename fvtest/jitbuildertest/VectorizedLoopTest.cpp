@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+/*
+ * Loops of this shape are candidates for the loop vectorizer. The arrays are
+ * accessed through the same array shadow so they may overlap, which has to be
+ * checked when the compiled code runs.
+ */
+DEFINE_BUILDER( MultiplyArrays,
+                NoType,
+                PARAM("result", PointerTo(Double)),
+                PARAM("vector1", PointerTo(Double)),
+                PARAM("vector2", PointerTo(Double)),
+                PARAM("length", Int32) )
+   {
+   OMR::JitBuilder::IlType *pDouble = PointerTo(Double);
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+             ConstInt32(0),
+             Load("length"),
+             ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pDouble,
+   loop->      Load("result"),
+   loop->      Load("i")),
+   loop->   Mul(
+   loop->      LoadAt(pDouble,
+   loop->         IndexAt(pDouble,
+   loop->            Load("vector1"),
+   loop->            Load("i"))),
+   loop->      LoadAt(pDouble,
+   loop->         IndexAt(pDouble,
+   loop->            Load("vector2"),
+   loop->            Load("i")))));
+
+   Return();
+   return true;
+   }
+
+class VectorizedLoopTest : public JitBuilderTest {};
+
+typedef void (*MultiplyArraysFunction)(double *, double *, double *, int32_t);
+
+TEST_F(VectorizedLoopTest, DistinctArrays)
+   {
+   MultiplyArraysFunction multiply;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, MultiplyArrays, multiply);
+
+   for (int32_t length = 0; length <= 37; length++)
+      {
+      double result[38], vector1[37], vector2[37];
+      for (int32_t i = 0; i < 37; i++)
+         {
+         result[i] = -1.0;
+         vector1[i] = i + 0.25;
+         vector2[i] = 3 - i;
+         }
+      result[37] = -1.0;
+
+      multiply(result, vector1, vector2, length);
+
+      for (int32_t i = 0; i < length; i++)
+         ASSERT_EQ(vector1[i] * vector2[i], result[i]) << "length " << length << " index " << i;
+      for (int32_t i = length; i <= 37; i++)
+         ASSERT_EQ(-1.0, result[i]) << "length " << length << " index " << i;
+      }
+   }
+
+TEST_F(VectorizedLoopTest, OverlappingArrays)
+   {
+   MultiplyArraysFunction multiply;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, MultiplyArrays, multiply);
+
+   // result[i] = result[i - shift] * vector2[i] must see the values stored by earlier iterations
+   for (int32_t shift = 1; shift <= 9; shift++)
+      {
+      double buffer[64 + 9], expected[64 + 9], vector2[64];
+      for (int32_t i = 0; i < 64 + 9; i++)
+         buffer[i] = expected[i] = 1.0 + (i % 5);
+      for (int32_t i = 0; i < 64; i++)
+         vector2[i] = (i % 3) + 1.0;
+      for (int32_t i = 0; i < 64; i++)
+         expected[i + shift] = expected[i] * vector2[i];
+
+      multiply(buffer + shift, buffer, vector2, 64);
+
+      for (int32_t i = 0; i < 64 + 9; i++)
+         ASSERT_EQ(expected[i], buffer[i]) << "shift " << shift << " index " << i;
+      }
+
+   // result[i] = result[i + shift] * vector2[i] reads values before later iterations overwrite them
+   for (int32_t shift = 1; shift <= 9; shift++)
+      {
+      double buffer[64 + 9], expected[64 + 9], vector2[64];
+      for (int32_t i = 0; i < 64 + 9; i++)
+         buffer[i] = expected[i] = 1.0 + (i % 5);
+      for (int32_t i = 0; i < 64; i++)
+         vector2[i] = (i % 3) + 1.0;
+      for (int32_t i = 0; i < 64; i++)
+         expected[i] = expected[i + shift] * vector2[i];
+
+      multiply(buffer, buffer + shift, vector2, 64);
+
+      for (int32_t i = 0; i < 64 + 9; i++)
+         ASSERT_EQ(expected[i], buffer[i]) << "shift " << shift << " index " << i;
+      }
+   }
@@ -4550,3 +4550,55 @@ myFunction2()
 	while (++i < 10);
 	return;
 }
+
+/**
+ * Verify that omrvmem_move_memory carries the contents of committed pages to another address
+ * in the same reservation, where it is supported.
+ */
+TEST(PortVmemTest, vmem_test_move_memory)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrvmem_test_move_memory";
+	struct J9PortVmemIdentifier vmemID;
+	uintptr_t pageSize = omrvmem_supported_page_sizes()[0];
+	uintptr_t byteAmount = 4 * pageSize;
+	uintptr_t moveAmount = 2 * pageSize;
+	char *memPtr = NULL;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memPtr = (char *)omrvmem_reserve_memory(
+					0, byteAmount, &vmemID,
+					OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT,
+					pageSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve and commit 0x%zx bytes with page size 0x%zx\n", byteAmount, pageSize);
+		goto exit;
+	}
+
+	for (uintptr_t i = 0; i < moveAmount; i++) {
+		memPtr[i] = (char)(i % 251);
+	}
+	memset(memPtr + moveAmount, 0x5A, moveAmount);
+
+	rc = omrvmem_move_memory(memPtr, memPtr + moveAmount, moveAmount, &vmemID);
+	if (0 == rc) {
+		for (uintptr_t i = 0; i < moveAmount; i++) {
+			if ((char)(i % 251) != memPtr[moveAmount + i]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "moved memory differs at offset 0x%zx\n", i);
+				break;
+			}
+		}
+		/* the source must still be usable */
+		memset(memPtr, 0x11, moveAmount);
+	} else {
+		portTestEnv->log("omrvmem_move_memory is not supported here (%d)\n", rc);
+	}
+
+	if (0 != omrvmem_free_memory(memPtr, byteAmount, &vmemID)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_free_memory failed\n");
+	}
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
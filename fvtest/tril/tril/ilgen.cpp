@@ -32,6 +32,7 @@
 #include <string>
 
 std::map<std::string, TR::ILOpCodes> Tril::OpCodeTable::_opcodeNameMap;
+std::mutex Tril::OpCodeTable::_opcodeNameMapMutex;
 
 /*
  * The general algorithm for generating a TR::Node from it's AST representation
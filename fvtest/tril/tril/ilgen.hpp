@@ -29,6 +29,7 @@
 
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -55,8 +56,12 @@ class OpCodeTable : public TR::ILOpCode {
 
       /**
        * @brief Given an opcode name, returns the corresponding TR::OpCodes value
+       *
+       * Methods can be compiled on several threads at once, so the cache of
+       * names already looked up is locked.
        */
       static TR::ILOpCodes getOpCodeFromName(const std::string& name) {
+         std::lock_guard<std::mutex> lock(_opcodeNameMapMutex);
          auto opcode = _opcodeNameMap.find(name);
          if (opcode == _opcodeNameMap.end()) {
             for (int i = TR::FirstOMROp; i< TR::NumScalarIlOps; i++) {
@@ -127,6 +132,7 @@ class OpCodeTable : public TR::ILOpCode {
 
    private:
       static std::map<std::string, TR::ILOpCodes> _opcodeNameMap;
+      static std::mutex _opcodeNameMapMutex;
 };
 
 /**
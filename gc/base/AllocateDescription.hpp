@@ -57,6 +57,7 @@ protected:
 	MM_MemorySpace *_memorySpace;
 	MM_MemorySubSpace *_memorySubSpace;
 	uintptr_t _allocationTaxSize;
+	uintptr_t _allocationSiteToken; /**< language supplied allocation site (or class) token used for pretenuring, 0 if none */
 
 	bool _tlhAllocation;
 	bool _nurseryAllocation;
@@ -96,6 +97,10 @@ public:
 	MMINLINE bool getNonZeroTLHFlag() { return (_allocateFlags & OMR_GC_ALLOCATE_OBJECT_NON_ZERO_TLH) == OMR_GC_ALLOCATE_OBJECT_NON_ZERO_TLH; }
 	
 	MMINLINE uintptr_t getAllocateFlags() { return _allocateFlags; }
+	MMINLINE void setTenuredFlag() { _allocateFlags |= OMR_GC_ALLOCATE_OBJECT_TENURED; }
+
+	MMINLINE uintptr_t getAllocationSiteToken() { return _allocationSiteToken; }
+	MMINLINE void setAllocationSiteToken(uintptr_t siteToken) { _allocationSiteToken = siteToken; }
 
 	MMINLINE void setObjectFlags(uint32_t objectFlags) { _objectFlags = objectFlags; }
 
@@ -233,6 +238,7 @@ public:
 		,_memorySpace(NULL)
 		,_memorySubSpace(NULL)
 		,_allocationTaxSize(0)
+		,_allocationSiteToken(0)
 		,_tlhAllocation(false)
 		,_nurseryAllocation(false)
 		,_loaAllocation(false)
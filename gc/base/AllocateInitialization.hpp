@@ -35,8 +35,14 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "HugeObjectSpace.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "PretenureProfile.hpp"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -55,7 +61,10 @@
  *
  * If a generational garbage collector is enabled, new allocations are made from nursery
  * space; select the allocate_tenured flag to force allocation directly into old space.
- * The allocate_tenured is ignored if no generational collector is enabled.
+ * The allocate_tenured is ignored if no generational collector is enabled. If pretenuring
+ * is enabled, allocations given an allocation site token (see setAllocationSiteToken())
+ * are also made in old space when the scavenger finds that their site's objects are
+ * nearly always tenured.
  *
  * For allocation of indexable objects the allocate_indexable flag must be selected.
  *
@@ -110,6 +119,35 @@ private:
 		return shouldZero;
 	}
 
+	/**
+	 * Redirect the allocation to old space if its site is pretenured (see MM_PretenureProfile).
+	 *
+	 * @return true if the allocation was redirected
+	 */
+	MMINLINE bool
+	selectPretenuring(MM_EnvironmentBase *env)
+	{
+		bool pretenured = false;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		MM_PretenureProfile *pretenureProfile = env->getExtensions()->pretenureProfile;
+		uintptr_t siteToken = _allocateDescription.getAllocationSiteToken();
+		if ((NULL != pretenureProfile) && (0 != siteToken) && !_allocateDescription.getTenuredFlag()) {
+			pretenured = pretenureProfile->shouldPretenure(env, siteToken);
+			if (pretenured) {
+				pretenure(env);
+			}
+		}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+		return pretenured;
+	}
+
+	MMINLINE void
+	pretenure(MM_EnvironmentBase *env)
+	{
+		_allocateDescription.setTenuredFlag();
+		_allocateDescription.setMemorySpace(env->getExtensions()->heap->getDefaultMemorySpace());
+	}
+
 protected:
 
 public:
@@ -138,6 +176,16 @@ public:
 	MMINLINE bool isAllocatable() { return _isAllocatable; }
 
 	MMINLINE uintptr_t getAllocationCategory() { return _allocationCategory; }
+
+	/**
+	 * Identify the allocation site (or class) of the object for pretenuring. The token must be
+	 * the one MM_ScavengerDelegate::getAllocationSiteToken() returns for the allocated object.
+	 * Objects from a pretenured site are allocated in old space, so stores into them must not
+	 * skip the generational write barrier on the assumption that they are new.
+	 *
+	 * @param[in] siteToken non-zero site token, or 0 to exclude the allocation from pretenuring
+	 */
+	MMINLINE void setAllocationSiteToken(uintptr_t siteToken) { _allocateDescription.setAllocationSiteToken(siteToken); }
 	MMINLINE MM_AllocateDescription *getAllocateDescription() { return &_allocateDescription; }
 
 	MMINLINE bool
@@ -190,8 +238,18 @@ public:
 		omrobjectptr_t objectPtr = NULL;
 		if (isAllocatable()) {
 			void *heapBytes = NULL;
-			
+			bool hugeAllocation = false;
+
+			selectPretenuring(env);
 			_allocateDescription.setBytesRequested(objectModel->adjustSizeInBytes(_allocateDescription.getBytesRequested()));
+#if defined(OMR_GC_MODRON_STANDARD)
+			MM_HugeObjectSpace *hugeObjectSpace = env->getExtensions()->hugeObjectSpace;
+			if ((NULL != hugeObjectSpace) && hugeObjectSpace->isHugeAllocation(_allocateDescription.getBytesRequested())) {
+				/* huge objects get their own (zero filled) reservation outside of the heap */
+				hugeAllocation = true;
+				heapBytes = hugeObjectSpace->allocate(env, &_allocateDescription, isGCAllowed());
+			} else
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 			if (isIndexable()) {
 				heapBytes = env->_objectAllocationInterface->allocateArrayletSpine(env,
 						&_allocateDescription, _allocateDescription.getMemorySpace(), isGCAllowed());
@@ -207,7 +265,7 @@ public:
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
 				/* wipe allocated space if requested and allowed (NON_ZERO_TLH flag set inhibits zeroing) */
-				if (shouldZeroMemory(env)) {
+				if (!hugeAllocation && shouldZeroMemory(env)) {
 					OMRZeroMemory(heapBytes, _allocateDescription.getContiguousBytes());
 				}
 
@@ -224,9 +282,11 @@ public:
 					_allocateDescription.setObjectFlags((uint32_t)objectModel->getObjectFlags(objectPtr));
 #if defined(OMR_GC_ALLOCATION_TAX)
 					/* if concurrent mark is enabled thread might have to pay tax - must save/restore allocated object in case of GC */
-					env->saveObjects(objectPtr);
-					_allocateDescription.payAllocationTax(env);
-					env->restoreObjects(&objectPtr);
+					if (!hugeAllocation) {
+						env->saveObjects(objectPtr);
+						_allocateDescription.payAllocationTax(env);
+						env->restoreObjects(&objectPtr);
+					}
 #endif /* OMR_GC_ALLOCATION_TAX */
 				}
 			}
@@ -243,6 +303,134 @@ public:
 		return objectPtr;
 	}
 
+	/**
+	 * Batch object allocator and initializer. Allocates a single chunk of contiguous memory
+	 * large enough for all of the described objects, so that the batch costs one TLH bump
+	 * (or one TLH refresh or out of line allocation when the TLH is exhausted), then carves
+	 * it into objects and initializes their headers in one pass.
+	 *
+	 * All allocators must have identical allocation flags and none may be indexable or
+	 * large enough to be a huge allocation; otherwise nothing is allocated and the caller
+	 * should fall back to allocating the objects individually. Allocators with the same
+	 * allocation site token as the first share its pretenuring decision. The flags and allocation
+	 * results of the first allocator apply to the whole batch. If a collection is allowed
+	 * it can only happen before the chunk is allocated, so the returned objects do not need
+	 * to be protected from each other's allocation. Allocation tax for the batch is paid
+	 * without starting a collection, which is left to the next allocation.
+	 *
+	 * @param[in] omrVMThread the calling thread
+	 * @param[in] allocators the objects to allocate, in address order
+	 * @param[in] count number of allocators
+	 * @param[out] objects receives the initialized objects, NULL for any that failed
+	 * @return true if all objects were allocated and initialized
+	 */
+	static bool
+	allocateAndInitializeObjects(OMR_VMThread *omrVMThread, MM_AllocateInitialization **allocators, uintptr_t count, omrobjectptr_t *objects)
+	{
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		GC_ObjectModel *objectModel = &(env->getExtensions()->objectModel);
+		MM_AllocateInitialization *batch = allocators[0];
+		MM_AllocateDescription *batchDescription = batch->getAllocateDescription();
+		bool batchable = !batch->isIndexable();
+		uintptr_t totalBytes = 0;
+
+		/* pretenuring may change the flags of the first allocator, so they are compared once it has been selected */
+		uintptr_t allocateFlags = 0;
+		bool pretenured = false;
+		for (uintptr_t i = 0; i < count; i++) {
+			MM_AllocateDescription *description = allocators[i]->getAllocateDescription();
+			if (0 == i) {
+				pretenured = allocators[i]->selectPretenuring(env);
+				allocateFlags = description->getAllocateFlags();
+			} else if (description->getAllocationSiteToken() != batchDescription->getAllocationSiteToken()) {
+				allocators[i]->selectPretenuring(env);
+			} else if (pretenured) {
+				/* objects from the site of the first follow its decision, so that a sampled allocation does not split the batch */
+				allocators[i]->pretenure(env);
+			}
+			description->setBytesRequested(objectModel->adjustSizeInBytes(description->getBytesRequested()));
+			totalBytes += description->getBytesRequested();
+			batchable = batchable && (allocateFlags == description->getAllocateFlags()) && allocators[i]->isAllocatable();
+			objects[i] = NULL;
+		}
+#if defined(OMR_GC_MODRON_STANDARD)
+		MM_HugeObjectSpace *hugeObjectSpace = env->getExtensions()->hugeObjectSpace;
+		batchable = batchable && ((NULL == hugeObjectSpace) || !hugeObjectSpace->isHugeAllocation(totalBytes));
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+		if (!batchable) {
+			return false;
+		}
+
+		uintptr_t vmState = env->pushVMstate(OMRVMSTATE_GC_ALLOCATE_OBJECT);
+
+		Assert_MM_true(batchDescription->shouldCollectAndClimb() == batch->isGCAllowed());
+
+		/* see allocateAndInitializeObject() */
+		batch->setAllocatable(batch->isGCAllowed() || env->_objectAllocationInterface->cachedAllocationsEnabled(env));
+
+		bool allInitialized = false;
+		if (batch->isAllocatable()) {
+			uintptr_t firstBytes = batchDescription->getBytesRequested();
+			batchDescription->setBytesRequested(totalBytes);
+			uint8_t *heapBytes = (uint8_t *)env->_objectAllocationInterface->allocateObject(env,
+					batchDescription, batchDescription->getMemorySpace(), batch->isGCAllowed());
+			batchDescription->setAllocationSucceeded(NULL != heapBytes);
+
+			if (NULL != heapBytes) {
+#if defined(OMR_VALGRIND_MEMCHECK)
+				valgrindMempoolAlloc(env->getExtensions(), (uintptr_t)heapBytes, totalBytes);
+#endif /* defined(OMR_VALGRIND_MEMCHECK) */
+
+				if (batch->shouldZeroMemory(env)) {
+					OMRZeroMemory(heapBytes, totalBytes);
+				}
+				batchDescription->setBytesRequested(firstBytes);
+
+				/* every object must be given a header, even after a failure, to keep the heap walkable */
+				allInitialized = true;
+				for (uintptr_t i = 0; i < count; i++) {
+					MM_AllocateDescription *description = allocators[i]->getAllocateDescription();
+					if (0 != i) {
+						description->setMemorySpace(batchDescription->getMemorySpace());
+						description->setMemorySubSpace(batchDescription->getMemorySubSpace());
+						description->setMemoryPool(batchDescription->getMemoryPool());
+						description->setTLHAllocation(batchDescription->isTLHAllocation());
+						description->setNurseryAllocation(batchDescription->isNurseryAllocation());
+						description->setAllocationSucceeded(true);
+					}
+					objectModel->setObjectFlags((omrobjectptr_t)heapBytes, OMR_OBJECT_METADATA_FLAGS_MASK, batchDescription->getObjectFlags());
+					objects[i] = objectModel->initializeAllocation(env, heapBytes, allocators[i]);
+					if (NULL != objects[i]) {
+						description->setObjectFlags((uint32_t)objectModel->getObjectFlags(objects[i]));
+					} else {
+						allInitialized = false;
+					}
+					heapBytes += description->getBytesRequested();
+				}
+
+				/* in case the objects escape to another thread... */
+				MM_AtomicOperations::writeBarrier();
+#if defined(OMR_GC_ALLOCATION_TAX)
+				/* a collection here could move or free the unreferenced batch, so defer it to the next allocation */
+				bool threadAtSafePoint = batchDescription->isThreadAtSafePoint();
+				batchDescription->setThreadIsAtSafePoint(false);
+				batchDescription->payAllocationTax(env);
+				batchDescription->setThreadIsAtSafePoint(threadAtSafePoint);
+#endif /* OMR_GC_ALLOCATION_TAX */
+			}
+		}
+
+		if (batch->isGCAllowed()) {
+			/* issue Allocation Failure Report if required */
+			env->allocationFailureEndReportIfRequired(batchDescription);
+			/* Done allocation - successful or not */
+			env->unwindExclusiveVMAccessForGC();
+		}
+		env->popVMstate(vmState);
+
+		return allInitialized;
+	}
+
 	/**
 	 * Constructor. Properties set here are used to preset defaults in the
 	 * MM_AllocationDescription instance that will be passed to the allocation
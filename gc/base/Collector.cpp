@@ -26,6 +26,7 @@
 #include "GlobalCollector.hpp"
 #include "FrequentObjectsStats.hpp"
 #include "Heap.hpp"
+#include "IdleHeapRelease.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronAssertions.h"
 #include "ObjectAllocationInterface.hpp"
@@ -459,6 +460,11 @@ MM_Collector::postCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace)
 
 		/* Set the excessive GC state, whether it was an implicit or system GC */
 		setThreadFailAllocFlag(env, excessiveGCDetected);
+
+		/* Any collection ends the idle period and may have freed memory worth releasing */
+		if (NULL != extensions->idleHeapRelease) {
+			extensions->idleHeapRelease->collectionCompleted(env);
+		}
 	}
 
 	Assert_MM_true(_stwCollectionInProgress);
@@ -91,6 +91,7 @@ protected:
 private:
 	uintptr_t _workUnitIndex;
 	uintptr_t _workUnitToHandle;
+	uintptr_t _synchronizeSlot; /**< slot of this thread in the synchronization barrier of the current task */
 
 	bool _threadScanned;
 
@@ -152,6 +153,7 @@ public:
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 	uintptr_t _traceAllocationBytes;  /**< Tracks the bytes allocated since the last object trace */
 	uintptr_t _traceAllocationBytesCurrentTLH; /**< keep the bytes of times of sampling threshold for last object trace(include allocation bytes inside TLH) */
+	uintptr_t _pretenureSampleCountdown; /**< allocations with a site token left before the next one is sampled for the pretenure profile */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -618,6 +620,8 @@ public:
 	MMINLINE uintptr_t getWorkUnitToHandle() { return _workUnitToHandle; }
 	MMINLINE void setWorkUnitToHandle(uintptr_t workUnitToHandle) { _workUnitToHandle = workUnitToHandle; }
 	MMINLINE uintptr_t nextWorkUnitIndex() { return _workUnitIndex++; }
+	MMINLINE uintptr_t getSynchronizeSlot() { return _synchronizeSlot; }
+	MMINLINE void setSynchronizeSlot(uintptr_t synchronizeSlot) { _synchronizeSlot = synchronizeSlot; }
 	MMINLINE void resetWorkUnitIndex() {
 		_workUnitIndex = 1;
 		_workUnitToHandle = 0;
@@ -717,6 +721,7 @@ public:
 		,_delegate()
 		,_workUnitIndex(0)
 		,_workUnitToHandle(0)
+		,_synchronizeSlot(0)
 		,_threadScanned(false)
 		,_allocationContext(NULL)
 		,_commonAllocationContext(NULL)
@@ -746,6 +751,7 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_pretenureSampleCountdown(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -775,6 +781,7 @@ public:
 		,_portLibrary(omrVM->_runtime->_portLibrary)
 		,_workUnitIndex(0)
 		,_workUnitToHandle(0)
+		,_synchronizeSlot(0)
 		,_threadScanned(false)
 		,_allocationContext(NULL)
 		,_commonAllocationContext(NULL)
@@ -804,6 +811,7 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_pretenureSampleCountdown(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -61,7 +61,13 @@ class MM_GlobalCollector;
 class MM_Heap;
 class MM_HeapMap;
 class MM_HeapRegionManager;
+class MM_HeapVerifier;
+#if defined(OMR_GC_MODRON_STANDARD)
+class MM_HugeObjectSpace;
+class MM_PretenureProfile;
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 
+class MM_IdleHeapRelease;
 class MM_InterRegionRememberedSet;
 class MM_MemoryManager;
 class MM_MemorySubSpace;
@@ -71,6 +77,7 @@ class MM_ObjectMap;
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 class MM_ReferenceChainWalkerMarkMap;
 class MM_RememberedSetCardBucket;
+class MM_RememberedSetSummary;
 #if defined(OMR_GC_REALTIME)
 class MM_RememberedSetSATB;
 #endif /* defined(OMR_GC_REALTIME) */
@@ -288,6 +295,9 @@ public:
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
+	MM_RememberedSetSummary *rememberedSetSummary; /**< per-chunk record of remembered objects that did not fit in rememberedSet, NULL until the first scavenge */
+	uintptr_t scavengerRememberedSetMaximumSize; /**< bytes the remembered set list may grow to before remembered objects are recorded in rememberedSetSummary, 0 for no limit */
+	uintptr_t scavengerRememberedSetSummaryChunkSize; /**< bytes of heap covered by each rememberedSetSummary entry (rounded down to a power of 2) */
 	uintptr_t oldHeapSizeOnLastGlobalGC;
 	uintptr_t freeOldHeapSizeOnLastGlobalGC;
 	float concurrentKickoffTenuringHeadroom; /**< percentage of free memory remaining in tenure heap. Used in conjunction with free memory to determine concurrent mark kickoff */
@@ -348,6 +358,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	uintptr_t tlhClearAheadSize; /**< if non-zero, a fresh batch cleared TLH is cleared in steps of this many bytes with non-temporal stores as allocation reaches them, rather than all at refresh */
+	uintptr_t tlhPrefetchDistance; /**< if non-zero, the line this many bytes ahead of the TLH allocation pointer is prefetched for write after each allocation */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -378,6 +390,14 @@ public:
 	ConcurrentMetering concurrentMetering;
 	uintptr_t minimumContractionRatio;
 #endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+#if defined(OMR_GC_MODRON_STANDARD)
+	MM_HugeObjectSpace *hugeObjectSpace; /**< off-heap space for objects of at least hugeObjectThreshold bytes, NULL if not enabled */
+	uintptr_t hugeObjectThreshold; /**< minimum size in bytes of objects allocated in the huge object space, 0 to disable it */
+	uintptr_t hugeObjectSpaceMaximumSize; /**< bytes the huge object space may reserve before allocation triggers a global collect, 0 for memoryMax */
+	bool verifyHeapBeforeGC; /**< True if the heap is verified by all GC threads before each collection */
+	bool verifyHeapAfterGC; /**< True if the heap is verified by all GC threads after each collection */
+	MM_HeapVerifier *heapVerifier; /**< parallel heap verifier, NULL unless heap verification is enabled */
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 
 	bool disableExplicitGC;
 	uintptr_t heapAlignment;
@@ -465,6 +485,7 @@ public:
 	bool gcThreadCountSpecified; /**< true if number of GC threads is specified in command line options. */
 	bool gcThreadCountForced; /**< true if user forced a fixed number of GC threads. Default is false, but a command line option could set it if not wanting adaptive threading */
 	uintptr_t dispatcherHybridNotifyThreadBound; /**< Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	uintptr_t gcThreadBarrierSpinCount; /**< Iterations GC threads spin at a synchronization point, or waiting for a task, before parking */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -592,6 +613,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactPartial; /**< if true, a compaction triggered by a large allocation only compacts the cheapest heap window able to satisfy it */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -605,6 +627,8 @@ public:
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
+	bool concurrentKickoffForecast; /**< kick off concurrent mark from a forecast of the allocation and marking rates rather than the tuned threshold */
+	uintptr_t concurrentKickoffForecastMargin; /**< percentage added to the forecast consumption of free memory during marking */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
 
@@ -744,6 +768,19 @@ public:
 	};
 	HeapInitializationFailureReason heapInitializationFailureReason; /**< Error code provided additional information about heap initialization failure */
 	bool scavengerAlignHotFields; /**< True if the scavenger is to check the hot field description for an object in order to better cache align it when tenuring (enabled with the -Xgc:hotAlignment option) */
+	bool scavengerHotFieldProfiling; /**< True if the scavenger samples reference fields per class and depth copies the profiled hot fields of objects it tenures (for languages that do not declare hot fields) */
+	uintptr_t scavengerHotFieldProfileSampleInterval; /**< Each scavenger thread samples the reference fields of one in this many objects it scans */
+	uintptr_t scavengerHotFieldProfileTableSize; /**< Number of classes that can be profiled (rounded up to a power of 2) */
+	uintptr_t scavengerHotFieldProfileMinimumSamples; /**< Number of samples a class needs before its hot fields are (re)ranked */
+	bool scavengerHotFieldProfileReport; /**< True if the per-class hot field profile and cache line co-location achieved are printed after each scavenge */
+	bool scavengerPretenuring; /**< True if objects from allocation sites whose objects are nearly always tenured are allocated directly in tenure space */
+	uintptr_t scavengerPretenureThreshold; /**< Percentage of the new space allocations of a site that must be tenured for the site to be pretenured */
+	uintptr_t scavengerPretenureSampleInterval; /**< Each mutator thread samples one in this many of its allocations with a site token */
+	uintptr_t scavengerPretenureTableSize; /**< Number of allocation sites that can be profiled (rounded up to a power of 2) */
+	uintptr_t scavengerPretenureMinimumSamples; /**< Number of allocation samples a site needs before its pretenure decision is (re)made */
+	bool scavengerPretenureReport; /**< True if the per-site tenure rates and pretenure decisions are printed after each scavenge */
+	MM_PretenureProfile *pretenureProfile; /**< per-site tenure profile consulted on allocation, NULL unless scavengerPretenuring is enabled */
+	uintptr_t scavengerRemapCopyThreshold; /**< Objects at least this large are copied by moving their whole pages where the heap supports it (0 to always copy) */
 	uintptr_t suballocatorInitialSize; /**< the initial chunk size in bytes for the heap suballocator (enabled with the -Xgc:suballocatorInitialSize option) */
 	uintptr_t suballocatorCommitSize; /**< the commit size in bytes for the heap suballocator (enabled with the -Xgc:suballocatorCommitSize option) */
 	uintptr_t suballocatorIncrementSize; /**< the increment size in bytes for the heap suballocator (enabled with the -Xgc:suballocatorIncrementSize option) */
@@ -867,6 +904,8 @@ public:
 	bool pretouchHeapOnExpand; /**< True to pretouch memory during initial heap inflation or heap expansion */
 
 	uintptr_t decommitMinimumFree; /**< percentage of free heap to be retained as committed, default=0 for gencon, complete tenture free memory will be decommitted */
+	uintptr_t idleHeapReleaseDelay; /**< milliseconds without a collection after which free heap pages are released in the background, 0 to disable */
+	MM_IdleHeapRelease *idleHeapRelease; /**< background thread releasing free heap pages, NULL unless idleHeapReleaseDelay is set */
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
@@ -1530,6 +1569,9 @@ public:
 		, sparseHeapSizeRatio(UDATA_MAX)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
+		, rememberedSetSummary(NULL)
+		, scavengerRememberedSetMaximumSize(0)
+		, scavengerRememberedSetSummaryChunkSize(64 * 1024)
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
 		, freeOldHeapSizeOnLastGlobalGC(UDATA_MAX)
 		, concurrentKickoffTenuringHeadroom((float)-1) /* Negative value indicates it was not specified by a command line option */
@@ -1575,6 +1617,8 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhClearAheadSize(0)
+		, tlhPrefetchDistance(0)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1596,6 +1640,14 @@ public:
 		, concurrentMetering(METER_BY_SOA)
 		, minimumContractionRatio(DEFAULT_MINIMUM_CONTRACTION_RATIO)
 #endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+#if defined(OMR_GC_MODRON_STANDARD)
+		, hugeObjectSpace(NULL)
+		, hugeObjectThreshold(0)
+		, hugeObjectSpaceMaximumSize(0)
+		, verifyHeapBeforeGC(false)
+		, verifyHeapAfterGC(false)
+		, heapVerifier(NULL)
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 		, disableExplicitGC(false)
 		, heapAlignment(HEAP_ALIGNMENT)
 		, absoluteMinimumOldSubSpaceSize(MINIMUM_OLD_SPACE_SIZE)
@@ -1667,6 +1719,7 @@ public:
 		, gcThreadCountSpecified(false)
 		, gcThreadCountForced(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, gcThreadBarrierSpinCount(4096)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_NONE)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1771,6 +1824,7 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactPartial(false)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1782,6 +1836,8 @@ public:
 		, concurrentLevel(8)
 		, concurrentBackground(1)
 		, concurrentSlack(0)
+		, concurrentKickoffForecast(false)
+		, concurrentKickoffForecastMargin(10)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
 		, fvtest_concurrentCardTablePreparationDelay(0)
@@ -1878,6 +1934,19 @@ public:
 		, heapCeiling(0) /* default for normal platforms is 0 (i.e. no ceiling) */
 		, heapInitializationFailureReason(HEAP_INITIALIZATION_FAILURE_REASON_NO_ERROR)
 		, scavengerAlignHotFields(true) /* VM Design 1774: hot field alignment is on by default */
+		, scavengerHotFieldProfiling(false)
+		, scavengerHotFieldProfileSampleInterval(64)
+		, scavengerHotFieldProfileTableSize(1024)
+		, scavengerHotFieldProfileMinimumSamples(32)
+		, scavengerHotFieldProfileReport(false)
+		, scavengerPretenuring(false)
+		, scavengerPretenureThreshold(90)
+		, scavengerPretenureSampleInterval(64)
+		, scavengerPretenureTableSize(1024)
+		, scavengerPretenureMinimumSamples(16)
+		, scavengerPretenureReport(false)
+		, pretenureProfile(NULL)
+		, scavengerRemapCopyThreshold(0)
 		, suballocatorInitialSize(SUBALLOCATOR_INITIAL_SIZE) /* default for heap suballocator initial size is 200 MB */
 		, suballocatorCommitSize(SUBALLOCATOR_COMMIT_SIZE) /* default for heap suballocator commit size is 50 MB */
 		, suballocatorIncrementSize(SUBALLOCATOR_INCREMENT_SIZE) /* default for heap suballocator commit size is 8 MB or 256 MB for AIX */
@@ -1973,6 +2042,8 @@ public:
 		, darkMatterSampleRate(32)
 		, pretouchHeapOnExpand(false)
 		, decommitMinimumFree(0)
+		, idleHeapReleaseDelay(0)
+		, idleHeapRelease(NULL)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, gcOnIdle(false)
 		, compactOnIdle(false)
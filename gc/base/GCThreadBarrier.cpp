@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include <string.h>
+#if defined(LINUX)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
+#include "GCThreadBarrier.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+
+MM_GCThreadBarrier *
+MM_GCThreadBarrier::newInstance(MM_EnvironmentBase *env, uintptr_t threadCountMaximum)
+{
+	MM_GCThreadBarrier *barrier = (MM_GCThreadBarrier *)env->getForge()->allocate(sizeof(MM_GCThreadBarrier), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != barrier) {
+		new(barrier) MM_GCThreadBarrier(env);
+		if (!barrier->initialize(env, threadCountMaximum)) {
+			barrier->kill(env);
+			barrier = NULL;
+		}
+	}
+	return barrier;
+}
+
+void
+MM_GCThreadBarrier::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_GCThreadBarrier::initialize(MM_EnvironmentBase *env, uintptr_t threadCountMaximum)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	_threadCountMaximum = threadCountMaximum;
+
+	/* Spinning can only help if another CPU is available to run the thread being waited for */
+	if (1 < omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET)) {
+		_spinCount = env->getExtensions()->gcThreadBarrierSpinCount;
+	}
+
+	/* Size the levels of the tree, from the leaves to a single root */
+	uintptr_t nodeCount = 0;
+	uintptr_t levelWidth = threadCountMaximum;
+	do {
+		Assert_MM_true(_levelCount < GC_THREAD_BARRIER_MAX_LEVELS);
+		levelWidth = (levelWidth + GC_THREAD_BARRIER_FAN_IN - 1) / GC_THREAD_BARRIER_FAN_IN;
+		_levelOffset[_levelCount] = nodeCount;
+		nodeCount += levelWidth;
+		_levelCount += 1;
+	} while (1 < levelWidth);
+	_levelOffset[_levelCount] = nodeCount;
+
+	uintptr_t nodeBytes = nodeCount * sizeof(Node);
+	_nodeMemory = env->getForge()->allocate(nodeBytes + GC_THREAD_BARRIER_NODE_SIZE, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _nodeMemory) {
+		return false;
+	}
+	_nodes = (Node *)(((uintptr_t)_nodeMemory + GC_THREAD_BARRIER_NODE_SIZE - 1) & ~(uintptr_t)(GC_THREAD_BARRIER_NODE_SIZE - 1));
+	memset((void *)_nodes, 0, nodeBytes);
+
+#if !defined(LINUX)
+	if (0 != omrthread_monitor_init_with_name(&_parkMonitor, 0, "MM_GCThreadBarrier::park")) {
+		return false;
+	}
+#endif /* !defined(LINUX) */
+
+	reset(threadCountMaximum);
+
+	return true;
+}
+
+void
+MM_GCThreadBarrier::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _nodeMemory) {
+		env->getForge()->free(_nodeMemory);
+		_nodeMemory = NULL;
+		_nodes = NULL;
+	}
+
+	if (NULL != _parkMonitor) {
+		omrthread_monitor_destroy(_parkMonitor);
+		_parkMonitor = NULL;
+	}
+}
+
+void
+MM_GCThreadBarrier::reset(uintptr_t threadCount)
+{
+	Assert_MM_true((0 < threadCount) && (threadCount <= _threadCountMaximum));
+
+	uintptr_t arrivals = threadCount;
+	for (uintptr_t level = 0; level < _levelCount; level++) {
+		uintptr_t activeNodes = (arrivals + GC_THREAD_BARRIER_FAN_IN - 1) / GC_THREAD_BARRIER_FAN_IN;
+		for (uintptr_t index = _levelOffset[level]; index < _levelOffset[level + 1]; index++) {
+			uintptr_t nodeIndex = index - _levelOffset[level];
+			Node *node = &_nodes[index];
+			node->count = 0;
+			if (nodeIndex < activeNodes) {
+				node->expected = OMR_MIN(GC_THREAD_BARRIER_FAN_IN, arrivals - (nodeIndex * GC_THREAD_BARRIER_FAN_IN));
+			} else {
+				node->expected = 0;
+			}
+		}
+		if (1 == activeNodes) {
+			_rootLevel = level;
+			break;
+		}
+		arrivals = activeNodes;
+	}
+
+	_joinCount = 0;
+	_stats.clear();
+}
+
+bool
+MM_GCThreadBarrier::arrive(MM_EnvironmentBase *env, uintptr_t slot)
+{
+	uintptr_t nodeIndex = slot / GC_THREAD_BARRIER_FAN_IN;
+
+	for (uintptr_t level = 0;; level++) {
+		Node *node = &_nodes[_levelOffset[level] + nodeIndex];
+		Assert_MM_true(0 != node->expected);
+		if (MM_AtomicOperations::add(&node->count, 1) < node->expected) {
+			/* Other arrivals are still expected at this node, the last of them continues up the tree */
+			return false;
+		}
+
+		/* All arrivals for this node are in, and none can arrive again before the barrier is released */
+		node->count = 0;
+		if (_rootLevel == level) {
+			return true;
+		}
+		nodeIndex /= GC_THREAD_BARRIER_FAN_IN;
+	}
+}
+
+void
+MM_GCThreadBarrier::release(MM_EnvironmentBase *env)
+{
+	_stats._releaseCount += 1;
+	signalChange(env, &_generation);
+}
+
+void
+MM_GCThreadBarrier::waitForChange(MM_EnvironmentBase *env, volatile uint32_t *word, uint32_t oldValue)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
+	bool parked = false;
+
+	if (!spinForChange(word, oldValue)) {
+		/* Advertise the parked thread before the final check of the word, see signalChange() */
+		parked = true;
+		MM_AtomicOperations::addU32(&_parkedThreads, 1);
+#if defined(LINUX)
+		/* The kernel rechecks the word, so a change after the loop test cannot be missed */
+		while (oldValue == *word) {
+			syscall(SYS_futex, (uint32_t *)word, FUTEX_WAIT_PRIVATE, oldValue, NULL, NULL, 0);
+		}
+#else /* defined(LINUX) */
+		omrthread_monitor_enter(_parkMonitor);
+		while (oldValue == *word) {
+			omrthread_monitor_wait(_parkMonitor);
+		}
+		omrthread_monitor_exit(_parkMonitor);
+#endif /* defined(LINUX) */
+		MM_AtomicOperations::subtractU32(&_parkedThreads, 1);
+	}
+
+	/* Make sure work published before the change is visible to this thread */
+	MM_AtomicOperations::readBarrier();
+
+	if (parked) {
+		MM_AtomicOperations::add(&_stats._parkedCount, 1);
+	} else {
+		MM_AtomicOperations::add(&_stats._spinReleasedCount, 1);
+	}
+	MM_AtomicOperations::addU64(&_stats._waitTime, omrtime_hires_clock() - startTime);
+}
+
+void
+MM_GCThreadBarrier::signalChange(MM_EnvironmentBase *env, volatile uint32_t *word)
+{
+	/* The atomic increment orders this update before the read of the parked count, and the
+	 * parked count increment in waitForChange() orders it before the waiter's last check, so
+	 * either the waiter sees the new value or the parked count includes it.
+	 */
+	MM_AtomicOperations::addU32(word, 1);
+
+	if (0 != _parkedThreads) {
+#if defined(LINUX)
+		syscall(SYS_futex, (uint32_t *)word, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else /* defined(LINUX) */
+		omrthread_monitor_enter(_parkMonitor);
+		omrthread_monitor_notify_all(_parkMonitor);
+		omrthread_monitor_exit(_parkMonitor);
+#endif /* defined(LINUX) */
+	}
+}
@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(GCTHREADBARRIER_HPP_)
+#define GCTHREADBARRIER_HPP_
+
+#include "omrcomp.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/* Number of arrivals combined by each node of the arrival tree */
+#define GC_THREAD_BARRIER_FAN_IN 4
+/* Upper bound on the depth of the arrival tree */
+#define GC_THREAD_BARRIER_MAX_LEVELS 16
+/* Size arrival tree nodes are padded to, so that threads arriving at different nodes do not share a cache line */
+#define GC_THREAD_BARRIER_NODE_SIZE 64
+
+/**
+ * Timing statistics of a GC thread barrier, reset for every task.
+ */
+struct MM_GCThreadBarrierStats {
+	volatile uintptr_t _releaseCount; /**< number of times waiting threads were released */
+	volatile uintptr_t _spinReleasedCount; /**< number of waits that ended while spinning */
+	volatile uintptr_t _parkedCount; /**< number of waits that had to park the thread */
+	volatile uint64_t _waitTime; /**< hi-res ticks spent waiting, summed over all threads */
+
+	void
+	clear()
+	{
+		_releaseCount = 0;
+		_spinReleasedCount = 0;
+		_parkedCount = 0;
+		_waitTime = 0;
+	}
+};
+
+/**
+ * Barrier used to synchronize the GC threads running a task.
+ *
+ * Threads arrive through a combining tree of GC_THREAD_BARRIER_FAN_IN wide nodes, so that
+ * contention on any one counter is bounded by the fan in rather than the thread count. The
+ * last thread to arrive at the root completes the arrival. Waiting threads watch a 32 bit
+ * generation word: they spin for gcThreadBarrierSpinCount iterations and then park, on a futex
+ * on Linux and on a monitor elsewhere. Releasing a barrier increments the generation and only
+ * wakes threads when some are parked.
+ *
+ * Each thread running a task takes a unique slot in [0, threadCount) by calling join() once
+ * per task; the slot selects the leaf of the tree it arrives at.
+ *
+ * @ingroup GC_Base
+ */
+class MM_GCThreadBarrier : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct Node {
+		volatile uintptr_t count; /**< arrivals at this node for the current synchronization */
+		uintptr_t expected; /**< arrivals completing this node, 0 if unused for the current thread count */
+		uint8_t padding[GC_THREAD_BARRIER_NODE_SIZE - (2 * sizeof(uintptr_t))];
+	};
+
+	Node *_nodes; /**< arrival tree, stored level by level starting with the leaves */
+	void *_nodeMemory; /**< unaligned allocation holding _nodes */
+	uintptr_t _levelOffset[GC_THREAD_BARRIER_MAX_LEVELS + 1]; /**< index in _nodes of the first node of every level, and the node count */
+	uintptr_t _levelCount; /**< number of levels of the tree for the maximum thread count */
+	uintptr_t _rootLevel; /**< level of the root for the current thread count */
+	uintptr_t _threadCountMaximum; /**< largest thread count the tree was sized for */
+	uintptr_t _spinCount; /**< iterations to spin before parking */
+	volatile uintptr_t _joinCount; /**< slots handed out by join() for the current task */
+	volatile uint32_t _generation; /**< incremented by release() */
+	volatile uint32_t _arrivalGeneration; /**< incremented by notifyArrival() */
+	volatile uint32_t _parkedThreads; /**< threads parked, or about to park, on either word */
+	omrthread_monitor_t _parkMonitor; /**< used to park threads on platforms without futexes */
+
+	MM_GCThreadBarrierStats _stats;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Wait for the value of a barrier word to change, spinning first and then parking.
+	 */
+	void waitForChange(MM_EnvironmentBase *env, volatile uint32_t *word, uint32_t oldValue);
+
+	/**
+	 * Increment a barrier word and wake any threads parked on it.
+	 */
+	void signalChange(MM_EnvironmentBase *env, volatile uint32_t *word);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t threadCountMaximum);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_GCThreadBarrier *newInstance(MM_EnvironmentBase *env, uintptr_t threadCountMaximum);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Prepare the barrier for a task. Must be called before the threads running the task join.
+	 * @param[in] threadCount number of threads that will synchronize on the barrier
+	 */
+	void reset(uintptr_t threadCount);
+
+	/**
+	 * Take a slot in the barrier for the current task.
+	 * @return the slot, to be passed to arrive()
+	 */
+	MMINLINE uintptr_t join() { return MM_AtomicOperations::add(&_joinCount, 1) - 1; }
+
+	/**
+	 * Arrive at the barrier.
+	 * @param[in] slot the slot returned by join()
+	 * @return true if this was the last thread to arrive
+	 */
+	bool arrive(MM_EnvironmentBase *env, uintptr_t slot);
+
+	/**
+	 * The generation and arrival generation must be read before arriving, and passed to the
+	 * matching wait once arrived.
+	 */
+	MMINLINE uint32_t getGeneration() { return _generation; }
+	MMINLINE uint32_t getArrivalGeneration() { return _arrivalGeneration; }
+
+	/**
+	 * Wait until the barrier is released past the given generation.
+	 */
+	MMINLINE void waitForRelease(MM_EnvironmentBase *env, uint32_t generation) { waitForChange(env, &_generation, generation); }
+
+	/**
+	 * Release all threads waiting on the current generation.
+	 */
+	void release(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait until the last thread has arrived, for a thread that did not arrive last but must
+	 * continue once all threads have arrived.
+	 */
+	MMINLINE void waitForArrival(MM_EnvironmentBase *env, uint32_t arrivalGeneration) { waitForChange(env, &_arrivalGeneration, arrivalGeneration); }
+
+	/**
+	 * Called by the last thread to arrive to wake a thread blocked in waitForArrival().
+	 */
+	MMINLINE void notifyArrival(MM_EnvironmentBase *env) { signalChange(env, &_arrivalGeneration); }
+
+	/**
+	 * Spin, without parking, until the value of a word changes or the spin count is exhausted.
+	 * @param[in] word the word to watch, which need not belong to the barrier
+	 * @param[in] oldValue the value the word is expected to change from
+	 * @return true if the word changed
+	 */
+	MMINLINE bool
+	spinForChange(volatile uint32_t *word, uint32_t oldValue)
+	{
+		for (uintptr_t spinCount = _spinCount; 0 < spinCount; spinCount--) {
+			if (oldValue != *word) {
+				return true;
+			}
+			MM_AtomicOperations::yieldCPU();
+		}
+		return oldValue != *word;
+	}
+
+	MMINLINE MM_GCThreadBarrierStats *getStats() { return &_stats; }
+
+	MM_GCThreadBarrier(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _nodes(NULL)
+		, _nodeMemory(NULL)
+		, _levelCount(0)
+		, _rootLevel(0)
+		, _threadCountMaximum(0)
+		, _spinCount(0)
+		, _joinCount(0)
+		, _generation(0)
+		, _arrivalGeneration(0)
+		, _parkedThreads(0)
+		, _parkMonitor(NULL)
+	{
+		_typeId = __FUNCTION__;
+		_stats.clear();
+	}
+};
+
+#endif /* GCTHREADBARRIER_HPP_ */
@@ -125,6 +125,13 @@ public:
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
 
+	/**
+	 * Move the pages backing a page aligned range to another page aligned range of the heap without copying them.
+	 * On success the source range reads as zeros, on failure neither range is changed.
+	 * @return true if the pages were moved, false if the heap memory does not support it
+	 */
+	virtual bool moveMemory(void *source, void *target, uintptr_t size) { return false; }
+
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
 	void resetHeapStatistics(bool globalCollect);
@@ -326,6 +326,18 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+/**
+ * Move the pages backing the source range to the target range.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::moveMemory(void* source, void* target, uintptr_t size)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	return memoryManager->moveMemory(&_vmemHandle, source, target, size);
+}
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
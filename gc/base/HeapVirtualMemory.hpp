@@ -65,6 +65,7 @@ public:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+	virtual bool moveMemory(void* source, void* target, uintptr_t size);
 
 	virtual uintptr_t calculateOffsetFromHeapBase(void* address);
 
@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "j9nongenerated.h"
+#include "omrport.h"
+#include "mmprivatehook.h"
+#include "ModronAssertions.h"
+
+#include "IdleHeapRelease.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "ParallelDispatcher.hpp"
+
+MM_IdleHeapRelease::MM_IdleHeapRelease(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _monitor(NULL)
+	, _threadState(STATE_ERROR)
+	, _lastCollectionTime(0)
+	, _collectionCount(0)
+	, _releasedCollectionCount(0)
+	, _releaseCount(0)
+	, _releasedBytes(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_IdleHeapRelease *
+MM_IdleHeapRelease::newInstance(MM_EnvironmentBase *env)
+{
+	MM_IdleHeapRelease *idleHeapRelease = (MM_IdleHeapRelease *)env->getForge()->allocate(sizeof(MM_IdleHeapRelease), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != idleHeapRelease) {
+		new(idleHeapRelease) MM_IdleHeapRelease(env);
+		if (!idleHeapRelease->initialize(env)) {
+			idleHeapRelease->kill(env);
+			idleHeapRelease = NULL;
+		}
+	}
+	return idleHeapRelease;
+}
+
+void
+MM_IdleHeapRelease::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_IdleHeapRelease::initialize(MM_EnvironmentBase *env)
+{
+	return 0 == omrthread_monitor_init_with_name(&_monitor, 0, "MM_IdleHeapRelease::_monitor");
+}
+
+void
+MM_IdleHeapRelease::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+int J9THREAD_PROC
+MM_IdleHeapRelease::idle_release_thread_proc(void *info)
+{
+	MM_IdleHeapRelease *idleHeapRelease = (MM_IdleHeapRelease *)info;
+	MM_GCExtensionsBase *extensions = idleHeapRelease->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(idle_release_thread_proc2, info,
+			extensions->dispatcher->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+uintptr_t
+MM_IdleHeapRelease::idle_release_thread_proc2(OMRPortLibrary *portLib, void *info)
+{
+	MM_IdleHeapRelease *idleHeapRelease = (MM_IdleHeapRelease *)info;
+	/* this method will NOT return */
+	idleHeapRelease->threadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+bool
+MM_IdleHeapRelease::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not report its state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_threadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		idle_release_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (STATE_ERROR != _threadState);
+	} else {
+		_threadState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_IdleHeapRelease::shutdown()
+{
+	omrthread_monitor_enter(_monitor);
+	if (STATE_ERROR != _threadState) {
+		while (STATE_TERMINATED != _threadState) {
+			_threadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_IdleHeapRelease::collectionCompleted(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	omrthread_monitor_enter(_monitor);
+	_lastCollectionTime = omrtime_hires_clock();
+	_collectionCount += 1;
+	omrthread_monitor_notify(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_IdleHeapRelease::threadEntryPoint()
+{
+	OMR_VM *omrVM = _extensions->getOmrVM();
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(omrVM, "GC Idle Heap Release", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_monitor);
+	if (NULL == omrVMThread) {
+		/* notify the creating thread that we failed to start up */
+		_threadState = STATE_ERROR;
+		omrthread_monitor_notify(_monitor);
+		omrthread_exit(_monitor);
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t const delayMillis = _extensions->idleHeapReleaseDelay;
+
+	_threadState = STATE_WAITING;
+	omrthread_monitor_notify(_monitor);
+	while (STATE_TERMINATION_REQUESTED != _threadState) {
+		if (_releasedCollectionCount == _collectionCount) {
+			/* nothing has been freed since the last release (or startup), wait for a collection */
+			omrthread_monitor_wait(_monitor);
+		} else {
+			uint64_t idleMillis = omrtime_hires_delta(_lastCollectionTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+			if (idleMillis >= delayMillis) {
+				_releasedCollectionCount = _collectionCount;
+				omrthread_monitor_exit(_monitor);
+				releaseFreeMemoryPages(env);
+				omrthread_monitor_enter(_monitor);
+			} else {
+				omrthread_monitor_wait_timed(_monitor, (int64_t)(delayMillis - idleMillis), 0);
+			}
+		}
+	}
+
+	_threadState = STATE_TERMINATED;
+	omrthread_monitor_notify(_monitor);
+	MM_EnvironmentBase::detachVMThread(omrVM, omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_IdleHeapRelease::releaseFreeMemoryPages(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_MemorySpace *memorySpace = _extensions->heap->getDefaultMemorySpace();
+	MM_MemorySubSpace *memorySubSpace = memorySpace->getTenureMemorySubSpace();
+	if (NULL == memorySubSpace) {
+		memorySubSpace = memorySpace->getDefaultMemorySubSpace();
+	}
+
+	/* free lists only change under the heap lock or while the world is stopped, so stop the world
+	 * to keep the release from racing a collection that is rebuilding them
+	 */
+	env->acquireExclusiveVMAccess();
+	if (_releasedCollectionCount != _collectionCount) {
+		/* a collection completed while exclusive access was being acquired, so the heap is not idle */
+		env->releaseExclusiveVMAccess();
+		return;
+	}
+	uint64_t startTime = omrtime_hires_clock();
+	uintptr_t releasedBytes = memorySpace->releaseFreeMemoryPages(env, MEMORY_TYPE_OLD);
+	uint64_t endTime = omrtime_hires_clock();
+	uintptr_t activeMemorySize = memorySubSpace->getActiveMemorySize();
+	env->releaseExclusiveVMAccess();
+
+	_releaseCount += 1;
+	_releasedBytes += releasedBytes;
+
+	TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		endTime,
+		J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+		HEAP_RELEASE_FREE_PAGES,
+		memorySubSpace->getTypeFlags(),
+		/* GC Time Ratio not applicable for "release free heap pages" */
+		0,
+		releasedBytes,
+		activeMemorySize,
+		omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		/* reason enum variable not applicable/used, so passing univeral value 1 = not found */
+		1
+		);
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(IDLEHEAPRELEASE_HPP_)
+#define IDLEHEAPRELEASE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Background thread that gives the physical memory backing free heap pages back to the
+ * operating system once no collection has completed for GCExtensionsBase::idleHeapReleaseDelay
+ * milliseconds.
+ *
+ * The pages after the header of every free list entry (and the free regions of a segregated
+ * heap) are decommitted through MM_MemorySpace::releaseFreeMemoryPages() under exclusive VM
+ * access. Decommitted pages stay reserved and mapped, so the allocator recommits them lazily
+ * when it next touches them and no allocation path needs to know that they were released.
+ * The heap is released at most once per idle period: another release is only considered after
+ * a later collection has rebuilt the free lists.
+ *
+ * Releases are reported through J9HOOK_MM_PRIVATE_HEAP_RESIZE as HEAP_RELEASE_FREE_PAGES, the
+ * same way as releases requested by an idle system collect.
+ */
+class MM_IdleHeapRelease : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum IdleHeapReleaseState {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} IdleHeapReleaseState;
+
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _monitor; /**< guards the thread state and the collection counters */
+	volatile IdleHeapReleaseState _threadState; /**< state of the background thread */
+	uint64_t _lastCollectionTime; /**< raw timestamp of the end of the last collection */
+	uintptr_t _collectionCount; /**< collections completed since startup */
+	uintptr_t _releasedCollectionCount; /**< value of _collectionCount when free pages were last released */
+	uintptr_t _releaseCount; /**< number of idle releases performed */
+	uintptr_t _releasedBytes; /**< total bytes released by idle releases */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_IdleHeapRelease *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the background thread, waiting until it reports whether it attached.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Ask the background thread to terminate and wait until it has detached.
+	 */
+	void shutdown();
+
+	/**
+	 * Restart the idle period. Called at the end of every outermost collection.
+	 * @param env[in] the thread completing the collection
+	 */
+	void collectionCompleted(MM_EnvironmentBase *env);
+
+	/**
+	 * @return number of idle releases performed so far
+	 */
+	MMINLINE uintptr_t getReleaseCount() { return _releaseCount; }
+
+	/**
+	 * @return total bytes decommitted by idle releases so far
+	 */
+	MMINLINE uintptr_t getReleasedBytes() { return _releasedBytes; }
+
+	MM_IdleHeapRelease(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	static int J9THREAD_PROC idle_release_thread_proc(void *info);
+	static uintptr_t idle_release_thread_proc2(OMRPortLibrary *portLib, void *info);
+
+	/**
+	 * Body of the background thread: sleep until the heap has been idle for the release delay,
+	 * release free pages once, then wait for the next collection to start a new idle period.
+	 */
+	void threadEntryPoint();
+
+	/**
+	 * Decommit free heap pages under exclusive VM access and report the release, unless a
+	 * collection completed after the idle period was detected.
+	 * @param env[in] the background thread
+	 */
+	void releaseFreeMemoryPages(MM_EnvironmentBase *env);
+};
+
+#endif /* IDLEHEAPRELEASE_HPP_ */
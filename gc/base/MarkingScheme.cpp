@@ -34,6 +34,9 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "HugeObjectSpace.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
 #include "Task.hpp"
@@ -234,6 +237,33 @@ MM_MarkingScheme::isMarkedOutline(omrobjectptr_t objectPtr)
 	return isMarked(objectPtr);
 }
 
+#if defined(OMR_GC_MODRON_STANDARD)
+bool
+MM_MarkingScheme::markHugeObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool leafType)
+{
+	Assert_GC_true_with_message(env, objectPtr != J9_INVALID_OBJECT, "Invalid object pointer %p\n", objectPtr);
+	Assert_MM_objectAligned(env, objectPtr);
+
+	if (!_extensions->hugeObjectSpace->atomicSetMarked(objectPtr)) {
+		return false;
+	}
+
+	if (!leafType) {
+		env->_workStack.push(env, (void *)objectPtr);
+	}
+
+	env->_markStats._objectsMarked += 1;
+
+	return true;
+}
+
+bool
+MM_MarkingScheme::isHugeObjectMarked(omrobjectptr_t objectPtr)
+{
+	return _extensions->hugeObjectSpace->isMarked(objectPtr);
+}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
 bool
 MM_MarkingScheme::markObjectNoCheck(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool leafType)
 {
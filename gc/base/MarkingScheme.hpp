@@ -136,6 +136,11 @@ public:
 	MMINLINE bool
 	inlineMarkObjectNoCheck(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool leafType = false)
 	{
+#if defined(OMR_GC_MODRON_STANDARD)
+		if ((NULL != _extensions->hugeObjectSpace) && !isHeapObject(objectPtr)) {
+			return markHugeObject(env, objectPtr, leafType);
+		}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 		assertSaneObjectPtr(env, objectPtr);
 
 		/* If bit not already set in mark map then set it */
@@ -187,8 +192,21 @@ public:
 	 */
 	bool markObjectNoCheck(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool leafType = false);
 
+#if defined(OMR_GC_MODRON_STANDARD)
+	/**
+	 * Mark an object allocated in the huge object space, which has no mark map coverage.
+	 * @see inlineMarkObjectNoCheck()
+	 */
+	bool markHugeObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool leafType);
+
+	/**
+	 * Test marked status of an object allocated in the huge object space.
+	 */
+	bool isHugeObjectMarked(omrobjectptr_t objectPtr);
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
 	/**
-	 * Test marked status of object. Everything off-heap is considered to be marked.
+	 * Test marked status of object. Everything off-heap, other than huge objects, is considered to be marked.
 	 * @param[in] obejctPtr object to test
 	 * @return true if object is marked (or off heap)
 	 */
@@ -200,6 +218,10 @@ public:
 		/* Everything off-heap is considered marked, everything on-heap must be checked */
 		if (isHeapObject(objectPtr)) {
 			marked = _markMap->isBitSet(objectPtr);
+#if defined(OMR_GC_MODRON_STANDARD)
+		} else if (NULL != _extensions->hugeObjectSpace) {
+			marked = isHugeObjectMarked(objectPtr);
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 		}
 
 		return marked;
@@ -632,6 +632,15 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle *handle, void *address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+bool
+MM_MemoryManager::moveMemory(MM_MemoryHandle *handle, void *source, void *target, uintptr_t size)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory *memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	return memory->moveMemory(source, target, size);
+}
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase *env, uintptr_t pageSize)
 {
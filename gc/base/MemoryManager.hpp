@@ -199,6 +199,17 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle *handle, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
 
+	/**
+	 * Move the pages backing a range of specified virtual memory instance to another range of it
+	 *
+	 * @param pointer to memory handle
+	 * @param source page aligned start address of memory should be moved
+	 * @param target page aligned start address memory should be moved to
+	 * @param size size of memory should be moved, multiple of the page size
+	 * @return true if succeed
+	 */
+	bool moveMemory(MM_MemoryHandle *handle, void *source, void *target, uintptr_t size);
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
@@ -158,14 +158,25 @@ MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env)
 	omrthread_monitor_enter(_workerThreadMutex);
 
 	while (worker_status_dying != _statusTable[workerID]) {
+		/* Tasks of a collection are dispatched back to back, so watch for the next one before parking */
+		bool spun = false;
+
 		/* Wait for a task to be dispatched to the worker thread */
 		while (worker_status_waiting == _statusTable[workerID]) {
 			if (_workerThreadsReservedForGC && (_threadsToReserve > 0)) {
 				_threadsToReserve -= 1;
 				_statusTable[workerID] = worker_status_reserved;
 				_taskTable[workerID] = _task;
+			} else if (!spun) {
+				spun = true;
+				uint32_t dispatchGeneration = _dispatchGeneration;
+				omrthread_monitor_exit(_workerThreadMutex);
+				_synchronizeBarrier->spinForChange(&_dispatchGeneration, dispatchGeneration);
+				omrthread_monitor_enter(_workerThreadMutex);
 			} else {
+				_parkedWorkerCount += 1;
 				omrthread_monitor_wait(_workerThreadMutex);
+				_parkedWorkerCount -= 1;
 			}
 		}
 
@@ -240,6 +251,11 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		_synchronizeMutex = NULL;
 	}
 
+	if (NULL != _synchronizeBarrier) {
+		_synchronizeBarrier->kill(env);
+		_synchronizeBarrier = NULL;
+	}
+
 	if (NULL != _taskTable) {
 		forge->free(_taskTable);
 		_taskTable = NULL;
@@ -277,6 +293,11 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	_synchronizeBarrier = MM_GCThreadBarrier::newInstance(env, _threadCountMaximum);
+	if (NULL == _synchronizeBarrier) {
+		goto error_no_memory;
+	}
+
 	/* Initialize the thread tables */
 	_threadTable = (omrthread_t *)forge->allocate(_threadCountMaximum * sizeof(omrthread_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _threadTable) {
@@ -407,6 +428,8 @@ MM_ParallelDispatcher::shutDownThreads()
 	 */
 	_threadCount = 1;
 
+	/* Stop spinning workers from waiting out their spin */
+	MM_AtomicOperations::addU32(&_dispatchGeneration, 1);
 	wakeUpThreads(_threadShutdownCount);
 	omrthread_monitor_exit(_workerThreadMutex);
 
@@ -426,6 +449,9 @@ MM_ParallelDispatcher::shutDownThreads()
 void
 MM_ParallelDispatcher::wakeUpThreads(uintptr_t count)
 {
+	/* Workers that are spinning will see the reservation without a notify */
+	count = OMR_MIN(count, _parkedWorkerCount);
+
 	/* This thread should notify and release _workerThreadMutex asap. Threads waking up will need to
 	 * reacquire the mutex before proceeding with the task.
 	 *
@@ -537,6 +563,8 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	_task = task;
 
 	task->setSynchronizeMutex(_synchronizeMutex);
+	_synchronizeBarrier->reset(activeThreads);
+	task->setSynchronizeBarrier(_synchronizeBarrier);
 
 	/* Main thread will be used - update status */
 	_statusTable[env->getWorkerID()] = worker_status_reserved;
@@ -545,6 +573,7 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	/* Main thread doesn't need to be woken up */
 	Assert_MM_true(0 == _threadsToReserve);
 	_threadsToReserve = activeThreads - 1;
+	MM_AtomicOperations::addU32(&_dispatchGeneration, 1);
 	wakeUpThreads(_threadsToReserve);
 
 	omrthread_monitor_exit(_workerThreadMutex);
@@ -583,6 +612,9 @@ MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 	_workerThreadsReservedForGC = false;
 	Assert_MM_true(_threadsToReserve == 0);
 	_task = NULL;
+
+	MM_GCThreadBarrierStats *barrierStats = _synchronizeBarrier->getStats();
+	Trc_MM_ParallelDispatcher_synchronizeBarrierStats(barrierStats->_releaseCount, barrierStats->_spinReleasedCount, barrierStats->_parkedCount, barrierStats->_waitTime);
 	
 	if (_inShutdown) {
 		omrthread_monitor_notify_all(_workerThreadMutex);
@@ -796,6 +828,11 @@ MM_ParallelDispatcher::reinitializeThreadPool(MM_EnvironmentBase *env, uintptr_t
 		 }
 		 memset(taskTableTemp, 0, newPoolSize * sizeof(MM_Task *));
 
+		 MM_GCThreadBarrier *synchronizeBarrierTemp = MM_GCThreadBarrier::newInstance(env, newPoolSize);
+		 if (NULL == synchronizeBarrierTemp) {
+			 goto error_no_memory;
+		 }
+
 		 for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
 			 threadTableTemp[index] =_threadTable[index];
 			 statusTableTemp[index] = _statusTable[index];
@@ -811,6 +848,9 @@ MM_ParallelDispatcher::reinitializeThreadPool(MM_EnvironmentBase *env, uintptr_t
 		forge->free(_threadTable);
 		_threadTable = threadTableTemp;
 
+		_synchronizeBarrier->kill(env);
+		_synchronizeBarrier = synchronizeBarrierTemp;
+
 		_poolMaxCapacity = newPoolSize;
 	}
 
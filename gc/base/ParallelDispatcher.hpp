@@ -37,6 +37,7 @@
 #include "BaseVirtual.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GCThreadBarrier.hpp"
 
 class MM_EnvironmentBase;
 
@@ -70,6 +71,9 @@ protected:
 	/* Task as they are dispatched.  For now, since there is only one task active at any time, a */
 	/* single mutex is sufficient */
 	omrthread_monitor_t _synchronizeMutex;
+	MM_GCThreadBarrier *_synchronizeBarrier; /**< Barrier the threads running a task synchronize on */
+	volatile uint32_t _dispatchGeneration; /**< Incremented whenever threads are reserved for a task, watched by spinning idle workers */
+	uintptr_t _parkedWorkerCount; /**< Number of idle workers waiting on _workerThreadMutex, as opposed to spinning */
 	
 	bool _workerThreadsReservedForGC;  /**< States whether or not the worker threads are currently taking part in a GC */
 	bool _inShutdown;  /**< Shutdown request is received */
@@ -211,6 +215,7 @@ public:
 	MMINLINE uintptr_t threadCount() { return _threadCount; }
 	MMINLINE uintptr_t threadCountMaximum() { return _threadCountMaximum; }
 	MMINLINE omrthread_t *getThreadTable() { return _threadTable; }
+	MMINLINE MM_GCThreadBarrier *getSynchronizeBarrier() { return _synchronizeBarrier; }
 	MMINLINE uintptr_t activeThreadCount() { return _activeThreadCount; }
 
 	MMINLINE omrsig_handler_fn getSignalHandler() {return _handler;}
@@ -232,6 +237,9 @@ public:
 		,_workerThreadMutex(NULL)
 		,_dispatcherMonitor(NULL)
 		,_synchronizeMutex(NULL)
+		,_synchronizeBarrier(NULL)
+		,_dispatchGeneration(0)
+		,_parkedWorkerCount(0)
 		,_workerThreadsReservedForGC(false)
 		,_inShutdown(false)
 		,_threadCountMaximum(1)
@@ -69,6 +69,27 @@ MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
 	return envWorkUnitIndex == envWorkUnitToHandle;
 }
 
+void
+MM_ParallelTask::accept(MM_EnvironmentBase *env)
+{
+	env->setSynchronizeSlot(_synchronizeBarrier->join());
+
+	MM_Task::accept(env);
+}
+
+void
+MM_ParallelTask::checkSyncPoint(MM_EnvironmentBase *env, const char *id, const char *caller)
+{
+	/* Threads arrive concurrently, the first to install its id and work unit index defines the sync point */
+	const char *syncPointUniqueId = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointUniqueId, (uintptr_t)NULL, (uintptr_t)id);
+	Assert_GC_true_with_message(env, (NULL == syncPointUniqueId) || (syncPointUniqueId == id),
+		"%s at %p from %s: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, caller, id, syncPointUniqueId);
+
+	uintptr_t syncPointWorkUnitIndex = MM_AtomicOperations::lockCompareExchange(&_syncPointWorkUnitIndex, 0, env->getWorkUnitIndex());
+	Assert_GC_true_with_message(env, (0 == syncPointWorkUnitIndex) || (syncPointWorkUnitIndex == env->getWorkUnitIndex()),
+		"%s at %p from %s: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, caller, env->getWorkUnitIndex(), syncPointWorkUnitIndex);
+}
+
 void
 MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 {
@@ -76,34 +97,16 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 	env->_lastSyncPointReached = id;
 	
 	if(1 < _totalThreadCount) {
-		omrthread_monitor_enter(_synchronizeMutex);
+		uint32_t generation = _synchronizeBarrier->getGeneration();
 
-		/*check synchronization point*/
-		if (0 == _synchronizeCount) {
-			_syncPointUniqueId = id;
-			_syncPointWorkUnitIndex = env->getWorkUnitIndex();
-		} else {
-			Assert_GC_true_with_message(env, _syncPointUniqueId == id,
-				"%s at %p from synchronizeGCThreads: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, id, _syncPointUniqueId);
-			Assert_GC_true_with_message(env, _syncPointWorkUnitIndex == env->getWorkUnitIndex(),
-				"%s at %p from synchronizeGCThreads: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, env->getWorkUnitIndex(), _syncPointWorkUnitIndex);
-		}
-
-		_synchronizeCount += 1;
+		checkSyncPoint(env, id, "synchronizeGCThreads");
 
-		if(_synchronizeCount == _threadCount) {
-			_synchronizeCount = 0;
-			_synchronizeIndex += 1;
-			omrthread_monitor_notify_all(_synchronizeMutex);
+		if (_synchronizeBarrier->arrive(env, env->getSynchronizeSlot())) {
+			releaseSyncPoint();
+			_synchronizeBarrier->release(env);
 		} else {
-			volatile uintptr_t index = _synchronizeIndex;
-
-			do {
-				omrthread_monitor_wait(_synchronizeMutex);
-			} while(index == _synchronizeIndex);
+			_synchronizeBarrier->waitForRelease(env, generation);
 		}
-		omrthread_monitor_exit(_synchronizeMutex);
-
 	}
 
 	Trc_MM_SynchronizeGCThreads_Exit(env->getLanguageVMThread());
@@ -118,48 +121,30 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
-		volatile uintptr_t index = _synchronizeIndex;
-
-		omrthread_monitor_enter(_synchronizeMutex);
+		uint32_t generation = _synchronizeBarrier->getGeneration();
+		uint32_t arrivalGeneration = _synchronizeBarrier->getArrivalGeneration();
 
-		/*check synchronization point*/
-		if (0 == _synchronizeCount) {
-			_syncPointUniqueId = id;
-			_syncPointWorkUnitIndex = env->getWorkUnitIndex();
-		} else {
-			Assert_GC_true_with_message(env, _syncPointUniqueId == id,
-				"%s at %p from synchronizeGCThreadsAndReleaseMain: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, id, _syncPointUniqueId);
-			Assert_GC_true_with_message(env, _syncPointWorkUnitIndex == env->getWorkUnitIndex(),
-				"%s at %p from synchronizeGCThreadsAndReleaseMain: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, env->getWorkUnitIndex(), _syncPointWorkUnitIndex);
-		}
+		checkSyncPoint(env, id, "synchronizeGCThreadsAndReleaseMain");
 
-		_synchronizeCount += 1;
-		if(_synchronizeCount == _threadCount) {
-			if(env->isMainThread()) {
-				omrthread_monitor_exit(_synchronizeMutex);
-				isMainThread = true;
-				_synchronized = true;
-				goto done;
+		bool lastToArrive = _synchronizeBarrier->arrive(env, env->getSynchronizeSlot());
+		if (env->isMainThread()) {
+			if (!lastToArrive) {
+				_synchronizeBarrier->waitForArrival(env, arrivalGeneration);
 			}
-			omrthread_monitor_notify_all(_synchronizeMutex);
-		}
-
-		while(index == _synchronizeIndex) {
-			if(env->isMainThread() && (_synchronizeCount == _threadCount)) {
-				omrthread_monitor_exit(_synchronizeMutex);
-				isMainThread = true;
-				_synchronized = true;
-				goto done;
+			isMainThread = true;
+			_synchronized = true;
+		} else {
+			if (lastToArrive) {
+				/* The main thread is waiting for the last arrival rather than the release */
+				_synchronizeBarrier->notifyArrival(env);
 			}
-			omrthread_monitor_wait(_synchronizeMutex);
+			_synchronizeBarrier->waitForRelease(env, generation);
 		}
-		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
 		isMainThread = true;
 	}
 
-done:
 	Trc_MM_SynchronizeGCThreadsAndReleaseMain_Exit(env->getLanguageVMThread());
 	return isMainThread;	
 }
@@ -173,40 +158,21 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
-		volatile uintptr_t index = _synchronizeIndex;
-		uintptr_t workUnitIndex = env->getWorkUnitIndex();
+		uint32_t generation = _synchronizeBarrier->getGeneration();
 
-		omrthread_monitor_enter(_synchronizeMutex);
-
-		/*check synchronization point*/
-		if (0 == _synchronizeCount) {
-			_syncPointUniqueId = id;
-			_syncPointWorkUnitIndex = workUnitIndex;
-		} else {
-			Assert_GC_true_with_message(env, _syncPointUniqueId == id,
-				"%s at %p from synchronizeGCThreadsAndReleaseSingleThread: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, id, _syncPointUniqueId);
-			Assert_GC_true_with_message(env, _syncPointWorkUnitIndex == env->getWorkUnitIndex(),
-				"%s at %p from synchronizeGCThreadsAndReleaseSingleThread: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, env->getWorkUnitIndex(), _syncPointWorkUnitIndex);
-		}
+		checkSyncPoint(env, id, "synchronizeGCThreadsAndReleaseSingleThread");
 
-		_synchronizeCount += 1;
-		if(_synchronizeCount == _threadCount) {
-			omrthread_monitor_exit(_synchronizeMutex);
+		if (_synchronizeBarrier->arrive(env, env->getSynchronizeSlot())) {
 			isReleasedThread = true;
 			_synchronized = true;
-			goto done;
+		} else {
+			_synchronizeBarrier->waitForRelease(env, generation);
 		}
-
-		do {
-			omrthread_monitor_wait(_synchronizeMutex);
-		} while(index == _synchronizeIndex);
-		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
 		isReleasedThread = true;
 	}
 
-done:
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Exit(env->getLanguageVMThread());
 	return isReleasedThread;
 }
@@ -230,15 +196,11 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 	Assert_GC_true_with_message(env, _synchronized, "%s at %p from releaseSynchronizedGCThreads: call for non-synchronized\n", getBaseVirtualTypeId(), this);
 	/* Could not have gotten here unless all other threads are sync'd - don't check, just release */
 	_synchronized = false;
-	omrthread_monitor_enter(_synchronizeMutex);
-	_synchronizeCount = 0;
-	_synchronizeIndex += 1;
+	releaseSyncPoint();
 	uint64_t notifyStartTime = omrtime_hires_clock();
-	omrthread_monitor_notify_all(_synchronizeMutex);
+	_synchronizeBarrier->release(env);
 
 	addToNotifyStallTime(env, notifyStartTime, omrtime_hires_clock());
-
-	omrthread_monitor_exit(_synchronizeMutex);
 }
 
 void
@@ -258,12 +220,13 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	} else {
 		omrthread_monitor_enter(_synchronizeMutex);
 
-		if (0 == _synchronizeCount) {
-			_syncPointUniqueId = id;
+		/* Threads still waiting at a sync point have installed its id, see checkSyncPoint() */
+		const char *syncPointUniqueId = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointUniqueId, (uintptr_t)NULL, (uintptr_t)id);
+		if (NULL == syncPointUniqueId) {
 			_syncPointWorkUnitIndex = env->getWorkUnitIndex();
 		} else {
-			Assert_GC_true_with_message(env, _syncPointUniqueId == id,
-				"%s at %p from complete: reach end of the task however threads are waiting at (%s)\n", getBaseVirtualTypeId(), this, _syncPointUniqueId);
+			Assert_GC_true_with_message(env, syncPointUniqueId == id,
+				"%s at %p from complete: reach end of the task however threads are waiting at (%s)\n", getBaseVirtualTypeId(), this, syncPointUniqueId);
 			/*
 			 * MM_ParallelScrubCardTableTask is implemented to be aborted if it takes too much time
 			 * An abortion left work unit counters in unpredictable state so it would trigger this assertion
@@ -33,6 +33,7 @@
 #include "omrthread.h"
 
 #include "AtomicOperations.hpp"
+#include "GCThreadBarrier.hpp"
 #include "Task.hpp"
 
 class MM_EnvironmentBase;
@@ -59,14 +60,27 @@ protected:
 	volatile uintptr_t _threadCount;
 	
 	volatile uintptr_t _workUnitIndex;
-	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+	MM_GCThreadBarrier *_synchronizeBarrier; /**< barrier used by the synchronizeGCThreads family of calls */
 public:
 	
 	/*
 	 * Function members
 	 */
+private:
+	/**
+	 * Verify that every thread arriving at a synchronization point is at the same one. The first
+	 * thread to arrive records the point, and releaseSyncPoint() clears it before threads are released.
+	 */
+	void checkSyncPoint(MM_EnvironmentBase *env, const char *id, const char *caller);
+	MMINLINE void
+	releaseSyncPoint()
+	{
+		_syncPointUniqueId = NULL;
+		_syncPointWorkUnitIndex = 0;
+	}
+
 public:
 	virtual bool handleNextWorkUnit(MM_EnvironmentBase *env);
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -77,6 +91,8 @@ public:
 	virtual bool synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id, uint64_t *stallTime);
 	
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex) { _synchronizeMutex = synchronizeMutex; }
+	MMINLINE virtual void setSynchronizeBarrier(MM_GCThreadBarrier *synchronizeBarrier) { _synchronizeBarrier = synchronizeBarrier; }
+	virtual void accept(MM_EnvironmentBase *env);
 	virtual void complete(MM_EnvironmentBase *env);
 
 	/**
@@ -104,9 +120,9 @@ public:
 		,_totalThreadCount(0)
 		,_threadCount(0)
 		,_workUnitIndex(0)
-		,_synchronizeIndex(0)
 		,_synchronizeCount(0)
 		,_synchronizeMutex(NULL)
+		,_synchronizeBarrier(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -169,7 +169,8 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	/* Record the memory space from which the allocation takes place in the AD */
 	allocDescription->setMemorySpace(memorySpace);
 	if (allocDescription->getTenuredFlag()) {
-		Assert_MM_true(shouldCollectOnFailure);
+		/* pretenured allocations (see MM_PretenureProfile) may be made without collecting on failure */
+		Assert_MM_true(shouldCollectOnFailure || (0 != allocDescription->getAllocationSiteToken()));
 		MM_AllocationContext *cac = env->getCommonAllocationContext();
 		if (NULL != cac) {
 			result = cac->allocateObject(env, allocDescription, shouldCollectOnFailure);
@@ -94,6 +94,7 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 
 	/* Clear current information accumulated */
 	setAllZeroes();
+	_clearAheadBytes = 0;
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
 }
@@ -109,6 +110,7 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 
 	/* Clear current information accumulated */
 	setAllZeroes();
+	_clearAheadBytes = 0;
 
 	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
 }
@@ -137,6 +139,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
+	uintptr_t unclearedBytes = restoreTLHTopForClearAhead(env);
 	void *lastTLHobj = restoreTLHTopForGC(env);
 
 	if (NULL != lastTLHobj) {
@@ -147,8 +150,8 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
 
-	/* Try to cache the current TLH */
-	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
+	/* Try to cache the current TLH, unless part of it is not cleared yet (cached TLHs are reused without clearing) */
+	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize) && (0 == unclearedBytes)) {
 		/* Cache the current TLH because it is bigger than the minimum size */
 		MM_HeapLinkedFreeHeaderTLH* newCache = (MM_HeapLinkedFreeHeaderTLH*)getAlloc();
 
@@ -170,6 +173,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	}
 
 	bool didRefresh = false;
+	bool shouldClearAhead = false;
 	/* Try allocating a TLH */
 	if ((NULL != _abandonedList) && (sizeInBytesRequired <= tlhMinimumSize)) {
 		/* Try to get a cached TLH */
@@ -214,9 +218,14 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 			if (_zeroTLH) {
 				if (0 != extensions->batchClearTLH) {
-					void *base = getBase();
-					void *top = getTop();
-					OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					if (0 != extensions->tlhClearAheadSize) {
+						/* Cleared by startClearAhead() once the top is final */
+						shouldClearAhead = true;
+					} else {
+						void *base = getBase();
+						void *top = getTop();
+						OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					}
 				}
 			}
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -260,6 +269,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 			reserveTLHTopForGC(env);
+			if (shouldClearAhead) {
+				startClearAhead(env);
+			}
 		}
 	}
 
@@ -274,9 +286,11 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 
 	Assert_MM_true(!extensions->isSegregatedHeap());
 	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
-	/* If there's insufficient space, refresh the current TLH */
-	if (sizeInBytesRequired > getSize()) {
-		refresh(env, allocDescription, shouldCollectOnFailure);
+	/* If there's insufficient space, clear more of the current TLH or refresh it */
+	if (!clearAhead(env, sizeInBytesRequired)) {
+		if (refresh(env, allocDescription, shouldCollectOnFailure)) {
+			clearAhead(env, sizeInBytesRequired);
+		}
 	}
 
 	/* Try to fit the allocate into the current TLH */
@@ -291,6 +305,7 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 			*_pointerToTlhPrefetchFTA -= (intptr_t)sizeInBytesRequired;
 		}
 #endif /* OMR_GC_TLH_PREFETCH_FTA */
+		prefetchAhead(env);
 		allocDescription->setObjectFlags(getObjectFlags());
 		allocDescription->setMemorySubSpace((MM_MemorySubSpace *)_tlh->memorySubSpace);
 		allocDescription->completedFromTlh();
@@ -318,6 +333,7 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 void
 MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 {
+	restoreTLHTopForClearAhead(env);
 	void *lastTLHobj = restoreTLHTopForGC(env);
 
 	if (NULL != lastTLHobj) {
@@ -434,4 +450,62 @@ MM_TLHAllocationSupport::restoreTLHTopForGC(MM_EnvironmentBase *env)
 
 	return lastTLHobj;
 }
+
+void
+MM_TLHAllocationSupport::startClearAhead(MM_EnvironmentBase *env)
+{
+	uintptr_t clearAheadSize = env->getExtensions()->tlhClearAheadSize;
+	uint8_t *base = (uint8_t *)getBase();
+	uint8_t *top = (uint8_t *)getRealTop();
+	uintptr_t size = (uintptr_t)top - (uintptr_t)base;
+
+	Assert_MM_true(0 == _clearAheadBytes);
+
+	/* The bytes reserved for GC are only used once the TLH is retired, when nothing above them is exposed */
+	if (0 != _reservedBytesForGC) {
+		OMRZeroMemory(top, _reservedBytesForGC);
+	}
+
+	uintptr_t clearSize = size;
+	if ((size - OMR_MIN(size, clearAheadSize)) >= clearAheadSize) {
+		clearSize = clearAheadSize;
+	}
+	OMRZeroMemoryNonTemporal(base, clearSize);
+	setRealTopForAllocation(base + clearSize);
+	_clearAheadBytes = size - clearSize;
+}
+
+bool
+MM_TLHAllocationSupport::clearAhead(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired)
+{
+	uint8_t *clearedTop = (uint8_t *)getRealTop();
+	uintptr_t available = (uintptr_t)clearedTop - (uintptr_t)getAlloc();
+
+	if ((0 != _clearAheadBytes) && (sizeInBytesRequired > available) && ((sizeInBytesRequired - available) <= _clearAheadBytes)) {
+		uintptr_t clearAheadSize = env->getExtensions()->tlhClearAheadSize;
+		uintptr_t clearSize = MM_Math::roundToCeiling(clearAheadSize, sizeInBytesRequired - available);
+		/* Do not leave a tail smaller than a step for another trip through here */
+		if ((_clearAheadBytes - OMR_MIN(_clearAheadBytes, clearSize)) < clearAheadSize) {
+			clearSize = _clearAheadBytes;
+		}
+		OMRZeroMemoryNonTemporal(clearedTop, clearSize);
+		setRealTopForAllocation(clearedTop + clearSize);
+		_clearAheadBytes -= clearSize;
+	}
+
+	return sizeInBytesRequired <= getSize();
+}
+
+uintptr_t
+MM_TLHAllocationSupport::restoreTLHTopForClearAhead(MM_EnvironmentBase *env)
+{
+	uintptr_t unclearedBytes = _clearAheadBytes;
+
+	if (0 != unclearedBytes) {
+		setRealTopForAllocation((void *)((uintptr_t)getRealTop() + unclearedBytes));
+		_clearAheadBytes = 0;
+	}
+
+	return unclearedBytes;
+}
 #endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
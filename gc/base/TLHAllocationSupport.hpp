@@ -84,6 +84,7 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+	uintptr_t _clearAheadBytes; /**< Number of bytes above the visible top of a batch cleared TLH that are not cleared yet (below any bytes reserved for GC). */
 public:
 protected:
 private:
@@ -117,7 +118,7 @@ private:
 	};
 
 	/* @return the number of bytes, which are available for allocation in the TLH */
-	MMINLINE uintptr_t getRemainingSize() { return (uintptr_t)getRealTop() - (uintptr_t)getAlloc(); };
+	MMINLINE uintptr_t getRemainingSize() { return (uintptr_t)getRealTop() + _clearAheadBytes - (uintptr_t)getAlloc(); };
 	/* @return the number of used bytes in the TLH */
 	MMINLINE uintptr_t getUsedSize() { return (uintptr_t)getAlloc() - (uintptr_t)getBase(); };
 
@@ -125,6 +126,16 @@ private:
 	MMINLINE void setAlloc(void *allocPtr) { *_pointerToHeapAlloc = (uint8_t *)allocPtr; };
 	MMINLINE void *getTop() { return (void *) *_pointerToHeapTop; };
 	MMINLINE void setTop(void *topPtr) { *_pointerToHeapTop = (uint8_t *)topPtr; };
+	/* Move the TLH top, which is held in realHeapTop while inline allocation is disabled */
+	MMINLINE void
+	setRealTopForAllocation(void *topPtr)
+	{
+		if (NULL != _tlh->realHeapTop) {
+			setRealTop(topPtr);
+		} else {
+			setTop(topPtr);
+		}
+	};
 	MMINLINE void setAllZeroes(void) { memset((void *)_tlh, 0, sizeof(LanguageThreadLocalHeapStruct)); };
 
 	/**
@@ -195,6 +206,45 @@ private:
 	 */
 	void *restoreTLHTopForGC(MM_EnvironmentBase *env);
 
+	/**
+	 * Clear the first tlhClearAheadSize bytes of a fresh TLH and hide the rest above the TLH top, to be cleared
+	 * by clearAhead() as allocation reaches it. Called after reserveTLHTopForGC() so the reserved bytes stay on top.
+	 */
+	void startClearAhead(MM_EnvironmentBase *env);
+
+	/**
+	 * Clear enough of the hidden part of the TLH, in steps of tlhClearAheadSize, to expose sizeInBytesRequired bytes.
+	 *
+	 * @return true if the TLH now fits the request, false if it would not fit even if cleared up to its real top
+	 */
+	bool clearAhead(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
+
+	/**
+	 * Expose the part of the TLH that was not cleared yet, before the TLH is flushed or replaced.
+	 * The exposed memory is not cleared and must not be allocated from.
+	 *
+	 * @return the number of bytes exposed
+	 */
+	uintptr_t restoreTLHTopForClearAhead(MM_EnvironmentBase *env);
+
+	/**
+	 * Prefetch for write the line tlhPrefetchDistance bytes ahead of the allocation pointer, so the objects
+	 * allocated next find their lines in the cache even though they were cleared with non-temporal stores.
+	 */
+	MMINLINE void
+	prefetchAhead(MM_EnvironmentBase *env)
+	{
+		uintptr_t prefetchDistance = env->getExtensions()->tlhPrefetchDistance;
+		if (0 != prefetchDistance) {
+			uint8_t *prefetchAddr = (uint8_t *)getAlloc() + prefetchDistance;
+			if (prefetchAddr < (uint8_t *)getTop()) {
+#if defined(__GNUC__)
+				__builtin_prefetch(prefetchAddr, 1, 3);
+#endif /* defined(__GNUC__) */
+			}
+		}
+	}
+
 	/**
 	 * Refresh the TLH.
 	 */
@@ -251,7 +301,8 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_clearAheadBytes(0)
 	{};
 
 	/*
@@ -46,6 +46,7 @@
 #define J9MODRON_HANDLE_NEXT_WORK_UNIT(envPtr) envPtr->_currentTask->handleNextWorkUnit(envPtr)
 
 class MM_EnvironmentBase;
+class MM_GCThreadBarrier;
 class MM_ParallelDispatcher;
 
 /**
@@ -89,6 +90,11 @@ public:
 		/* in a Task we don't need a mutex */
 	}
 
+	MMINLINE virtual void setSynchronizeBarrier(MM_GCThreadBarrier *synchronizeBarrier)
+	{
+		/* in a Task we don't need a barrier */
+	}
+
 	virtual void accept(MM_EnvironmentBase *env);
 	virtual void complete(MM_EnvironmentBase *env);
 
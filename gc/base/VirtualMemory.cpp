@@ -256,6 +256,19 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	return result;
 }
 
+bool
+MM_VirtualMemory::moveMemory(void* source, void* target, uintptr_t size)
+{
+	Assert_MM_true(0 != _pageSize);
+	Assert_MM_true(0 == ((uintptr_t)source % _pageSize));
+	Assert_MM_true(0 == ((uintptr_t)target % _pageSize));
+	Assert_MM_true(0 == (size % _pageSize));
+
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+
+	return 0 == omrvmem_move_memory(source, target, size, &_identifier);
+}
+
 void
 MM_VirtualMemory::tearDown(MM_EnvironmentBase* env)
 {
@@ -241,6 +241,16 @@ public:
 	 */
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+	/**
+	 * Move the pages backing a virtual memory range to another range without copying them
+	 *
+	 * @param source the page aligned start of the range to be moved
+	 * @param target the page aligned start of the range to move to
+	 * @param size the size of the range, a multiple of the page size
+	 * @return true if succeeded, false if nothing was moved
+	 */
+	virtual bool moveMemory(void* source, void* target, uintptr_t size);
+
 /*
  * friends
  */
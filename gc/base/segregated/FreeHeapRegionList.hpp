@@ -76,6 +76,13 @@ public:
 
 	virtual MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess) = 0;
 
+	/**
+	 * Decommit the memory backing the committed free ranges on the list. The ranges stay on the
+	 * list and are recommitted by the operating system when they are next touched.
+	 * @return number of bytes decommitted
+	 */
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase *env) = 0;
+
 	MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass)
 	{
 		assert(_singleRegionsOnly);
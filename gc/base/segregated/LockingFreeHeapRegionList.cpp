@@ -27,6 +27,10 @@
 
 #include "LockingFreeHeapRegionList.hpp"
 
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionManager.hpp"
+
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 MM_LockingFreeHeapRegionList *
@@ -124,4 +128,31 @@ MM_LockingFreeHeapRegionList::allocate(MM_EnvironmentBase *env, uintptr_t szClas
 	return NULL;
 }
 
+uintptr_t
+MM_LockingFreeHeapRegionList::releaseFreeMemoryPages(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_Heap *heap = extensions->getHeap();
+	uintptr_t regionSize = heap->getHeapRegionManager()->getRegionSize();
+	uintptr_t releasedBytes = 0;
+	lock();
+	for (MM_HeapRegionDescriptorSegregated *cur = _head; cur != NULL; cur = cur->getNext()) {
+		if (cur->isCommitted()) {
+			uintptr_t rangeRegions = cur->getRange();
+			/* leave the requested percentage of each range committed, as for free list entries */
+			uintptr_t commitRegions = rangeRegions * extensions->decommitMinimumFree / 100;
+			uintptr_t decommitSize = (rangeRegions - commitRegions) * regionSize;
+			if (0 < decommitSize) {
+				void *rangeTop = (void *)((uintptr_t)cur->getLowAddress() + (rangeRegions * regionSize));
+				void *decommitBase = (void *)((uintptr_t)rangeTop - decommitSize);
+				if (heap->decommitMemory(decommitBase, decommitSize, NULL, rangeTop)) {
+					releasedBytes += decommitSize;
+				}
+			}
+		}
+	}
+	unlock();
+	return releasedBytes;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -161,6 +161,8 @@ public:
 
 	virtual MM_HeapRegionDescriptorSegregated* allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess);
 
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase *env);
+
 	virtual uintptr_t getTotalRegions();
 
 	virtual void showList(MM_EnvironmentBase *env);
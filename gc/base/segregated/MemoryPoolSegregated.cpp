@@ -306,6 +306,13 @@ MM_MemoryPoolSegregated::abandonHeapChunk(void *addrBase, void *addrTop)
 	return false;
 }
 
+uintptr_t
+MM_MemoryPoolSegregated::releaseFreeMemoryPages(MM_EnvironmentBase *env)
+{
+	/* only whole free regions are released: partially used small regions keep their cells committed */
+	return _regionPool->releaseFreeMemoryPages(env);
+}
+
 uintptr_t
 MM_MemoryPoolSegregated::getApproximateFreeMemorySize()
 {
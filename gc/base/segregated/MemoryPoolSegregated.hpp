@@ -103,6 +103,8 @@ public:
 
 	virtual bool abandonHeapChunk(void *addrBase, void *addrTop);
 
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase *env);
+
 	MMINLINE uintptr_t verbose(MM_EnvironmentBase *env) { return _extensions->verbose; }
 	MMINLINE uintptr_t debug(MM_EnvironmentBase *env) { return _extensions->debug; }
 
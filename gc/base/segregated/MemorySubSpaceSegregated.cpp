@@ -381,4 +381,16 @@ MM_MemorySubSpaceSegregated::getMemoryPool()
 	return _memoryPoolSegregated;
 }
 
+uintptr_t
+MM_MemorySubSpaceSegregated::releaseFreeMemoryPages(MM_EnvironmentBase *env)
+{
+	return _memoryPoolSegregated->releaseFreeMemoryPages(env);
+}
+
+uintptr_t
+MM_MemorySubSpaceSegregated::releaseFreeMemoryPages(MM_EnvironmentBase *env, uintptr_t memoryType)
+{
+	return releaseFreeMemoryPages(env);
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -117,6 +117,9 @@ public:
 	virtual void heapReconfigured(MM_EnvironmentBase *env, HeapReconfigReason reason, MM_MemorySubSpace *subspace = NULL, void *lowAddress = NULL, void *highAddress = NULL);
 
 	virtual MM_MemoryPool *getMemoryPool();
+
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase *env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase *env, uintptr_t memoryType);
 	
 	MM_MemorySubSpaceSegregated(
 		MM_EnvironmentBase *env, MM_PhysicalSubArena *physicalSubArena, MM_MemoryPool *memoryPool,
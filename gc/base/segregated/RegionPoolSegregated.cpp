@@ -213,6 +213,12 @@ MM_RegionPoolSegregated::addSingleFree(MM_EnvironmentBase *env, MM_HeapRegionQue
 	_singleFreeList->push(regionQueue);
 }
 
+uintptr_t
+MM_RegionPoolSegregated::releaseFreeMemoryPages(MM_EnvironmentBase *env)
+{
+	return _singleFreeList->releaseFreeMemoryPages(env) + _multiFreeList->releaseFreeMemoryPages(env);
+}
+
 void
 MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 {
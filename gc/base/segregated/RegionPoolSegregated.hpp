@@ -185,6 +185,7 @@ public:
 	void addFreeRange(void *lowAddress, void *highAddress);
 	void addFreeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region, bool alreadyFree = false);
 	void addSingleFree(MM_EnvironmentBase *env, MM_HeapRegionQueue *regionQueue);
+	uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase *env);
 	
 	MMINLINE uintptr_t roundUpRegion(uintptr_t size) {	return (size + _heapRegionManager->getRegionSize() - 1) & (~(_heapRegionManager->getRegionSize() - 1)); }
 	MMINLINE uintptr_t roundDownRegion(uintptr_t size) { return (size) & (~(_heapRegionManager->getRegionSize() - 1)); }
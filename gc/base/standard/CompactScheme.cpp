@@ -44,6 +44,7 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "HeapStats.hpp"
+#include "HugeObjectSpace.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
 #include "MemoryPool.hpp"
@@ -352,11 +353,16 @@ MM_CompactScheme::postObjectMove(MM_EnvironmentBase *env, omrobjectptr_t objectP
 }
 
 void
-MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded, bool nurseryOnly)
+MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded, bool nurseryOnly, uintptr_t partialCompactTarget)
 {
-	createSubAreaTable(env, singleThreaded, nurseryOnly);
+	bool partial = (0 != partialCompactTarget);
+	createSubAreaTable(env, singleThreaded, nurseryOnly, partial);
 	setRealLimitsSubAreas(env);
 	removeNullSubAreas(env);
+	if (partial) {
+		measureSubAreas(env);
+		planPartialCompaction(env, partialCompactTarget);
+	}
 	completeSubAreaTable(env, nurseryOnly);
 }
 
@@ -369,6 +375,7 @@ MM_CompactScheme::mainSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+	_partialCompact = false;
 	_delegate.mainSetupForGC(env);
 }
 
@@ -385,7 +392,7 @@ MM_CompactScheme::freeChunkEnd(omrobjectptr_t chunk)
  *  Create sub areas table for regions.
  */
 void
-MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded, bool nurseryOnly)
+MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded, bool nurseryOnly, bool partial)
 {
 	/* finding whether there are memory limitations */
 	uintptr_t max_subarea_num = _subAreaTableSize / sizeof(_subAreaTable[0]);
@@ -410,7 +417,9 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 	} else {
 		min_subarea_size = _heap->getMaximumPhysicalRange();
 	}
-	uintptr_t size = (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
+	/* A partial compaction is planned per sub area, so it uses smaller ones to compact less */
+	uintptr_t desiredSize = partial ? PARTIAL_COMPACT_SUBAREA_SIZE : DESIRED_SUBAREA_SIZE;
+	uintptr_t size = (desiredSize >= min_subarea_size) ?  desiredSize : min_subarea_size;
 
 
 	/* Single threaded pass to set tentative sub area limits tentative limits are
@@ -432,7 +441,7 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 				state = SubAreaEntry::fixup_only;
 			}
 
-			if (singleThreaded) {
+			if (singleThreaded && !partial) {
 				size = areaSize;
 			}
 			_subAreaTable[i].firstObject = (omrobjectptr_t)lowAddress;
@@ -516,6 +525,107 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_CompactScheme::measureSubAreas(MM_EnvironmentStandard *env)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::measuring_live_bytes)) {
+				uintptr_t liveBytes = 0;
+				omrobjectptr_t finish = pageStart(pageIndex(subAreaTable[i + 1].firstObject));
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, (uintptr_t *)finish);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				}
+				subAreaTable[i].liveBytes = liveBytes;
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i + 1);
+	}
+}
+
+void
+MM_CompactScheme::planPartialCompaction(MM_EnvironmentStandard *env, uintptr_t partialCompactTarget)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		/* Sub areas are compacted in parallel, each into its own or a lower free chunk, so the free
+		 * memory of a window can end up split between its sub areas: ask for twice the target.
+		 */
+		uintptr_t freeBytesRequired = 2 * partialCompactTarget;
+		SubAreaEntry *windowStart = NULL;
+		SubAreaEntry *windowEnd = NULL;
+		uintptr_t windowLiveBytes = UDATA_MAX;
+
+		GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+		MM_HeapRegionDescriptorStandard *region = NULL;
+		SubAreaEntry *subAreaTable = _subAreaTable;
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (!region->isCommitted() || (0 == region->getSize())) {
+				continue;
+			}
+			intptr_t count = 0;
+			while (SubAreaEntry::end_segment != subAreaTable[count].state) {
+				count += 1;
+			}
+
+			if (OMR_ARE_ALL_BITS_SET(region->getSubSpace()->getTypeFlags(), MEMORY_TYPE_OLD)) {
+				/* Free bytes only grow as a window is extended, so for each start only the shortest
+				 * window satisfying the target needs to be considered, and its end never moves back.
+				 */
+				intptr_t end = 0;
+				uintptr_t liveBytes = 0;
+				for (intptr_t start = 0; start < count; start++) {
+					uintptr_t freeBytes = 0;
+					while (true) {
+						freeBytes = ((uintptr_t)subAreaTable[end].firstObject - (uintptr_t)subAreaTable[start].firstObject) - liveBytes;
+						if ((freeBytes >= freeBytesRequired) || (end == count)) {
+							break;
+						}
+						liveBytes += subAreaTable[end].liveBytes;
+						end += 1;
+					}
+					if (freeBytes < freeBytesRequired) {
+						break;
+					}
+					if (liveBytes < windowLiveBytes) {
+						windowStart = &subAreaTable[start];
+						windowEnd = &subAreaTable[end];
+						windowLiveBytes = liveBytes;
+					}
+					liveBytes -= subAreaTable[start].liveBytes;
+				}
+			}
+			subAreaTable += (count + 1);
+		}
+
+		if (NULL != windowStart) {
+			_partialCompact = true;
+			_compactFrom = windowStart->firstObject;
+			_compactTo = windowEnd->firstObject;
+
+			/* Only fix up the objects outside of the window */
+			for (SubAreaEntry *entry = _subAreaTable; entry < subAreaTable; entry++) {
+				if ((SubAreaEntry::init == entry->state) && ((entry < windowStart) || (entry >= windowEnd))) {
+					entry->state = SubAreaEntry::fixup_only;
+				}
+			}
+		}
+
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
 /**
  *  Complete setup for each sub area.
  */
@@ -547,7 +657,7 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env, bool nursery
 }
 
 void
-MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive, bool nurseryOnly)
+MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive, bool nurseryOnly, uintptr_t partialCompactTarget)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -584,7 +694,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded, nurseryOnly);
+	workerSetupForGC(env, singleThreaded, nurseryOnly, partialCompactTarget);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
 	/* If a single threaded compaction force compact to run on main thread. Required
@@ -722,6 +832,14 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env, bool nursery
 
 				currentFreeBase = NULL;
 				currentFreeSize = 0;
+
+				if (_partialCompact && (SubAreaEntry::fixup_only == subAreaTable[i].state)) {
+					/* The sub area was left as it is, but its memory pool was reset */
+					currentFreeBase = addFreeEntriesBetweenMarkedObjects(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject);
+					if (currentFreeBase == (void *)subAreaTable[i + 1].firstObject) {
+						currentFreeBase = NULL;
+					}
+				}
 			}
         } while (subAreaTable[i++].state != SubAreaEntry::end_segment);
 
@@ -827,6 +945,20 @@ MM_CompactScheme::addFreeEntry(MM_EnvironmentStandard *env, MM_MemorySubSpace *m
 	}
 }
 
+void *
+MM_CompactScheme::addFreeEntriesBetweenMarkedObjects(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t start, omrobjectptr_t finish)
+{
+	void *currentFreeBase = (void *)start;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)start, (uintptr_t *)pageStart(pageIndex(finish)));
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if ((void *)objectPtr > currentFreeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, (uintptr_t)objectPtr - (uintptr_t)currentFreeBase);
+		}
+		currentFreeBase = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+	return currentFreeBase;
+}
 
 void
 MM_CompactScheme::moveObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &skippedObjectCount)
@@ -1381,6 +1513,19 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
          * the end_segment region, is i+1 */
         subAreaTable += (i+1);
 	}
+
+	/* Huge objects never move but may refer to objects that did */
+	MM_HugeObjectSpace *hugeObjectSpace = _extensions->hugeObjectSpace;
+	if (NULL != hugeObjectSpace) {
+		MM_CompactSchemeFixupObject fixupObject(env, this);
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = hugeObjectSpace->nextObject(objectPtr))) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				objectCount++;
+				fixupObject.fixupObject(env, objectPtr);
+			}
+		}
+	}
 }
 
 void
@@ -1434,7 +1579,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -92,11 +92,13 @@ private:
 		omrobjectptr_t freeChunk;
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		uintptr_t liveBytes; /**< bytes of marked objects in the subarea, only measured to plan a partial compaction */
         
 		/* legal values for currentAction */
 		enum {
 			none = 0,
 			setting_real_limits,
+			measuring_live_bytes,
 			evacuating,
 			fixing_up,
 			rebuilding_mark_bits,
@@ -137,6 +139,7 @@ protected:
 	SubAreaEntry           *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
+	bool                   _partialCompact; /**< true if only a window of the heap is compacted, the sub areas outside of it being fixup_only */
 	MM_CompactDelegate     _delegate;
 
 public:
@@ -160,7 +163,7 @@ protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
-	void createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded, bool nurseryOnly);
+	void createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded, bool nurseryOnly, bool partial);
 	/**
 	 * Set the real limits for a specific subArea
 	 *
@@ -168,6 +171,24 @@ protected:
 	 */
 	void setRealLimitsSubAreas(MM_EnvironmentStandard *env);
 	void removeNullSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Measure the live bytes of each sub area from the mark map, building the live density
+	 * histogram a partial compaction is planned from.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void measureSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Find the window of consecutive tenure sub areas which frees enough memory to satisfy the
+	 * target for the fewest live bytes moved, and make every sub area outside of it fixup_only.
+	 * If no window is found the whole heap is compacted.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in] partialCompactTarget the number of contiguous bytes the compaction has to free
+	 */
+	void planPartialCompaction(MM_EnvironmentStandard *env, uintptr_t partialCompactTarget);
 	void completeSubAreaTable(MM_EnvironmentStandard *env, bool nurseryOnly);
 
 	void saveForwardingPtr(class CompactTableEntry&,
@@ -226,6 +247,21 @@ protected:
 					void *currentFreeBase,
 					uintptr_t currentFreeSize);
 
+	/**
+	 * Add the free memory between the marked objects of a sub area which was not compacted by a
+	 * partial compaction, whose memory pool was reset along with the compacted ones.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in] start the first object of the sub area
+	 * @param[in] finish the first object of the next sub area
+	 * @return the end of the last marked object of the sub area, where the next free entry may start
+	 */
+	void *addFreeEntriesBetweenMarkedObjects(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					omrobjectptr_t start,
+					omrobjectptr_t finish);
+
 	/**
 	 * Return the page index for an object.
 	 * long int, always positive (in particular, -1 is an invalid value)
@@ -307,9 +343,9 @@ public:
 	
 	void kill(MM_EnvironmentBase *env);
 
-	void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded, bool nurseryOnly);
+	void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded, bool nurseryOnly, uintptr_t partialCompactTarget);
 	void mainSetupForGC(MM_EnvironmentStandard *env);
-	virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive, bool nurseryOnly);
+	virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive, bool nurseryOnly, uintptr_t partialCompactTarget);
 	omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
 	void flushPool(MM_EnvironmentStandard *env, MM_CompactMemoryPoolState *freeListState);
 	void fixHeapForWalk(MM_EnvironmentBase *env, uintptr_t walkFlags, uintptr_t walkReason);
@@ -335,6 +371,7 @@ public:
 		, _markMap(markingScheme->getMarkMap())
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
+		, _partialCompact(false)
 		, _delegate()
 	{
 		_typeId = __FUNCTION__;
@@ -171,14 +171,14 @@ void oldToOldReferenceCreated(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 } /* extern "C" */
 
 void
-MM_ConcurrentGC::reportConcurrentKickoff(MM_EnvironmentBase *env)
+MM_ConcurrentGC::reportConcurrentKickoff(MM_EnvironmentBase *env, uintptr_t kickoffThreshold)
 {
 	env->_collectionReason = MM_CycleState::gc_reason_concurrent_kickoff;
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 
 	Trc_MM_ConcurrentKickoff(env->getLanguageVMThread(),
 		_stats.getTraceSizeTarget(),
-		_stats.getKickoffThreshold(),
+		kickoffThreshold,
 		_stats.getRemainingFree()
 	);
 
@@ -191,13 +191,31 @@ MM_ConcurrentGC::reportConcurrentKickoff(MM_EnvironmentBase *env)
 		J9HOOK_MM_PRIVATE_CONCURRENT_KICKOFF,
 		_extensions->getHeap()->initializeCommonGCData(env, &commonData),
 		_stats.getTraceSizeTarget(),
-		_stats.getKickoffThreshold(),
+		kickoffThreshold,
 		_stats.getRemainingFree(),
 		_stats.getKickoffReason(),
 		_languageKickoffReason
 	);
 }
 
+void
+MM_ConcurrentGC::reportConcurrentForecast(MM_EnvironmentBase *env, bool completed)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	TRIGGER_J9HOOK_MM_PRIVATE_CONCURRENT_FORECAST(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_CONCURRENT_FORECAST,
+		_kickoffForecast.getKickoffThreshold(),
+		_kickoffForecast.getPredictedDuration(),
+		_kickoffForecast.getActualDuration(),
+		_kickoffForecast.getAllocationRate(),
+		_kickoffForecast.getMarkingRate(),
+		(uintptr_t)completed
+	);
+}
+
 void
 MM_ConcurrentGC::reportConcurrentAborted(MM_EnvironmentBase *env, CollectionAbortReason reason)
 {
@@ -1668,7 +1686,18 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 		return false;
 	}
 
-	if ((remainingFree < _stats.getKickoffThreshold()) || _forcedKickoff) {
+	/* A forecast, once there is enough history for one, replaces the tuned threshold */
+	uintptr_t kickoffThreshold = _stats.getKickoffThreshold();
+	uintptr_t forecastThreshold = 0;
+	if (_extensions->concurrentKickoffForecast) {
+		_kickoffForecast.sampleAllocation(env, remainingFree);
+		forecastThreshold = _kickoffForecast.getKickoffThreshold(_stats.getTraceSizeTarget(), _extensions->concurrentKickoffForecastMargin);
+		if (0 != forecastThreshold) {
+			kickoffThreshold = forecastThreshold;
+		}
+	}
+
+	if ((remainingFree < kickoffThreshold) || _forcedKickoff) {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		/* Finish off any sweep work that was still in progress */
 		completeConcurrentSweepForKickoff(env);
@@ -1677,12 +1706,15 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 		if (_stats.switchExecutionMode(CONCURRENT_OFF, CONCURRENT_INIT_RUNNING)) {
 			_stats.setRemainingFree(remainingFree);
 			/* Set kickoff reason if it is not set yet */
-			_stats.setKickoffReason(KICKOFF_THRESHOLD_REACHED);
+			_stats.setKickoffReason((0 != forecastThreshold) ? KICKOFF_FORECAST_REACHED : KICKOFF_THRESHOLD_REACHED);
 			if (LANGUAGE_DEFINED_REASON != _stats.getKickoffReason()) {
 				_languageKickoffReason = NO_LANGUAGE_KICKOFF_REASON;
 			}
+			if (_extensions->concurrentKickoffForecast) {
+				_kickoffForecast.recordKickoff(env, _stats.getTraceSizeTarget(), forecastThreshold);
+			}
 			_extensions->setConcurrentGlobalGCInProgress(true);
-			reportConcurrentKickoff(env);
+			reportConcurrentKickoff(env, kickoffThreshold);
 			/* Transfer collection reason to concurrent cycle state */
 			_concurrentCycleState._collectionReason = env->_collectionReason;
 		}
@@ -1977,6 +2009,10 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 		if ((CONCURRENT_INIT_COMPLETE < executionModeAtGC) && (CONCURRENT_FINAL_COLLECTION > executionModeAtGC)) {
 			postConcurrentUpdateStatsAndReport(env);
 		}
+
+		if (_extensions->concurrentKickoffForecast && _kickoffForecast.recordCompletion(env, _stats.getTotalTraced())) {
+			reportConcurrentForecast(env, CONCURRENT_FINAL_COLLECTION == executionModeAtGC);
+		}
 	}
 
 	if ((executionModeAtGC > CONCURRENT_OFF) && _extensions->debugConcurrentMark) {
@@ -35,6 +35,7 @@
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentGCStats.hpp"
+#include "ConcurrentKickoffForecast.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ParallelGlobalGC.hpp"
@@ -223,6 +224,7 @@ protected:
 
 	MM_ConcurrentSafepointCallback *_callback;
 	MM_ConcurrentGCStats _stats;
+	MM_ConcurrentKickoffForecast _kickoffForecast; /**< allocation and marking rate forecast, used when concurrentKickoffForecast is enabled */
 	MM_ConcurrentMarkPhaseStats _concurrentPhaseStats;
 
 	/*
@@ -247,7 +249,8 @@ private:
 	void shutdownConHelperThreads(MM_GCExtensionsBase *extensions);
 	bool timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 
-	void reportConcurrentKickoff(MM_EnvironmentBase *env);
+	void reportConcurrentKickoff(MM_EnvironmentBase *env, uintptr_t kickoffThreshold);
+	void reportConcurrentForecast(MM_EnvironmentBase *env, bool completed);
 	void reportConcurrentAborted(MM_EnvironmentBase *env, CollectionAbortReason reason);
 	void reportConcurrentCollectionEnd(MM_EnvironmentBase *env, uint64_t duration);
 	void reportConcurrentBackgroundThreadActivated(MM_EnvironmentBase *env);
@@ -509,6 +512,7 @@ public:
 		,_retuneAfterHeapResize(false)
 		,_callback(NULL)
 		,_stats()
+		,_kickoffForecast()
 		,_concurrentPhaseStats()
 		{
 			_typeId = __FUNCTION__;
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "omrport.h"
+
+#include <math.h>
+
+#include "ConcurrentKickoffForecast.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "Math.hpp"
+
+void
+MM_ConcurrentKickoffForecast::updateRate(double *rate, double *variance, bool *valid, double sample)
+{
+	if (*valid) {
+		double deviation = sample - *rate;
+		*rate = MM_Math::weightedAverage(*rate, sample, CONCURRENT_FORECAST_HISTORY_WEIGHT);
+		*variance = MM_Math::weightedAverage(*variance, deviation * deviation, CONCURRENT_FORECAST_HISTORY_WEIGHT);
+	} else {
+		*rate = sample;
+		*variance = 0.0;
+		*valid = true;
+	}
+}
+
+void
+MM_ConcurrentKickoffForecast::sampleAllocation(MM_EnvironmentBase *env, uintptr_t remainingFree)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t lastSampleTime = _lastSampleTime;
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 == lastSampleTime) {
+		if (0 == MM_AtomicOperations::lockCompareExchangeU64(&_lastSampleTime, 0, now)) {
+			_lastSampleFree = remainingFree;
+		}
+		return;
+	}
+
+	uint64_t elapsed = omrtime_hires_delta(lastSampleTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	if ((CONCURRENT_FORECAST_SAMPLE_INTERVAL <= elapsed) && (lastSampleTime == MM_AtomicOperations::lockCompareExchangeU64(&_lastSampleTime, lastSampleTime, now))) {
+		/* this thread owns the sample until it publishes _lastSampleFree */
+		if (remainingFree <= _lastSampleFree) {
+			updateRate(&_allocationRate, &_allocationRateVariance, &_allocationRateValid, (double)(_lastSampleFree - remainingFree) / (double)elapsed);
+		}
+		_lastSampleFree = remainingFree;
+	}
+}
+
+uintptr_t
+MM_ConcurrentKickoffForecast::getKickoffThreshold(uintptr_t bytesToTrace, uintptr_t marginPercent)
+{
+	uintptr_t threshold = 0;
+
+	if (_allocationRateValid && _markingRateValid && (0.0 < _markingRate)) {
+		double allocationRate = _allocationRate + (CONCURRENT_FORECAST_DEVIATIONS * sqrt(_allocationRateVariance));
+		double markingRate = _markingRate - (CONCURRENT_FORECAST_DEVIATIONS * sqrt(_markingRateVariance));
+		markingRate = OMR_MAX(markingRate, _markingRate * CONCURRENT_FORECAST_MIN_MARKING_FRACTION);
+		double duration = (double)bytesToTrace / markingRate;
+		double consumed = allocationRate * duration * (double)(100 + marginPercent) / 100.0;
+		threshold = (consumed < (double)UDATA_MAX) ? (uintptr_t)consumed : UDATA_MAX;
+		/* a threshold of 0 means there is no forecast */
+		threshold = OMR_MAX(threshold, 1);
+	}
+
+	return threshold;
+}
+
+void
+MM_ConcurrentKickoffForecast::recordKickoff(MM_EnvironmentBase *env, uintptr_t bytesToTrace, uintptr_t kickoffThreshold)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	_kickoffTime = omrtime_hires_clock();
+	_kickoffThreshold = kickoffThreshold;
+	_predictedDuration = 0;
+	if (_markingRateValid && (0.0 < _markingRate)) {
+		_predictedDuration = (uint64_t)((double)bytesToTrace / _markingRate);
+	}
+}
+
+bool
+MM_ConcurrentKickoffForecast::recordCompletion(MM_EnvironmentBase *env, uintptr_t bytesTraced)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (0 == _kickoffTime) {
+		return false;
+	}
+
+	_actualDuration = omrtime_hires_delta(_kickoffTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	_kickoffTime = 0;
+	if ((0 != _actualDuration) && (0 != bytesTraced)) {
+		updateRate(&_markingRate, &_markingRateVariance, &_markingRateValid, (double)bytesTraced / (double)_actualDuration);
+	}
+	/* consumption across the collection is not allocation */
+	_lastSampleTime = 0;
+
+	return true;
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(CONCURRENTKICKOFFFORECAST_HPP_)
+#define CONCURRENTKICKOFFFORECAST_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/* Minimum time between two samples of the allocation rate, in microseconds */
+#define CONCURRENT_FORECAST_SAMPLE_INTERVAL 1000
+/* Weight of the history in the smoothed rates and their variances */
+#define CONCURRENT_FORECAST_HISTORY_WEIGHT ((double)0.7)
+/* Number of standard deviations the forecast allows the rates to deviate from their mean */
+#define CONCURRENT_FORECAST_DEVIATIONS ((double)2.0)
+/* The pessimistic marking rate is never taken to be below this fraction of its mean */
+#define CONCURRENT_FORECAST_MIN_MARKING_FRACTION ((double)0.25)
+
+/**
+ * Forecasts when concurrent mark has to be kicked off so that it completes before the free
+ * memory runs out.
+ *
+ * Free memory consumption is sampled by the mutators that check for kickoff, and the marking
+ * rate is measured over every concurrent cycle from kickoff to the final collection. Both are
+ * smoothed exponentially together with their variances. Marking is predicted to take the trace
+ * target at the pessimistic marking rate (the mean less CONCURRENT_FORECAST_DEVIATIONS standard
+ * deviations), and concurrent mark is kicked off when the memory consumed over that time at the
+ * pessimistic allocation rate, plus a safety margin, reaches the remaining free memory.
+ *
+ * Free memory that grows between samples (a collection was done) resets the sampling baseline.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentKickoffForecast : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uint64_t _lastSampleTime; /**< hires clock of the last allocation sample, 0 if there is none */
+	uintptr_t _lastSampleFree; /**< remaining free memory at the last allocation sample */
+	double _allocationRate; /**< smoothed free memory consumed, in bytes per microsecond */
+	double _allocationRateVariance; /**< smoothed variance of _allocationRate */
+	double _markingRate; /**< smoothed concurrent marking progress, in bytes per microsecond */
+	double _markingRateVariance; /**< smoothed variance of _markingRate */
+	bool _allocationRateValid; /**< true once the allocation rate has been sampled */
+	bool _markingRateValid; /**< true once a concurrent cycle has been measured */
+
+	uint64_t _kickoffTime; /**< hires clock at kickoff of the current cycle, 0 if no cycle is running */
+	uint64_t _predictedDuration; /**< forecast duration of the current cycle in microseconds, 0 if there was no forecast */
+	uint64_t _actualDuration; /**< measured duration of the last completed cycle in microseconds */
+	uintptr_t _kickoffThreshold; /**< forecast kickoff threshold in effect at kickoff of the current cycle */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	void updateRate(double *rate, double *variance, bool *valid, double sample);
+
+protected:
+public:
+	/**
+	 * Sample the rate at which free memory is consumed. Called by mutator threads before they
+	 * check for kickoff; at most one thread samples per CONCURRENT_FORECAST_SAMPLE_INTERVAL.
+	 * @param remainingFree the free memory remaining for allocation
+	 */
+	void sampleAllocation(MM_EnvironmentBase *env, uintptr_t remainingFree);
+
+	/**
+	 * Calculate the amount of free memory at which concurrent mark has to be kicked off.
+	 * @param bytesToTrace the amount of work concurrent mark is expected to do
+	 * @param marginPercent percentage added to the forecast consumption as a safety margin
+	 * @return the kickoff threshold, or 0 if there is not enough history to make a forecast
+	 */
+	uintptr_t getKickoffThreshold(uintptr_t bytesToTrace, uintptr_t marginPercent);
+
+	/**
+	 * Record kickoff of a concurrent cycle.
+	 * @param bytesToTrace the amount of work concurrent mark is expected to do
+	 * @param kickoffThreshold the forecast threshold that triggered kickoff, 0 if it was not forecast
+	 */
+	void recordKickoff(MM_EnvironmentBase *env, uintptr_t bytesToTrace, uintptr_t kickoffThreshold);
+
+	/**
+	 * Record the end of the concurrent part of a cycle and learn its marking rate.
+	 * @param bytesTraced the amount of work concurrent mark has done
+	 * @return true if a cycle kicked off by recordKickoff() was running
+	 */
+	bool recordCompletion(MM_EnvironmentBase *env, uintptr_t bytesTraced);
+
+	MMINLINE uint64_t getPredictedDuration() { return _predictedDuration; }
+	MMINLINE uint64_t getActualDuration() { return _actualDuration; }
+	MMINLINE uintptr_t getKickoffThreshold() { return _kickoffThreshold; }
+	/** @return the smoothed allocation rate, in bytes per millisecond */
+	MMINLINE uintptr_t getAllocationRate() { return (uintptr_t)(_allocationRate * 1000); }
+	/** @return the smoothed marking rate, in bytes per millisecond */
+	MMINLINE uintptr_t getMarkingRate() { return (uintptr_t)(_markingRate * 1000); }
+
+	MM_ConcurrentKickoffForecast()
+		: MM_BaseNonVirtual()
+		, _lastSampleTime(0)
+		, _lastSampleFree(0)
+		, _allocationRate(0.0)
+		, _allocationRateVariance(0.0)
+		, _markingRate(0.0)
+		, _markingRateVariance(0.0)
+		, _allocationRateValid(false)
+		, _markingRateValid(false)
+		, _kickoffTime(0)
+		, _predictedDuration(0)
+		, _actualDuration(0)
+		, _kickoffThreshold(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#endif /* CONCURRENTKICKOFFFORECAST_HPP_ */
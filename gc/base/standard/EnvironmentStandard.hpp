@@ -60,6 +60,8 @@ public:
 	
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
+	uintptr_t _hotFieldProfileSampleCountdown; /**< objects left to scan before the next one is sampled for the hot field profile */
+	uintptr_t _profiledHotFieldCopyDepthCount; /**< current depth of profiled hot field copying, bounded by depthCopyMax */
 #endif
 	void *_tenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that might be reused  on next copy refresh */
 	void *_tenureTLHRemainderTop;
@@ -93,6 +95,10 @@ public:
 		,_inactiveDeferredCopyCache(NULL)
 		,_inactiveTenureCopyScanCache(NULL)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_hotFieldProfileSampleCountdown(0)
+		,_profiledHotFieldCopyDepthCount(0)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		,_tenureTLHRemainderBase(NULL)
 		,_tenureTLHRemainderTop(NULL)
 		,_loaAllocation(false)
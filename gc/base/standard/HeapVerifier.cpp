@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+#include "omrport.h"
+#include "ModronAssertions.h"
+
+#include "HeapVerifier.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapMemorySubSpaceIterator.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "HugeObjectSpace.hpp"
+#include "MarkMap.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectIterator.hpp"
+#include "ObjectModel.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelObjectHeapIterator.hpp"
+#include "ParallelTask.hpp"
+#include "SlotObject.hpp"
+
+/**
+ * Task run by all GC threads to verify the heap.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelHeapVerifyTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapVerifier *_heapVerifier;
+	bool _afterCollect;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return _afterCollect ? OMRVMSTATE_GC_CHECK_AFTER_GC : OMRVMSTATE_GC_CHECK_BEFORE_GC; };
+
+	virtual void run(MM_EnvironmentBase *env) { _heapVerifier->verifyHeapParallel(env); }
+
+	MM_ParallelHeapVerifyTask(MM_EnvironmentBase *env, MM_HeapVerifier *heapVerifier, bool afterCollect)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _heapVerifier(heapVerifier)
+		, _afterCollect(afterCollect)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+MM_HeapVerifier *
+MM_HeapVerifier::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HeapVerifier *heapVerifier = (MM_HeapVerifier *)env->getForge()->allocate(sizeof(MM_HeapVerifier), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != heapVerifier) {
+		new(heapVerifier) MM_HeapVerifier(env);
+		if (!heapVerifier->initialize(env)) {
+			heapVerifier->kill(env);
+			heapVerifier = NULL;
+		}
+	}
+	return heapVerifier;
+}
+
+void
+MM_HeapVerifier::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HeapVerifier::initialize(MM_EnvironmentBase *env)
+{
+	return true;
+}
+
+void
+MM_HeapVerifier::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+void
+MM_HeapVerifier::verify(MM_EnvironmentBase *env, MM_MarkMap *markMap, const char *when)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	Assert_MM_mustHaveExclusiveVMAccess(env->getOmrVMThread());
+
+	_markMap = ((NULL != markMap) && markMap->isMarkMapValid()) ? markMap : NULL;
+	_when = when;
+	_heapBase = _extensions->heap->getHeapBase();
+	_heapTop = _extensions->heap->getHeapTop();
+	_errorCount = 0;
+	_objectCount = 0;
+	_freeEntryCount = 0;
+
+	/* Without a valid mark map object boundaries are only known at the start of each region,
+	 * so regions are the units of work. With one, regions are split into chunks that start at
+	 * marked objects, as for MM_ParallelHeapWalker::allObjectsDoParallel().
+	 */
+	_chunkSize = _extensions->heap->getMemorySize();
+	if (NULL != _markMap) {
+		_chunkSize = MM_Math::roundToCeiling(_extensions->heapAlignment, _chunkSize / (_extensions->dispatcher->threadCountMaximum() * 8));
+	}
+
+	MM_ParallelHeapVerifyTask verifyTask(env, this, NULL != _markMap);
+	_extensions->dispatcher->run(env, &verifyTask);
+
+	if (0 != _errorCount) {
+		omrtty_err_printf("GC heap verification %s failed: %zu errors in %zu objects and %zu free entries\n", _when, _errorCount, _objectCount, _freeEntryCount);
+		Assert_MM_unreachable();
+	}
+}
+
+void
+MM_HeapVerifier::verifyHeapParallel(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionManager *regionManager = _extensions->heap->getHeapRegionManager();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	uintptr_t objectCount = 0;
+
+	regionManager->lock();
+	while (NULL != (region = regionIterator.nextRegion())) {
+		MM_MemorySubSpace *subSpace = region->getSubSpace();
+		/* Inactive (survivor) semi-space regions hold no objects */
+		if ((NULL == subSpace) || !subSpace->isActive()) {
+			continue;
+		}
+		void *regionTop = region->getHighAddress();
+		omrobjectptr_t object = NULL;
+		if (NULL != _markMap) {
+			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), regionTop, _markMap, _chunkSize);
+			while (NULL != (object = objectHeapIterator.nextObject())) {
+				verifyObject(env, object, regionTop, _markMap->isBitSet(object));
+				objectCount += 1;
+			}
+		} else if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_ObjectHeapIteratorAddressOrderedList objectHeapIterator(_extensions, region, false);
+			while (NULL != (object = objectHeapIterator.nextObject())) {
+				verifyObject(env, object, regionTop, false);
+				objectCount += 1;
+			}
+		}
+	}
+	regionManager->unlock();
+
+	MM_HeapMemorySubSpaceIterator subSpaceIterator(_extensions->heap);
+	MM_MemorySubSpace *subSpace = NULL;
+	while (NULL != (subSpace = subSpaceIterator.nextSubSpace())) {
+		if (subSpace->isLeafSubSpace() && subSpace->isActive() && (NULL != subSpace->getMemoryPool())) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				verifyFreeList(env, subSpace->getMemoryPool());
+			}
+		}
+	}
+
+	if ((NULL != _extensions->hugeObjectSpace) && J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		verifyHugeObjects(env);
+	}
+
+	MM_AtomicOperations::add(&_objectCount, objectCount);
+}
+
+void
+MM_HeapVerifier::verifyObject(MM_EnvironmentBase *env, omrobjectptr_t object, void *regionTop, bool marked)
+{
+	if (0 != ((uintptr_t)object & (_extensions->getObjectAlignmentInBytes() - 1))) {
+		reportError(env, "misaligned object", object, NULL);
+		return;
+	}
+
+	uintptr_t size = _extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+	if ((size < OMR_MINIMUM_OBJECT_SIZE) || ((NULL != regionTop) && (size > ((uintptr_t)regionTop - (uintptr_t)object)))) {
+		reportError(env, "invalid object size", object, (void *)size);
+		return;
+	}
+
+	GC_ObjectIterator objectIterator(_extensions->getOmrVM(), object);
+	GC_SlotObject *slotObject = NULL;
+	while (NULL != (slotObject = objectIterator.nextSlot())) {
+		omrobjectptr_t reference = slotObject->readReferenceFromSlot();
+		if (NULL != reference) {
+			verifyReference(env, object, reference, marked);
+		}
+	}
+}
+
+void
+MM_HeapVerifier::verifyReference(MM_EnvironmentBase *env, omrobjectptr_t object, omrobjectptr_t reference, bool marked)
+{
+	if (0 != ((uintptr_t)reference & (_extensions->getObjectAlignmentInBytes() - 1))) {
+		reportError(env, "misaligned reference", object, reference);
+	} else if (isHeapAddress(reference)) {
+		/* References held by dead objects may point to memory that has since been freed */
+		if (marked) {
+			if (_extensions->objectModel.isDeadObject(reference)) {
+				reportError(env, "reference to a hole", object, reference);
+			} else if (!_markMap->isBitSet(reference)) {
+				reportError(env, "reference to an unmarked object", object, reference);
+			}
+		}
+	} else if (NULL == _extensions->hugeObjectSpace) {
+		reportError(env, "reference outside the heap", object, reference);
+	} else if (marked && !_extensions->hugeObjectSpace->isValidHugeObject(reference)) {
+		reportError(env, "reference to an invalid huge object", object, reference);
+	}
+}
+
+void
+MM_HeapVerifier::verifyFreeList(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool)
+{
+	uintptr_t minimumFreeEntrySize = memoryPool->getMinimumFreeEntrySize();
+	uintptr_t freeEntryCount = 0;
+	void *previousTop = NULL;
+
+	MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getFirstFreeStartingAddr(env);
+	while (NULL != freeEntry) {
+		freeEntryCount += 1;
+		if (!isHeapAddress(freeEntry) || (0 != ((uintptr_t)freeEntry & (_extensions->getObjectAlignmentInBytes() - 1)))) {
+			/* the entry cannot be followed safely */
+			reportError(env, "invalid free entry", freeEntry, previousTop);
+			break;
+		}
+		if ((void *)freeEntry < previousTop) {
+			reportError(env, "free entry out of order or overlapping", freeEntry, previousTop);
+		}
+		if (!_extensions->objectModel.isDeadObject(freeEntry)) {
+			reportError(env, "free entry is not a hole", freeEntry, NULL);
+			break;
+		}
+		uintptr_t size = freeEntry->getSize();
+		if ((size < minimumFreeEntrySize) || (size > ((uintptr_t)_heapTop - (uintptr_t)freeEntry))) {
+			reportError(env, "invalid free entry size", freeEntry, (void *)size);
+			break;
+		}
+		if ((NULL != _markMap) && _markMap->isBitSet((omrobjectptr_t)freeEntry)) {
+			reportError(env, "marked free entry", freeEntry, NULL);
+		}
+		previousTop = freeEntry->afterEnd();
+		freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getNextFreeStartingAddr(env, freeEntry);
+	}
+
+	MM_AtomicOperations::add(&_freeEntryCount, freeEntryCount);
+}
+
+void
+MM_HeapVerifier::verifyHugeObjects(MM_EnvironmentBase *env)
+{
+	MM_HugeObjectSpace *hugeObjectSpace = _extensions->hugeObjectSpace;
+	uintptr_t objectCount = 0;
+	omrobjectptr_t object = NULL;
+
+	/* Huge objects that survive the sweep of a global collect are live, and so are those allocated since */
+	while (NULL != (object = hugeObjectSpace->nextObject(object))) {
+		verifyObject(env, object, NULL, NULL != _markMap);
+		objectCount += 1;
+	}
+
+	MM_AtomicOperations::add(&_objectCount, objectCount);
+}
+
+void
+MM_HeapVerifier::reportError(MM_EnvironmentBase *env, const char *problem, void *address, void *detail)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t errorCount = MM_AtomicOperations::add(&_errorCount, 1);
+	if (errorCount <= HEAP_VERIFIER_MAX_REPORTED_ERRORS) {
+		omrtty_err_printf("GC heap verification %s: %s at %p (%p)\n", _when, problem, address, detail);
+	}
+}
+
+MM_HeapVerifier::MM_HeapVerifier(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _markMap(NULL)
+	, _when(NULL)
+	, _heapBase(NULL)
+	, _heapTop(NULL)
+	, _chunkSize(0)
+	, _errorCount(0)
+	, _objectCount(0)
+	, _freeEntryCount(0)
+{
+	_typeId = __FUNCTION__;
+}
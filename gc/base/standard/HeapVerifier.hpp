@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(HEAPVERIFIER_HPP_)
+#define HEAPVERIFIER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "objectdescription.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_HeapRegionDescriptor;
+class MM_MarkMap;
+class MM_MemoryPool;
+
+/* Number of verification failures reported in detail by each verification pass */
+#define HEAP_VERIFIER_MAX_REPORTED_ERRORS 16
+
+/**
+ * Parallel heap verifier run by the GC threads before and/or after collections
+ * (see GCExtensionsBase::verifyHeapBeforeGC and GCExtensionsBase::verifyHeapAfterGC).
+ *
+ * Every active heap region is walked in parallel chunks the same way as
+ * MM_ParallelHeapWalker::allObjectsDoParallel() does, and the reference slots of every object
+ * are visited through the glue object iterator. Each object must be aligned, at least
+ * OMR_MINIMUM_OBJECT_SIZE bytes and contained in its region, and each reference must be an
+ * aligned pointer into the heap (or, with a huge object space, to a huge object).
+ * When a valid mark map is supplied (after a global collect that did not compact), every
+ * reference held by a marked object must also be marked and must not be a hole. The free
+ * lists of all active memory pools are checked to be address ordered, non-overlapping and
+ * made of holes of at least the minimum free entry size that are not marked.
+ *
+ * References held by unmarked objects are only checked to point into the heap, since dead
+ * objects left in the heap by sweep may refer to memory that has since been freed.
+ *
+ * Verification failures are reported to stderr and the verifier then asserts, so that
+ * corruption is caught at the collection that observed it rather than at a later crash.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_HeapVerifier : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	MM_GCExtensionsBase *_extensions;
+	MM_MarkMap *_markMap; /**< mark map that references of marked objects are checked against, NULL for structural checks only */
+	const char *_when; /**< description of the point in the collection being verified, for reports */
+	void *_heapBase; /**< base of the heap reservation */
+	void *_heapTop; /**< top of the heap reservation */
+	uintptr_t _chunkSize; /**< size of the region chunks walked in parallel */
+	volatile uintptr_t _errorCount; /**< verification failures found by the current pass */
+	volatile uintptr_t _objectCount; /**< objects verified by the current pass */
+	volatile uintptr_t _freeEntryCount; /**< free list entries verified by the current pass */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_HeapVerifier *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Verify the heap with all GC threads. The caller must have exclusive VM access, all
+	 * allocation caches must be flushed and the heap must be walkable.
+	 * @param markMap valid mark map of the collect that just finished, or NULL
+	 * @param when description of the point in the collection being verified
+	 */
+	void verify(MM_EnvironmentBase *env, MM_MarkMap *markMap, const char *when);
+
+	/**
+	 * Verify a share of the heap. Called by each GC thread running the verification task.
+	 */
+	void verifyHeapParallel(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getObjectCount() { return _objectCount; }
+	MMINLINE uintptr_t getFreeEntryCount() { return _freeEntryCount; }
+
+	MM_HeapVerifier(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	void verifyObject(MM_EnvironmentBase *env, omrobjectptr_t object, void *regionTop, bool marked);
+	void verifyReference(MM_EnvironmentBase *env, omrobjectptr_t object, omrobjectptr_t reference, bool marked);
+	void verifyFreeList(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
+	void verifyHugeObjects(MM_EnvironmentBase *env);
+	void reportError(MM_EnvironmentBase *env, const char *problem, void *address, void *detail);
+
+	MMINLINE bool
+	isHeapAddress(void *address)
+	{
+		return (address >= _heapBase) && (address < _heapTop);
+	}
+};
+
+#endif /* HEAPVERIFIER_HPP_ */
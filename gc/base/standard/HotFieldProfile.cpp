@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "omrport.h"
+
+#include <string.h>
+
+#include "HotFieldProfile.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+MM_HotFieldProfile *
+MM_HotFieldProfile::newInstance(MM_EnvironmentBase *env, uintptr_t tableSize, uintptr_t cacheLineSize)
+{
+	MM_HotFieldProfile *profile = (MM_HotFieldProfile *)env->getForge()->allocate(sizeof(MM_HotFieldProfile), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != profile) {
+		/* round the table size up to a power of 2 so that hashes can be masked */
+		uintptr_t roundedTableSize = HOT_FIELD_PROFILE_MAX_PROBES;
+		while (roundedTableSize < tableSize) {
+			roundedTableSize <<= 1;
+		}
+		new(profile) MM_HotFieldProfile(env, roundedTableSize, cacheLineSize);
+		if (!profile->initialize(env)) {
+			profile->kill(env);
+			profile = NULL;
+		}
+	}
+	return profile;
+}
+
+void
+MM_HotFieldProfile::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HotFieldProfile::initialize(MM_EnvironmentBase *env)
+{
+	uintptr_t tableSizeInBytes = _tableSize * sizeof(Entry);
+	_table = (Entry *)env->getForge()->allocate(tableSizeInBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _table) {
+		return false;
+	}
+	memset((void *)_table, 0, tableSizeInBytes);
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		memset(_table[i].hotFieldOffsets, U_8_MAX, sizeof(_table[i].hotFieldOffsets));
+	}
+
+	uintptr_t referenceSize = _extensions->compressObjectReferences() ? sizeof(uint32_t) : sizeof(uintptr_t);
+	while (((uintptr_t)1 << _referenceSizeShift) < referenceSize) {
+		_referenceSizeShift += 1;
+	}
+
+	return true;
+}
+
+void
+MM_HotFieldProfile::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _table) {
+		env->getForge()->free(_table);
+		_table = NULL;
+	}
+}
+
+void
+MM_HotFieldProfile::rankHotFields(MM_EnvironmentBase *env, uintptr_t minimumSamples)
+{
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		Entry *entry = &_table[i];
+		uintptr_t sampleCount = entry->sampleCount;
+		if ((0 == entry->classToken) || (0 == sampleCount) || (sampleCount < minimumSamples)) {
+			continue;
+		}
+
+		uintptr_t hotSlots[HOT_FIELD_PROFILE_HOT_FIELD_COUNT];
+		uint32_t hotCounts[HOT_FIELD_PROFILE_HOT_FIELD_COUNT];
+		uintptr_t hotSlotCount = 0;
+		for (uintptr_t slot = 0; slot < HOT_FIELD_PROFILE_MAX_SLOTS; slot++) {
+			uint32_t count = entry->fieldCounts[slot];
+			/* a field is only hot if it accounts for at least 10% of the samples of its class */
+			if ((0 == count) || (((uintptr_t)count * 10) < sampleCount)) {
+				continue;
+			}
+			/* insertion into the (descending) list of the hottest slots seen so far */
+			uintptr_t position = hotSlotCount;
+			while ((0 < position) && (hotCounts[position - 1] < count)) {
+				if (position < HOT_FIELD_PROFILE_HOT_FIELD_COUNT) {
+					hotSlots[position] = hotSlots[position - 1];
+					hotCounts[position] = hotCounts[position - 1];
+				}
+				position -= 1;
+			}
+			if (position < HOT_FIELD_PROFILE_HOT_FIELD_COUNT) {
+				hotSlots[position] = slot;
+				hotCounts[position] = count;
+				if (hotSlotCount < HOT_FIELD_PROFILE_HOT_FIELD_COUNT) {
+					hotSlotCount += 1;
+				}
+			}
+		}
+
+		for (uintptr_t hot = 0; hot < HOT_FIELD_PROFILE_HOT_FIELD_COUNT; hot++) {
+			entry->hotFieldOffsets[hot] = (hot < hotSlotCount) ? (uint8_t)hotSlots[hot] : U_8_MAX;
+		}
+
+		/* decay the samples so that the ranking follows changes in the application's behaviour */
+		for (uintptr_t slot = 0; slot < HOT_FIELD_PROFILE_MAX_SLOTS; slot++) {
+			entry->fieldCounts[slot] >>= 1;
+		}
+		entry->sampleCount = sampleCount >> 1;
+	}
+}
+
+void
+MM_HotFieldProfile::report(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t totalCopies = 0;
+	uintptr_t totalColocations = 0;
+
+	omrtty_printf("Hot field profile (class token, samples, hot field offsets, hot field copies, co-located, co-location %%):\n");
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		Entry *entry = &_table[i];
+		if (0 == entry->classToken) {
+			continue;
+		}
+		uintptr_t copies = entry->hotFieldCopies;
+		uintptr_t colocations = entry->hotFieldColocations;
+		uintptr_t percent = (0 == copies) ? 0 : ((colocations * 100) / copies);
+		intptr_t offsets[HOT_FIELD_PROFILE_HOT_FIELD_COUNT];
+		for (uintptr_t hot = 0; hot < HOT_FIELD_PROFILE_HOT_FIELD_COUNT; hot++) {
+			/* unused offsets are reported as -1 */
+			offsets[hot] = (U_8_MAX == entry->hotFieldOffsets[hot]) ? -1 : (intptr_t)entry->hotFieldOffsets[hot];
+		}
+		omrtty_printf("  0x%zx %zu [%zd %zd %zd] %zu %zu %zu%%\n",
+				entry->classToken, entry->sampleCount, offsets[0], offsets[1], offsets[2],
+				copies, colocations, percent);
+		totalCopies += copies;
+		totalColocations += colocations;
+		entry->hotFieldCopies = 0;
+		entry->hotFieldColocations = 0;
+	}
+	omrtty_printf("  total: %zu hot field copies, %zu co-located (%zu%%), %zu samples dropped\n",
+			totalCopies, totalColocations, (0 == totalCopies) ? 0 : ((totalColocations * 100) / totalCopies), _droppedSamples);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(HOTFIELDPROFILE_HPP_)
+#define HOTFIELDPROFILE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+class MM_GCExtensionsBase;
+
+/* Number of leading reference slots of an object that can be profiled */
+#define HOT_FIELD_PROFILE_MAX_SLOTS 32
+/* Number of hot fields ranked per class, matching the 3 hot field offsets of the object model */
+#define HOT_FIELD_PROFILE_HOT_FIELD_COUNT 3
+/* Maximum number of table entries probed before a class token is dropped */
+#define HOT_FIELD_PROFILE_MAX_PROBES 8
+
+/**
+ * Sampled per-class reference field profile used by the scavenger to choose hot fields
+ * for languages that do not declare them through the object model.
+ *
+ * Classes are identified by an opaque non-zero token supplied by the language (see
+ * MM_ScavengerDelegate::getHotFieldProfileToken()). Samples are recorded by the scavenger
+ * while scanning and, optionally, by the language itself through recordFieldAccess().
+ * Between scavenges the samples are ranked into up to HOT_FIELD_PROFILE_HOT_FIELD_COUNT
+ * hot field offsets per class, which drive depth copying of referents when an object is
+ * tenured so that they are laid out on the same cache lines as their parent.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_HotFieldProfile : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	struct Entry {
+		volatile uintptr_t classToken; /**< language supplied class token, 0 if the entry is unused */
+		volatile uint32_t fieldCounts[HOT_FIELD_PROFILE_MAX_SLOTS]; /**< samples per reference slot, indexed by field offset / reference size */
+		volatile uintptr_t sampleCount; /**< samples recorded against this class since the last ranking */
+		uint8_t hotFieldOffsets[HOT_FIELD_PROFILE_HOT_FIELD_COUNT]; /**< ranked hot field offsets in slots (as for MM_ObjectModel::getHotFieldOffset()), U_8_MAX terminated; only updated between scavenges */
+		volatile uintptr_t hotFieldCopies; /**< referents depth copied into tenure through a profiled hot field */
+		volatile uintptr_t hotFieldColocations; /**< referents from hotFieldCopies placed on the cache line of the referencing slot or the one following it */
+	};
+
+protected:
+private:
+	MM_GCExtensionsBase *_extensions;
+	Entry *_table; /**< open addressed table of class entries */
+	uintptr_t _tableSize; /**< number of entries in _table, a power of 2 */
+	uintptr_t _referenceSizeShift; /**< log2 of the size of a reference slot */
+	uintptr_t _cacheLineSize; /**< cache line size used to measure co-location */
+	volatile uintptr_t _droppedSamples; /**< samples dropped because no entry could be found or claimed for their class */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_HotFieldProfile *newInstance(MM_EnvironmentBase *env, uintptr_t tableSize, uintptr_t cacheLineSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the entry for a class, optionally claiming a free entry for it.
+	 * @param classToken the non-zero class token
+	 * @param create true if an unused entry should be claimed for an unknown class
+	 * @return the entry for the class, or NULL if not found (or the table is full)
+	 */
+	MMINLINE Entry *
+	findEntry(uintptr_t classToken, bool create)
+	{
+		uintptr_t mask = _tableSize - 1;
+		uintptr_t index = hashToken(classToken) & mask;
+		for (uintptr_t probe = 0; probe < HOT_FIELD_PROFILE_MAX_PROBES; probe++) {
+			Entry *entry = &_table[(index + probe) & mask];
+			uintptr_t entryToken = entry->classToken;
+			if (classToken == entryToken) {
+				return entry;
+			}
+			if (0 == entryToken) {
+				if (!create) {
+					break;
+				}
+				entryToken = MM_AtomicOperations::lockCompareExchange(&entry->classToken, 0, classToken);
+				if ((0 == entryToken) || (classToken == entryToken)) {
+					return entry;
+				}
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * Record one sampled access of a reference field. May be called concurrently by GC threads
+	 * during scan, or by mutator threads of languages that sample field accesses themselves.
+	 * @param classToken the non-zero class token of the object holding the field
+	 * @param fieldOffset offset of the field in bytes from the start of the object
+	 */
+	MMINLINE void
+	recordFieldAccess(uintptr_t classToken, uintptr_t fieldOffset)
+	{
+		uintptr_t slotIndex = fieldOffset >> _referenceSizeShift;
+		if (slotIndex < HOT_FIELD_PROFILE_MAX_SLOTS) {
+			Entry *entry = findEntry(classToken, true);
+			if (NULL != entry) {
+				MM_AtomicOperations::addU32(&entry->fieldCounts[slotIndex], 1);
+				MM_AtomicOperations::add(&entry->sampleCount, 1);
+				return;
+			}
+		}
+		MM_AtomicOperations::add(&_droppedSamples, 1);
+	}
+
+	/**
+	 * Record that a referent has been depth copied into tenure through a profiled hot field.
+	 * @param entry the profile entry for the class of the referencing object
+	 * @param slotAddress address of the hot field in the (tenured) referencing object
+	 * @param referent the new address of the copied referent
+	 */
+	MMINLINE void
+	recordHotFieldCopy(Entry *entry, void *slotAddress, void *referent)
+	{
+		MM_AtomicOperations::add(&entry->hotFieldCopies, 1);
+		uintptr_t slotLine = (uintptr_t)slotAddress / _cacheLineSize;
+		uintptr_t referentLine = (uintptr_t)referent / _cacheLineSize;
+		if ((referentLine >= slotLine) && ((referentLine - slotLine) <= 1)) {
+			MM_AtomicOperations::add(&entry->hotFieldColocations, 1);
+		}
+	}
+
+	/**
+	 * Rank the samples recorded since the previous call into hot field offsets for each class and decay
+	 * the samples so that the profile follows phase changes. Must be called by a single thread while no
+	 * scavenge is in progress.
+	 * @param minimumSamples classes with fewer samples keep their previous ranking
+	 */
+	void rankHotFields(MM_EnvironmentBase *env, uintptr_t minimumSamples);
+
+	/**
+	 * Print the ranked hot fields and the cache line co-location achieved for each profiled class.
+	 */
+	void report(MM_EnvironmentBase *env);
+
+	MM_HotFieldProfile(MM_EnvironmentBase *env, uintptr_t tableSize, uintptr_t cacheLineSize)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _table(NULL)
+		, _tableSize(tableSize)
+		, _referenceSizeShift(0)
+		, _cacheLineSize(cacheLineSize)
+		, _droppedSamples(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	MMINLINE static uintptr_t
+	hashToken(uintptr_t classToken)
+	{
+		/* tokens are frequently aligned pointers; fold the high bits into the low ones */
+		uintptr_t hash = classToken ^ (classToken >> 7) ^ (classToken >> 17);
+		return hash;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* HOTFIELDPROFILE_HPP_ */
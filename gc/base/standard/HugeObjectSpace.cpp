@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#include "omrport.h"
+
+#include <string.h>
+
+#include "HugeObjectSpace.hpp"
+
+#include "AllocateDescription.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MarkingScheme.hpp"
+#include "Math.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+
+MM_HugeObjectSpace *
+MM_HugeObjectSpace::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HugeObjectSpace *space = (MM_HugeObjectSpace *)env->getForge()->allocate(sizeof(MM_HugeObjectSpace), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != space) {
+		new(space) MM_HugeObjectSpace(env);
+		if (!space->initialize(env)) {
+			space->kill(env);
+			space = NULL;
+		}
+	}
+	return space;
+}
+
+void
+MM_HugeObjectSpace::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HugeObjectSpace::initialize(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "MM_HugeObjectSpace::_mutex")) {
+		return false;
+	}
+
+	_heapBase = _extensions->heap->getHeapBase();
+	_heapTop = _extensions->heap->getHeapTop();
+	_threshold = _extensions->hugeObjectThreshold;
+	_pageSize = omrvmem_supported_page_sizes()[0];
+	_headerSize = MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), sizeof(Entry));
+	_maximumSize = _extensions->hugeObjectSpaceMaximumSize;
+	if (0 == _maximumSize) {
+		_maximumSize = _extensions->memoryMax;
+	}
+
+	return true;
+}
+
+void
+MM_HugeObjectSpace::tearDown(MM_EnvironmentBase *env)
+{
+	while (NULL != _entries) {
+		release(env, _entries);
+	}
+
+	if (NULL != _mutex) {
+		omrthread_monitor_destroy(_mutex);
+		_mutex = NULL;
+	}
+}
+
+void *
+MM_HugeObjectSpace::reserve(MM_EnvironmentBase *env, uintptr_t objectSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t reserveSize = MM_Math::roundToCeiling(_pageSize, _headerSize + objectSize);
+	void *result = NULL;
+
+	omrthread_monitor_enter(_mutex);
+	if ((_bytesReserved + reserveSize) <= _maximumSize) {
+		J9PortVmemIdentifier identifier;
+		J9PortVmemParams params;
+		memset(&identifier, 0, sizeof(identifier));
+		omrvmem_vmem_params_init(&params);
+		params.byteAmount = reserveSize;
+		params.mode = OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+		params.pageSize = _pageSize;
+		params.category = OMRMEM_CATEGORY_MM_RUNTIME_HEAP;
+
+		Entry *entry = (Entry *)omrvmem_reserve_memory_ex(&identifier, &params);
+		if (NULL != entry) {
+			/* freshly committed pages are zero filled, only the header needs initializing */
+			entry->eyecatcher = HUGE_OBJECT_SPACE_EYECATCHER;
+			entry->reserveSize = reserveSize;
+			entry->flags = 0;
+			entry->identifier = identifier;
+			entry->previous = NULL;
+			entry->next = _entries;
+			if (NULL != _entries) {
+				_entries->previous = entry;
+			}
+			_entries = entry;
+			_bytesReserved += reserveSize;
+			_objectCount += 1;
+			result = (void *)getObject(entry);
+		}
+	}
+	omrthread_monitor_exit(_mutex);
+
+	return result;
+}
+
+void
+MM_HugeObjectSpace::release(MM_EnvironmentBase *env, Entry *entry)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL != entry->previous) {
+		entry->previous->next = entry->next;
+	} else {
+		_entries = entry->next;
+	}
+	if (NULL != entry->next) {
+		entry->next->previous = entry->previous;
+	}
+
+	/* the identifier lives in the memory being released */
+	J9PortVmemIdentifier identifier = entry->identifier;
+	uintptr_t reserveSize = entry->reserveSize;
+	_bytesReserved -= reserveSize;
+	_objectCount -= 1;
+	omrvmem_free_memory((void *)entry, reserveSize, &identifier);
+}
+
+void
+MM_HugeObjectSpace::collect(MM_EnvironmentBase *env)
+{
+	_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_IMPLICIT_GC_DEFAULT);
+}
+
+void *
+MM_HugeObjectSpace::allocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool collectOnFailure)
+{
+	uintptr_t objectSize = allocDescription->getBytesRequested();
+	void *objectPtr = reserve(env, objectSize);
+
+	if ((NULL == objectPtr) && collectOnFailure) {
+		collect(env);
+		objectPtr = reserve(env, objectSize);
+	}
+
+	if (NULL != objectPtr) {
+		/* huge objects are old, flag them as the tenure subspace would */
+		allocDescription->setObjectFlags(_extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getObjectFlags());
+	}
+
+	return objectPtr;
+}
+
+void
+MM_HugeObjectSpace::sweep(MM_EnvironmentBase *env)
+{
+	uintptr_t bytesReserved = _bytesReserved;
+	uintptr_t objectCount = _objectCount;
+
+	Entry *entry = _entries;
+	while (NULL != entry) {
+		Entry *next = entry->next;
+		if (0 == (entry->flags & HUGE_OBJECT_FLAG_MARKED)) {
+			release(env, entry);
+		} else {
+			entry->flags = 0;
+		}
+		entry = next;
+	}
+
+	_bytesFreed = bytesReserved - _bytesReserved;
+	_objectsFreed = objectCount - _objectCount;
+}
+
+void
+MM_HugeObjectSpace::scanOverflowedObjects(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme)
+{
+	for (Entry *entry = _entries; NULL != entry; entry = entry->next) {
+		if (0 != (entry->flags & HUGE_OBJECT_FLAG_OVERFLOWED)) {
+			entry->flags &= ~(uintptr_t)HUGE_OBJECT_FLAG_OVERFLOWED;
+			markingScheme->scanObject(env, getObject(entry), SCAN_REASON_OVERFLOWED_OBJECT);
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
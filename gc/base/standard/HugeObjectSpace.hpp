@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(HUGEOBJECTSPACE_HPP_)
+#define HUGEOBJECTSPACE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "ModronAssertions.h"
+
+class MM_AllocateDescription;
+class MM_GCExtensionsBase;
+class MM_MarkingScheme;
+
+/* Eyecatcher stored in the header of every huge object reservation ("HUGE") */
+#define HUGE_OBJECT_SPACE_EYECATCHER 0x48554745
+/* Entry flag set when the object has been marked by the current global collect */
+#define HUGE_OBJECT_FLAG_MARKED 0x1
+/* Entry flag set when the object was dropped on work packet overflow and must be rescanned */
+#define HUGE_OBJECT_FLAG_OVERFLOWED 0x2
+
+/**
+ * Off-heap space for huge objects. Every object of at least hugeObjectThreshold bytes
+ * is allocated in its own virtual memory reservation, preceded by a small header that
+ * links it into the space and holds its mark state. Huge objects are never moved: the
+ * scavenger treats them as old and compaction only fixes up their slots. They are freed
+ * by releasing their reservation when a global collect finds them unmarked, so they
+ * neither fragment the tenure space nor drive compactions.
+ *
+ * Huge objects are allocated as old objects. As for allocate_tenured allocations, the
+ * language must not elide generational write barriers when initializing their slots.
+ * Card marking does not cover memory outside the heap, so the space is not created when
+ * concurrent mark is enabled.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_HugeObjectSpace : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	struct Entry {
+		uintptr_t eyecatcher; /**< HUGE_OBJECT_SPACE_EYECATCHER */
+		Entry *next; /**< next entry in the space */
+		Entry *previous; /**< previous entry in the space */
+		uintptr_t reserveSize; /**< size of the reservation holding this header and the object */
+		volatile uintptr_t flags; /**< HUGE_OBJECT_FLAG_* bits */
+		J9PortVmemIdentifier identifier; /**< port library handle for the reservation */
+	};
+
+protected:
+private:
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _mutex; /**< serializes allocations against each other */
+	Entry *_entries; /**< list of all huge objects */
+	void *_heapBase; /**< base of the heap reservation, huge objects lie outside [_heapBase, _heapTop) */
+	void *_heapTop; /**< top of the heap reservation */
+	uintptr_t _threshold; /**< minimum size in bytes of a huge object */
+	uintptr_t _pageSize; /**< page size used for reservations */
+	uintptr_t _headerSize; /**< bytes preceding each object in its reservation, at least sizeof(Entry) */
+	uintptr_t _maximumSize; /**< bytes that may be reserved before allocation requires a global collect */
+	volatile uintptr_t _bytesReserved; /**< bytes currently reserved for huge objects */
+	volatile uintptr_t _objectCount; /**< number of huge objects currently allocated */
+	uintptr_t _bytesFreed; /**< bytes released by the last sweep */
+	uintptr_t _objectsFreed; /**< objects released by the last sweep */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_HugeObjectSpace *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Determine whether an allocation of the given size belongs in the huge object space.
+	 * @param[in] sizeInBytes adjusted allocation size, including the object header
+	 * @return true if the allocation should be satisfied by allocate()
+	 */
+	MMINLINE bool isHugeAllocation(uintptr_t sizeInBytes) { return sizeInBytes >= _threshold; }
+
+	/**
+	 * Determine whether an object lives in the huge object space. The heap is a single
+	 * reservation so any valid object outside of it is a huge object.
+	 * @param[in] objectPtr a valid object pointer
+	 * @return true if the object was allocated by allocate()
+	 */
+	MMINLINE bool
+	isHugeObject(omrobjectptr_t objectPtr)
+	{
+		return ((void *)objectPtr < _heapBase) || ((void *)objectPtr >= _heapTop);
+	}
+
+	MMINLINE Entry *
+	getEntry(omrobjectptr_t objectPtr)
+	{
+		Entry *entry = (Entry *)((uintptr_t)objectPtr - _headerSize);
+		Assert_MM_true(HUGE_OBJECT_SPACE_EYECATCHER == entry->eyecatcher);
+		return entry;
+	}
+
+	MMINLINE omrobjectptr_t getObject(Entry *entry) { return (omrobjectptr_t)((uintptr_t)entry + _headerSize); }
+
+	/**
+	 * Check whether a pointer outside the heap is a huge object, without dereferencing it.
+	 * This walks the whole space, so it is only meant for verification.
+	 * @return true if objectPtr is the start of a huge object in this space
+	 */
+	MMINLINE bool
+	isValidHugeObject(omrobjectptr_t objectPtr)
+	{
+		for (Entry *entry = _entries; NULL != entry; entry = entry->next) {
+			if (objectPtr == getObject(entry)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Walk the huge objects. The list must not be modified by allocation or sweep during the walk.
+	 * @param[in] objectPtr previous object returned, or NULL to start the walk
+	 * @return the next huge object, or NULL when all have been returned
+	 */
+	MMINLINE omrobjectptr_t
+	nextObject(omrobjectptr_t objectPtr)
+	{
+		Entry *entry = (NULL == objectPtr) ? _entries : getEntry(objectPtr)->next;
+		return (NULL == entry) ? NULL : getObject(entry);
+	}
+
+	/**
+	 * Atomically set the mark flag of a huge object.
+	 * @return true if the object was marked by this call, false if it was already marked
+	 */
+	MMINLINE bool atomicSetMarked(omrobjectptr_t objectPtr) { return atomicSetFlag(getEntry(objectPtr), HUGE_OBJECT_FLAG_MARKED); }
+	MMINLINE bool isMarked(omrobjectptr_t objectPtr) { return 0 != (getEntry(objectPtr)->flags & HUGE_OBJECT_FLAG_MARKED); }
+
+	/**
+	 * Record a marked huge object that could not be pushed to a work packet so that it
+	 * is rescanned by scanOverflowedObjects().
+	 */
+	MMINLINE void setOverflowed(omrobjectptr_t objectPtr) { atomicSetFlag(getEntry(objectPtr), HUGE_OBJECT_FLAG_OVERFLOWED); }
+
+	/**
+	 * Allocate a huge object in its own reservation. The memory returned is zeroed.
+	 * If collection is allowed and the space is full, or the reservation fails, a global
+	 * collect is run and the allocation retried once.
+	 * @param[in] env calling thread environment
+	 * @param[in] allocDescription describes the (adjusted) size of the allocation
+	 * @param[in] collectOnFailure true if a global collect may be run to satisfy the allocation
+	 * @return the object memory, or NULL if the allocation failed
+	 */
+	void *allocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool collectOnFailure);
+
+	/**
+	 * Release the reservations of all huge objects left unmarked by a global collect and
+	 * clear the mark flag of the survivors. Called single threaded after marking completes.
+	 */
+	void sweep(MM_EnvironmentBase *env);
+
+	/**
+	 * Rescan huge objects that overflowed work packets during marking.
+	 * @param[in] env calling thread environment
+	 * @param[in] markingScheme marking scheme to scan the objects with
+	 */
+	void scanOverflowedObjects(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
+
+	MMINLINE uintptr_t getBytesReserved() { return _bytesReserved; }
+	MMINLINE uintptr_t getObjectCount() { return _objectCount; }
+	MMINLINE uintptr_t getBytesFreed() { return _bytesFreed; }
+	MMINLINE uintptr_t getObjectsFreed() { return _objectsFreed; }
+
+	MM_HugeObjectSpace(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _mutex(NULL)
+		, _entries(NULL)
+		, _heapBase(NULL)
+		, _heapTop(NULL)
+		, _threshold(0)
+		, _pageSize(0)
+		, _headerSize(0)
+		, _maximumSize(0)
+		, _bytesReserved(0)
+		, _objectCount(0)
+		, _bytesFreed(0)
+		, _objectsFreed(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	MMINLINE bool
+	atomicSetFlag(Entry *entry, uintptr_t flag)
+	{
+		uintptr_t oldFlags = entry->flags;
+		while (0 == (oldFlags & flag)) {
+			uintptr_t foundFlags = MM_AtomicOperations::lockCompareExchange(&entry->flags, oldFlags, oldFlags | flag);
+			if (foundFlags == oldFlags) {
+				return true;
+			}
+			oldFlags = foundFlags;
+		}
+		return false;
+	}
+
+	void *reserve(MM_EnvironmentBase *env, uintptr_t objectSize);
+	void release(MM_EnvironmentBase *env, Entry *entry);
+	void collect(MM_EnvironmentBase *env);
+};
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+#endif /* HUGEOBJECTSPACE_HPP_ */
@@ -31,6 +31,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HugeObjectSpace.hpp"
 #include "Packet.hpp"
 #include "ParallelTask.hpp"
 #include "WorkPackets.hpp"
@@ -126,6 +127,15 @@ MM_OverflowStandard::overflowItemInternal(MM_EnvironmentBase *env, void *item)
 
 		/* Perform language specific actions */
 		markingScheme->getMarkingDelegate()->handleWorkPacketOverflowItem(env,objectPtr);
+	} else if ((PACKET_ARRAY_SPLIT_TAG != ((uintptr_t)item & PACKET_ARRAY_SPLIT_TAG)) && (NULL != _extensions->hugeObjectSpace)) {
+		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)_extensions->getGlobalCollector();
+		omrobjectptr_t objectPtr = (omrobjectptr_t)item;
+
+		/* huge objects have no mark map coverage, the overflow is recorded in their header */
+		_extensions->hugeObjectSpace->setOverflowed(objectPtr);
+
+		/* Perform language specific actions */
+		globalCollector->getMarkingScheme()->getMarkingDelegate()->handleWorkPacketOverflowItem(env, objectPtr);
 	}
 }
 
@@ -165,6 +175,10 @@ MM_OverflowStandard::handleOverflow(MM_EnvironmentBase *env)
 				}
 			}
 		}
+
+		if (NULL != _extensions->hugeObjectSpace) {
+			_extensions->hugeObjectSpace->scanOverflowedObjects(env, markingScheme);
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
@@ -49,6 +49,7 @@ private:
 	bool _rebuildMarkBits;
 	bool _aggressive;
 	bool _nurseryOnly; /**< if true, Nursery is only compacted and Tenure fixed-up via RS, otherwise whole heap is compacted/fixed-up */
+	uintptr_t _partialCompactTarget; /**< if not 0, only a window of the heap able to free this many contiguous bytes is compacted */
 
 public:
 	virtual uintptr_t getVMStateID();
@@ -60,12 +61,13 @@ public:
 	/**
 	 * Create an ParallelCompactTask object.
 	 */
-	MM_ParallelCompactTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_CompactScheme *compactScheme, bool rebuildMarkBits, bool aggressive, bool nurseryOnly) :
+	MM_ParallelCompactTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_CompactScheme *compactScheme, bool rebuildMarkBits, bool aggressive, bool nurseryOnly, uintptr_t partialCompactTarget) :
 		MM_ParallelTask(env, dispatcher),
 		_compactScheme(compactScheme),
 		_rebuildMarkBits(rebuildMarkBits),
 		_aggressive(aggressive),
-		_nurseryOnly(nurseryOnly)
+		_nurseryOnly(nurseryOnly),
+		_partialCompactTarget(partialCompactTarget)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -43,6 +43,8 @@
 #include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
+#include "HeapVerifier.hpp"
+#include "HugeObjectSpace.hpp"
 #include "MarkingScheme.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -63,6 +65,7 @@
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetSummary.hpp"
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #include "WorkPackets.hpp"
@@ -220,7 +223,7 @@ clearFreeEntry(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrob
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 /**
- * Fix the heap if the remembered set for the scavenger is in an overflow state.
+ * Fix the heap if the remembered set for the scavenger is in an overflow state, or has summary chunks to walk.
  */
 static void
 hookGlobalGcSweepEndRsoSafetyFixHeap(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
@@ -229,7 +232,8 @@ hookGlobalGcSweepEndRsoSafetyFixHeap(J9HookInterface** hook, uintptr_t eventNum,
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 
-	extensions->scavengerRsoScanUnsafe = !extensions->isScavengerRememberedSetInOverflowState();
+	bool rememberedSetSummaryDirty = (NULL != extensions->rememberedSetSummary) && !extensions->rememberedSetSummary->isEmpty();
+	extensions->scavengerRsoScanUnsafe = !(extensions->isScavengerRememberedSetInOverflowState() || rememberedSetSummaryDirty);
 	if (!extensions->scavengerRsoScanUnsafe) {
 		MM_ParallelGlobalGC *pggc = (MM_ParallelGlobalGC *)userData;
 		pggc->fixHeapForWalk(env, MEMORY_TYPE_OLD_RAM, FIXUP_DEBUG_TOOLING, fixObject);
@@ -351,6 +355,21 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	/* Card marking does not cover the huge object space, so it is only used without concurrent mark */
+	if ((0 != _extensions->hugeObjectThreshold) && !_extensions->concurrentMark) {
+		_extensions->hugeObjectSpace = MM_HugeObjectSpace::newInstance(env);
+		if (NULL == _extensions->hugeObjectSpace) {
+			goto error_no_memory;
+		}
+	}
+
+	if (_extensions->verifyHeapBeforeGC || _extensions->verifyHeapAfterGC) {
+		_extensions->heapVerifier = MM_HeapVerifier::newInstance(env);
+		if (NULL == _extensions->heapVerifier) {
+			goto error_no_memory;
+		}
+	}
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -415,6 +434,16 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+	if (NULL != _extensions->heapVerifier) {
+		_extensions->heapVerifier->kill(env);
+		_extensions->heapVerifier = NULL;
+	}
+
+	if (NULL != _extensions->hugeObjectSpace) {
+		_extensions->hugeObjectSpace->kill(env);
+		_extensions->hugeObjectSpace = NULL;
+	}
 }
 
 uintptr_t
@@ -470,6 +499,10 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 		gam->flushAllocationContexts(env);
 	}
 
+	if (_extensions->verifyHeapBeforeGC) {
+		_extensions->heapVerifier->verify(env, NULL, "before global collect");
+	}
+
 	/* ----- start of setupForCollect ------*/
 
 	/* ensure heap base is aligned to region size */
@@ -914,6 +947,10 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 	sweepStats->_startTime = omrtime_hires_clock();
 	mainThreadSweepStart(env, allocDescription);
 
+	if (NULL != _extensions->hugeObjectSpace) {
+		_extensions->hugeObjectSpace->sweep(env);
+	}
+
 	if (_extensions->processLargeAllocateStats) {
 		processLargeAllocateStatsAfterSweep(env);
 	}
@@ -1041,8 +1078,22 @@ MM_ParallelGlobalGC::mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescr
 	reportCompactStart(env);
 	compactStats->_startTime = omrtime_hires_clock();
 	bool nurseryOnly = (CompactReason::COMPACT_ABORTED_SCAVENGE == compactStats->_compactReason);
+	bool aggressive = env->_cycleState->_gcCode.shouldAggressivelyCompact();
 
-	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact(), nurseryOnly);
+	/* A compaction triggered by a large allocation only has to free enough contiguous memory for it */
+	uintptr_t partialCompactTarget = 0;
+	if (_extensions->compactPartial && !aggressive && (COMPACT_LARGE == compactStats->_compactReason)) {
+		if (NULL != allocDescription) {
+			partialCompactTarget = allocDescription->getBytesRequested();
+		}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		if (_extensions->scavengerEnabled) {
+			partialCompactTarget = OMR_MAX(partialCompactTarget, _extensions->scavengerStats._failedTenureLargest);
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	}
+
+	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, aggressive, nurseryOnly, partialCompactTarget);
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
 	reportCompactEnd(env);
@@ -1151,6 +1202,11 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 		clearHeap(env, clearFreeEntry);
 	}
 
+	/* The heap is only walkable once sweep has completed; the mark map is still valid unless the heap was compacted */
+	if (_extensions->verifyHeapAfterGC && _sweepScheme->isSweepCompleted(env)) {
+		_extensions->heapVerifier->verify(env, _markingScheme->getMarkMap(), "after global collect");
+	}
+
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	env->_cycleState->_endTime = omrtime_hires_clock();
 	reportGCCycleFinalIncrementEnding(env);
@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "omrport.h"
+
+#include <string.h>
+
+#include "PretenureProfile.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+MM_PretenureProfile *
+MM_PretenureProfile::newInstance(MM_EnvironmentBase *env, uintptr_t tableSize, uintptr_t sampleInterval)
+{
+	MM_PretenureProfile *profile = (MM_PretenureProfile *)env->getForge()->allocate(sizeof(MM_PretenureProfile), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != profile) {
+		/* round the table size up to a power of 2 so that hashes can be masked */
+		uintptr_t roundedTableSize = PRETENURE_PROFILE_MAX_PROBES;
+		while (roundedTableSize < tableSize) {
+			roundedTableSize <<= 1;
+		}
+		new(profile) MM_PretenureProfile(env, roundedTableSize, OMR_MAX(sampleInterval, 1));
+		if (!profile->initialize(env)) {
+			profile->kill(env);
+			profile = NULL;
+		}
+	}
+	return profile;
+}
+
+void
+MM_PretenureProfile::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_PretenureProfile::initialize(MM_EnvironmentBase *env)
+{
+	uintptr_t tableSizeInBytes = _tableSize * sizeof(Entry);
+	_table = (Entry *)env->getForge()->allocate(tableSizeInBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _table) {
+		return false;
+	}
+	memset((void *)_table, 0, tableSizeInBytes);
+
+	return true;
+}
+
+void
+MM_PretenureProfile::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _table) {
+		env->getForge()->free(_table);
+		_table = NULL;
+	}
+}
+
+void
+MM_PretenureProfile::updatePretenureDecisions(MM_EnvironmentBase *env, uintptr_t threshold, uintptr_t minimumSamples)
+{
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		Entry *entry = &_table[i];
+		uintptr_t allocationSamples = entry->allocationSamples;
+		if ((0 == entry->siteToken) || (0 == allocationSamples) || (allocationSamples < minimumSamples)) {
+			continue;
+		}
+
+		/* only the sampled allocations of a pretenured site are made in new space */
+		uintptr_t newSpaceAllocations = entry->pretenure ? allocationSamples : (allocationSamples * _sampleInterval);
+		uintptr_t tenuredCount = entry->tenuredCount;
+		/* objects allocated before a site was pretenured may still be tenured afterwards, so the estimate can exceed 100% */
+		uintptr_t tenureRate = OMR_MIN((tenuredCount * 100) / newSpaceAllocations, 100);
+		entry->tenureRate = tenureRate;
+
+		if (tenureRate >= threshold) {
+			entry->pretenure = true;
+		} else if (tenureRate < (threshold / 2)) {
+			/* revert only well below the threshold, so that a site close to it does not flip at every scavenge */
+			entry->pretenure = false;
+		}
+
+		/* decay the counts so that the decisions follow changes in the application's behaviour */
+		entry->allocationSamples = allocationSamples >> 1;
+		entry->tenuredCount = tenuredCount >> 1;
+	}
+}
+
+void
+MM_PretenureProfile::report(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t pretenuredSites = 0;
+
+	omrtty_printf("Pretenure profile (site token, allocation samples, tenured, tenure rate %%, pretenured):\n");
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		Entry *entry = &_table[i];
+		if (0 == entry->siteToken) {
+			continue;
+		}
+		omrtty_printf("  0x%zx %zu %zu %zu%% %s\n",
+				entry->siteToken, entry->allocationSamples, entry->tenuredCount, entry->tenureRate,
+				entry->pretenure ? "yes" : "no");
+		if (entry->pretenure) {
+			pretenuredSites += 1;
+		}
+	}
+	omrtty_printf("  total: %zu sites pretenured, %zu samples dropped\n", pretenuredSites, _droppedSamples);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
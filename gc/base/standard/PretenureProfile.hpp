@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(PRETENUREPROFILE_HPP_)
+#define PRETENUREPROFILE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+class MM_GCExtensionsBase;
+
+/* Maximum number of table entries probed before a site token is dropped */
+#define PRETENURE_PROFILE_MAX_PROBES 8
+
+/**
+ * Per allocation site survival profile used to allocate objects from sites whose objects
+ * (nearly) always reach tenure directly in tenure space, so that the scavenger does not
+ * copy them back and forth between the semispaces until they are old enough.
+ *
+ * Sites are identified by an opaque non-zero token that the language supplies both through
+ * the allocation description (see MM_AllocateInitialization::setAllocationSiteToken()) and,
+ * for objects being tenured, through MM_ScavengerDelegate::getAllocationSiteToken(). A class
+ * token works for both; an allocation site token requires the language to keep it in the
+ * object header.
+ *
+ * Each mutator thread samples one in sampleInterval of its allocations with a site token,
+ * and the scavenger counts every object it tenures. At the start of each scavenge the tenure
+ * rate of every site is estimated from these counts and sites at or above the threshold are
+ * pretenured. Sampled allocations are always made in new space, also for pretenured sites,
+ * so that the tenure rate of a pretenured site keeps being measured and the decision is
+ * reverted if its objects stop surviving.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_PretenureProfile : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	struct Entry {
+		volatile uintptr_t siteToken; /**< language supplied site token, 0 if the entry is unused */
+		volatile uintptr_t allocationSamples; /**< sampled allocations (all in new space) */
+		volatile uintptr_t tenuredCount; /**< objects of the site tenured by the scavenger */
+		volatile bool pretenure; /**< true if objects of the site are allocated in tenure space; only updated between scavenges */
+		uintptr_t tenureRate; /**< last estimated percentage of new space allocations tenured, for reporting */
+	};
+
+protected:
+private:
+	MM_GCExtensionsBase *_extensions;
+	Entry *_table; /**< open addressed table of site entries */
+	uintptr_t _tableSize; /**< number of entries in _table, a power of 2 */
+	uintptr_t _sampleInterval; /**< one in this many allocations with a site token is sampled */
+	volatile uintptr_t _droppedSamples; /**< samples dropped because no entry could be found or claimed for their site */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_PretenureProfile *newInstance(MM_EnvironmentBase *env, uintptr_t tableSize, uintptr_t sampleInterval);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the entry for a site, optionally claiming a free entry for it.
+	 * @param siteToken the non-zero site token
+	 * @param create true if an unused entry should be claimed for an unknown site
+	 * @return the entry for the site, or NULL if not found (or the table is full)
+	 */
+	MMINLINE Entry *
+	findEntry(uintptr_t siteToken, bool create)
+	{
+		uintptr_t mask = _tableSize - 1;
+		uintptr_t index = hashToken(siteToken) & mask;
+		for (uintptr_t probe = 0; probe < PRETENURE_PROFILE_MAX_PROBES; probe++) {
+			Entry *entry = &_table[(index + probe) & mask];
+			uintptr_t entryToken = entry->siteToken;
+			if (siteToken == entryToken) {
+				return entry;
+			}
+			if (0 == entryToken) {
+				if (!create) {
+					break;
+				}
+				entryToken = MM_AtomicOperations::lockCompareExchange(&entry->siteToken, 0, siteToken);
+				if ((0 == entryToken) || (siteToken == entryToken)) {
+					return entry;
+				}
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * Decide where an object allocated from a site is to be allocated, sampling one in
+	 * sampleInterval of the calling thread's allocations. Called by mutator threads.
+	 * @param siteToken the non-zero site token of the allocation
+	 * @return true if the object is to be allocated in tenure space
+	 */
+	MMINLINE bool
+	shouldPretenure(MM_EnvironmentBase *env, uintptr_t siteToken)
+	{
+		if (0 == env->_pretenureSampleCountdown) {
+			env->_pretenureSampleCountdown = _sampleInterval - 1;
+			Entry *entry = findEntry(siteToken, true);
+			if (NULL != entry) {
+				MM_AtomicOperations::add(&entry->allocationSamples, 1);
+			} else {
+				MM_AtomicOperations::add(&_droppedSamples, 1);
+			}
+			/* sampled allocations measure the site, so they always go to new space */
+			return false;
+		}
+		env->_pretenureSampleCountdown -= 1;
+		Entry *entry = findEntry(siteToken, false);
+		return (NULL != entry) && entry->pretenure;
+	}
+
+	/**
+	 * Record an object tenured by the scavenger. Called concurrently by GC threads.
+	 * @param siteToken the non-zero site token of the tenured object
+	 */
+	MMINLINE void
+	recordTenure(uintptr_t siteToken)
+	{
+		/* sites never sampled at allocation can not be pretenured, so there is no point in claiming an entry */
+		Entry *entry = findEntry(siteToken, false);
+		if (NULL != entry) {
+			MM_AtomicOperations::add(&entry->tenuredCount, 1);
+		}
+	}
+
+	/**
+	 * Estimate the tenure rate of every site from the counts recorded since the previous call,
+	 * (re)decide which sites are pretenured and decay the counts so that the decisions follow
+	 * changes in the application's behaviour. Must be called by a single thread while no scavenge
+	 * is in progress.
+	 * @param threshold percentage of new space allocations that must be tenured for a site to be pretenured
+	 * @param minimumSamples sites with fewer samples keep their previous decision
+	 */
+	void updatePretenureDecisions(MM_EnvironmentBase *env, uintptr_t threshold, uintptr_t minimumSamples);
+
+	/**
+	 * Print the estimated tenure rate and pretenure decision of each profiled site.
+	 */
+	void report(MM_EnvironmentBase *env);
+
+	MM_PretenureProfile(MM_EnvironmentBase *env, uintptr_t tableSize, uintptr_t sampleInterval)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _table(NULL)
+		, _tableSize(tableSize)
+		, _sampleInterval(sampleInterval)
+		, _droppedSamples(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	MMINLINE static uintptr_t
+	hashToken(uintptr_t siteToken)
+	{
+		/* tokens are frequently aligned pointers; fold the high bits into the low ones */
+		uintptr_t hash = siteToken ^ (siteToken >> 7) ^ (siteToken >> 17);
+		return hash;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* PRETENUREPROFILE_HPP_ */
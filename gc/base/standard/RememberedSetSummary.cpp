@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "RememberedSetSummary.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Math.hpp"
+#include "ModronAssertions.h"
+
+MM_RememberedSetSummary *
+MM_RememberedSetSummary::newInstance(MM_EnvironmentBase *env, void *heapBase, void *heapTop, uintptr_t chunkSize)
+{
+	MM_RememberedSetSummary *summary = (MM_RememberedSetSummary *)env->getForge()->allocate(sizeof(MM_RememberedSetSummary), OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL != summary) {
+		new(summary) MM_RememberedSetSummary(env);
+		if (!summary->initialize(env, heapBase, heapTop, chunkSize)) {
+			summary->kill(env);
+			summary = NULL;
+		}
+	}
+	return summary;
+}
+
+void
+MM_RememberedSetSummary::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_RememberedSetSummary::initialize(MM_EnvironmentBase *env, void *heapBase, void *heapTop, uintptr_t chunkSize)
+{
+	Assert_MM_true(0 != chunkSize);
+
+	_heapBase = (uintptr_t)heapBase;
+	_heapTop = (uintptr_t)heapTop;
+	/* round the chunk size down to a power of 2 */
+	_chunkSizeShift = MM_Math::floorLog2(chunkSize);
+	_chunkCount = ((_heapTop - _heapBase) + ((uintptr_t)1 << _chunkSizeShift) - 1) >> _chunkSizeShift;
+
+	uintptr_t chunksSize = (_chunkCount + 1) * sizeof(uintptr_t);
+	_chunks = (volatile uintptr_t *)env->getForge()->allocate(chunksSize, OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _chunks) {
+		return false;
+	}
+	clear();
+
+	return true;
+}
+
+void
+MM_RememberedSetSummary::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _chunks) {
+		env->getForge()->free((void *)_chunks);
+		_chunks = NULL;
+	}
+}
+
+void
+MM_RememberedSetSummary::clear()
+{
+	memset((void *)_chunks, 0, (_chunkCount + 1) * sizeof(uintptr_t));
+	_dirty = false;
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
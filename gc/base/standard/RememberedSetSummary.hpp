@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(REMEMBEREDSETSUMMARY_HPP_)
+#define REMEMBEREDSETSUMMARY_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "objectdescription.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Per-chunk summary of the remembered objects that did not fit in the scavenger remembered
+ * set list.
+ *
+ * The heap is divided into power of 2 sized chunks, and the summary holds, for each chunk,
+ * the lowest address of a remembered object in the chunk that could not be added to the list.
+ * All remembered objects in a chunk can then be found by walking the chunk from that object
+ * (see GC_RememberedSetSummaryChunkIterator), so overflowing the list costs a walk of the
+ * chunks it overflowed in rather than of the whole tenure space. Objects outside of the heap
+ * (huge objects) share a single extra entry, whose value is any of them.
+ *
+ * Recorded addresses must remain object starts, so the summary has to be rebuilt after a
+ * global collection has swept or moved the objects in it.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetSummary : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	uintptr_t _heapBase; /**< base of the range covered by the chunks */
+	uintptr_t _heapTop; /**< top of the range covered by the chunks */
+	uintptr_t _chunkSizeShift; /**< log2 of the chunk size */
+	uintptr_t _chunkCount; /**< number of heap chunks, _chunks has one more entry for objects outside of the heap */
+	volatile uintptr_t *_chunks; /**< per chunk, lowest address of a remembered object missing from the list, 0 if none */
+	volatile bool _dirty; /**< true if any entry may be non-zero */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_RememberedSetSummary *newInstance(MM_EnvironmentBase *env, void *heapBase, void *heapTop, uintptr_t chunkSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record a remembered object that could not be added to the remembered set list.
+	 * May be called concurrently by multiple threads.
+	 */
+	MMINLINE void
+	add(omrobjectptr_t objectPtr)
+	{
+		volatile uintptr_t *chunk = &_chunks[getChunkIndex(objectPtr)];
+		uintptr_t oldValue = *chunk;
+		while ((0 == oldValue) || ((uintptr_t)objectPtr < oldValue)) {
+			uintptr_t value = MM_AtomicOperations::lockCompareExchange(chunk, oldValue, (uintptr_t)objectPtr);
+			if (value == oldValue) {
+				break;
+			}
+			oldValue = value;
+		}
+		if (!_dirty) {
+			_dirty = true;
+		}
+	}
+
+	/**
+	 * @return true if no object is recorded in the summary
+	 */
+	MMINLINE bool isEmpty() { return !_dirty; }
+
+	/**
+	 * @return true if the chunk of the object has remembered objects missing from the list
+	 */
+	MMINLINE bool isObjectInDirtyChunk(omrobjectptr_t objectPtr) { return _dirty && (0 != _chunks[getChunkIndex(objectPtr)]); }
+
+	/**
+	 * Clear the dirty flag before all chunks are pruned: chunks that keep objects are added to again.
+	 */
+	MMINLINE void clearDirty() { _dirty = false; }
+
+	/**
+	 * Remove all objects from the summary.
+	 */
+	void clear();
+
+	/**
+	 * @return the number of heap chunks. The entry at this index holds objects outside of the heap.
+	 */
+	MMINLINE uintptr_t getChunkCount() { return _chunkCount; }
+
+	/**
+	 * @return the lowest recorded object of a chunk, or NULL if none is
+	 */
+	MMINLINE omrobjectptr_t getFirstObject(uintptr_t chunkIndex) { return (omrobjectptr_t)_chunks[chunkIndex]; }
+
+	/**
+	 * Remove the recorded object of a chunk, and return it. Only the thread processing the chunk
+	 * may add to it while it is being cleared.
+	 */
+	MMINLINE omrobjectptr_t
+	clearChunk(uintptr_t chunkIndex)
+	{
+		omrobjectptr_t objectPtr = (omrobjectptr_t)_chunks[chunkIndex];
+		_chunks[chunkIndex] = 0;
+		return objectPtr;
+	}
+
+	MMINLINE void *getChunkTop(uintptr_t chunkIndex) { return (void *)OMR_MIN(_heapBase + ((chunkIndex + 1) << _chunkSizeShift), _heapTop); }
+
+	MM_RememberedSetSummary(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _heapBase(0)
+		, _heapTop(0)
+		, _chunkSizeShift(0)
+		, _chunkCount(0)
+		, _chunks(NULL)
+		, _dirty(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, void *heapBase, void *heapTop, uintptr_t chunkSize);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	MMINLINE uintptr_t
+	getChunkIndex(omrobjectptr_t objectPtr)
+	{
+		if (((uintptr_t)objectPtr >= _heapBase) && ((uintptr_t)objectPtr < _heapTop)) {
+			return ((uintptr_t)objectPtr - _heapBase) >> _chunkSizeShift;
+		}
+		return _chunkCount;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* REMEMBEREDSETSUMMARY_HPP_ */
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(REMEMBEREDSETSUMMARYCHUNKITERATOR_HPP_)
+#define REMEMBEREDSETSUMMARYCHUNKITERATOR_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "MemorySubSpaceRegionIteratorStandard.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectModel.hpp"
+
+/**
+ * Iterate over the remembered objects of one heap chunk of a MM_RememberedSetSummary.
+ *
+ * The walk starts at the object recorded for the chunk and covers every tenure region
+ * intersecting the chunk, so chunks straddling a region boundary are walked correctly.
+ * The tenure space must be walkable.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class GC_RememberedSetSummaryChunkIterator
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_GCExtensionsBase *_extensions;
+	GC_MemorySubSpaceRegionIteratorStandard _regionIterator; /**< iterator over the tenure regions */
+	GC_ObjectHeapIteratorAddressOrderedList _objectIterator; /**< iterator over the part of the chunk in the current region */
+	void *_chunkBase; /**< first object recorded for the chunk */
+	void *_chunkTop; /**< top of the chunk */
+	bool _walkingRegion; /**< true if _objectIterator has been reset to a region intersecting the chunk */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * @param tenureSubSpace the subspace holding the remembered objects
+	 * @param firstObject the object recorded for the chunk
+	 * @param chunkTop the top of the chunk
+	 */
+	GC_RememberedSetSummaryChunkIterator(MM_GCExtensionsBase *extensions, MM_MemorySubSpace *tenureSubSpace, omrobjectptr_t firstObject, void *chunkTop)
+		: _extensions(extensions)
+		, _regionIterator(tenureSubSpace)
+		, _objectIterator(extensions, firstObject, (omrobjectptr_t)chunkTop, false)
+		, _chunkBase(firstObject)
+		, _chunkTop(chunkTop)
+		, _walkingRegion(false)
+	{}
+
+	/**
+	 * @return the next remembered object of the chunk, or NULL when the chunk has been walked
+	 */
+	omrobjectptr_t
+	nextObject()
+	{
+		while (true) {
+			if (_walkingRegion) {
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = _objectIterator.nextObject())) {
+					if (_extensions->objectModel.isRemembered(objectPtr)) {
+						return objectPtr;
+					}
+				}
+				_walkingRegion = false;
+			}
+
+			MM_HeapRegionDescriptor *region = _regionIterator.nextRegion();
+			if (NULL == region) {
+				return NULL;
+			}
+			/* Only the region holding the recorded object can start below it */
+			void *base = OMR_MAX(region->getLowAddress(), _chunkBase);
+			void *top = OMR_MIN(region->getHighAddress(), _chunkTop);
+			if (base < top) {
+				_objectIterator.reset((uintptr_t *)base, (uintptr_t *)top);
+				_walkingRegion = true;
+			}
+		}
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* REMEMBEREDSETSUMMARYCHUNKITERATOR_HPP_ */
@@ -62,6 +62,9 @@
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HeapVerifier.hpp"
+#include "HotFieldProfile.hpp"
+#include "HugeObjectSpace.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -76,7 +79,10 @@
 #include "OMRVMThreadListIterator.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ParallelScavengeTask.hpp"
+#include "PretenureProfile.hpp"
 #include "PhysicalSubArena.hpp"
+#include "RememberedSetSummary.hpp"
+#include "RememberedSetSummaryChunkIterator.hpp"
 #include "RSOverflow.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
@@ -109,6 +115,9 @@
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
+/* Number of remembered set summary chunks walked per work unit when scanning or pruning the summary */
+#define SCAVENGER_REMEMBERED_SET_SUMMARY_CHUNKS_PER_WORK_UNIT 64
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -298,6 +307,32 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->scavengerHotFieldProfiling) {
+		_hotFieldProfile = MM_HotFieldProfile::newInstance(env, _extensions->scavengerHotFieldProfileTableSize, _cacheLineAlignment);
+		if (NULL == _hotFieldProfile) {
+			return false;
+		}
+	}
+
+	if (_extensions->scavengerPretenuring) {
+		_extensions->pretenureProfile = MM_PretenureProfile::newInstance(env, _extensions->scavengerPretenureTableSize, _extensions->scavengerPretenureSampleInterval);
+		if (NULL == _extensions->pretenureProfile) {
+			return false;
+		}
+	}
+
+	/* Remembered objects that do not fit in a bounded remembered set list are recorded in the summary,
+	 * which is created with the first scavenge once the heap range is known. Concurrent scavenger keeps
+	 * using the remembered set overflow state.
+	 */
+	_extensions->rememberedSet.setMaxSize(_extensions->scavengerRememberedSetMaximumSize);
+	if (!IS_CONCURRENT_ENABLED) {
+		if (!_rememberedSetSummaryScanList.initialize(env, OMR::GC::AllocationCategory::REMEMBERED_SET)) {
+			return false;
+		}
+		_rememberedSetSummaryScanList.setGrowSize(OMR_SCV_REMSET_SIZE);
+	}
+
 	return true;
 }
 
@@ -306,6 +341,23 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
 	_delegate.tearDown(env);
 
+	if (NULL != _hotFieldProfile) {
+		_hotFieldProfile->kill(env);
+		_hotFieldProfile = NULL;
+	}
+
+	if (NULL != _extensions->pretenureProfile) {
+		_extensions->pretenureProfile->kill(env);
+		_extensions->pretenureProfile = NULL;
+	}
+
+	if (NULL != _rememberedSetSummary) {
+		_rememberedSetSummary->kill(env);
+		_rememberedSetSummary = NULL;
+		_extensions->rememberedSetSummary = NULL;
+	}
+	_rememberedSetSummaryScanList.tearDown(env);
+
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
@@ -396,6 +448,12 @@ MM_Scavenger::setupForGC(MM_EnvironmentBase *env)
 {
 }
 
+MMINLINE bool
+MM_Scavenger::isRememberedSetSummaryDirty()
+{
+	return (NULL != _rememberedSetSummary) && !_rememberedSetSummary->isEmpty();
+}
+
 void
 MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 {
@@ -427,6 +485,22 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	/* invoke language-specific interface callback */
 	_delegate.mainSetupForGC(env);
 
+	/* Rank the hot field samples collected during previous cycles, so they drive copy order in this one */
+	if (NULL != _hotFieldProfile) {
+		_hotFieldProfile->rankHotFields(env, _extensions->scavengerHotFieldProfileMinimumSamples);
+	}
+
+	/* Decide which allocation sites are pretenured until the next scavenge from the tenure rates seen so far */
+	if (NULL != _extensions->pretenureProfile) {
+		_extensions->pretenureProfile->updatePretenureDecisions(env, _extensions->scavengerPretenureThreshold, _extensions->scavengerPretenureMinimumSamples);
+	}
+
+	/* Large objects are copied by moving their pages, unless the heap has failed to move pages before */
+	_remapCopyPageSize = 0;
+	if ((0 != _extensions->scavengerRemapCopyThreshold) && !_remapCopyUnsupported && !IS_CONCURRENT_ENABLED) {
+		_remapCopyPageSize = _extensions->heap->getPageSize();
+	}
+
 	/* Allow expansion in the tenure area on failed promotions (but no resizing on the semispace) */
 	_expandTenureOnFailedAllocate = true;
 	_activeSubSpace = (MM_MemorySubSpaceSemiSpace *)(env->_cycleState->_activeSubSpace);
@@ -473,8 +547,17 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (!IS_CONCURRENT_ENABLED && (NULL == _rememberedSetSummary)) {
+		/* Cover the whole heap range, which cannot move, so the summary never has to be resized. If it
+		 * can not be allocated, remembered set overflow is used instead.
+		 */
+		_rememberedSetSummary = MM_RememberedSetSummary::newInstance(env, _extensions->heap->getHeapBase(), _extensions->heap->getHeapTop(), _extensions->scavengerRememberedSetSummaryChunkSize);
+		_extensions->rememberedSetSummary = _rememberedSetSummary;
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
+	_isRememberedSetSummaryDirtyAtTheBeginning = isRememberedSetSummaryDirty();
 	_extensions->rememberedSet.startProcessingSublist();
 }
 
@@ -610,6 +693,12 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, _recommendedThreads);
 	_dispatcher->run(env, &scavengeTask);
 
+	/* Objects collected from the remembered set summary were only needed for the scan */
+	if (_isRememberedSetSummaryDirtyAtTheBeginning) {
+		_rememberedSetSummaryScanList.clear(env);
+		_rememberedSetSummaryScanListOverflow = false;
+	}
+
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
 
@@ -828,6 +917,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 
 	finalGCStats->_flipDiscardBytes += scavStats->_flipDiscardBytes;
 	finalGCStats->_tenureDiscardBytes += scavStats->_tenureDiscardBytes;
+	finalGCStats->_remapCopyCount += scavStats->_remapCopyCount;
+	finalGCStats->_remapCopyBytes += scavStats->_remapCopyBytes;
 
 	finalGCStats->_survivorTLHRemainderCount += scavStats->_survivorTLHRemainderCount;
 	finalGCStats->_tenureTLHRemainderCount += scavStats->_tenureTLHRemainderCount;
@@ -1508,7 +1599,7 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_
 			toReturn = true;
 #if defined(OMR_GC_MODRON_SCAVENGER_STRICT)
 		} else {
-			Assert_MM_true(_extensions->isOld(objectPtr));
+			Assert_MM_true(_extensions->isOld(objectPtr) || ((NULL != _extensions->hugeObjectSpace) && _extensions->hugeObjectSpace->isHugeObject(objectPtr)));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER_STRICT) */
 		}
 	}
@@ -1627,6 +1718,37 @@ MM_Scavenger::forwardingSucceeded(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::getMovablePages(omrobjectptr_t objectPtr, uintptr_t objectCopySizeInBytes, uintptr_t *moveBase, uintptr_t *moveTop)
+{
+	/* the page holding the object header is never moved, it keeps the forwarding pointer */
+	*moveBase = MM_Math::roundToCeiling(_remapCopyPageSize, (uintptr_t)objectPtr + 1);
+	*moveTop = MM_Math::roundToFloor(_remapCopyPageSize, (uintptr_t)objectPtr + objectCopySizeInBytes);
+	return *moveBase < *moveTop;
+}
+
+MMINLINE void
+MM_Scavenger::copyByMovingPages(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, omrobjectptr_t objectPtr, uintptr_t objectCopySizeInBytes)
+{
+	uintptr_t moveBase = 0;
+	uintptr_t moveTop = 0;
+	uintptr_t delta = (uintptr_t)destinationObjectPtr - (uintptr_t)objectPtr;
+
+	Assert_MM_true(0 == (delta % _remapCopyPageSize));
+	if (!_remapCopyUnsupported && getMovablePages(objectPtr, objectCopySizeInBytes, &moveBase, &moveTop)) {
+		if (_extensions->heap->moveMemory((void *)moveBase, (void *)(moveBase + delta), moveTop - moveBase)) {
+			uintptr_t objectTop = (uintptr_t)objectPtr + objectCopySizeInBytes;
+			memcpy((void *)destinationObjectPtr, (void *)objectPtr, moveBase - (uintptr_t)objectPtr);
+			memcpy((void *)(moveTop + delta), (void *)moveTop, objectTop - moveTop);
+			env->_scavengerStats._remapCopyCount += 1;
+			env->_scavengerStats._remapCopyBytes += moveTop - moveBase;
+			return;
+		}
+		_remapCopyUnsupported = true;
+	}
+	memcpy((void *)destinationObjectPtr, (void *)objectPtr, objectCopySizeInBytes);
+}
+
 MMINLINE omrobjectptr_t
 MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader)
 {
@@ -1647,6 +1769,9 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 	uintptr_t hotFieldsAlignment = 0;
 	uintptr_t* hotFieldPadBase = NULL;
 	uintptr_t hotFieldPadSize = 0;
+	uintptr_t remapPadding = 0;
+	uintptr_t* remapPadBase = NULL;
+	uintptr_t remapPadSize = 0;
 	MM_CopyScanCacheStandard *copyCache = NULL;
 	bool const compressed = _extensions->compressObjectReferences();
 
@@ -1663,7 +1788,14 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 
 	Assert_MM_objectAligned(env, objectReserveSizeInBytes);
 
-	if (0 == (((uintptr_t)1 << objectAge) & _tenureMask)) {
+	/* large objects are placed at the same offset within a page as the original, so that their interior pages can be moved rather than copied */
+	if ((STW == variant) && (0 != _remapCopyPageSize) && (objectCopySizeInBytes >= _extensions->scavengerRemapCopyThreshold)) {
+		remapPadding = _remapCopyPageSize;
+		objectReserveSizeInBytes += remapPadding;
+	}
+
+	/* Referents copied through the profiled hot fields of a tenured object are tenured with it, so that they share its cache lines */
+	if ((0 == (((uintptr_t)1 << objectAge) & _tenureMask)) && (0 == env->_profiledHotFieldCopyDepthCount)) {
 		/* The object should be flipped - try to reserve room in the semi space */
 		copyCache = reserveMemoryForAllocateInSemiSpace(env, forwardedHeader->getObject(), objectReserveSizeInBytes);
 		if (NULL != copyCache) {
@@ -1690,7 +1822,7 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 	} else {
 		/* Move straight to tenuring on the object */
 		/* adjust the reserved object's size if we are aligning hot fields and this class has a known hot field */
-		if (_extensions->scavengerAlignHotFields && HOTFIELD_SHOULD_ALIGN(hotFieldsDescriptor)) {
+		if ((0 == remapPadding) && _extensions->scavengerAlignHotFields && HOTFIELD_SHOULD_ALIGN(hotFieldsDescriptor)) {
 			/* this optimization is a source of fragmentation (alloc request size always assumes maximum padding,
 			 * but free entry created by sweep in tenure could be less than that (since some of unused padding can overlap with next copied object)).
 			 * we limit this optimization for arrays up to the size of 2 cache lines, beyond which the benefits of the optimization are believed to be non-existant */
@@ -1759,9 +1891,21 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 		 */
 		objectReserveSizeInBytes = objectReserveSizeInBytes - (_cacheLineAlignment - _objectAlignmentInBytes);
 	}
+	/* and for the page offset of a remapped object */
+	if (0 != remapPadding) {
+		remapPadSize = ((uintptr_t)forwardedHeader->getObject() - (uintptr_t)destinationObjectPtr) & (_remapCopyPageSize - 1);
+		remapPadBase = (uintptr_t *)destinationObjectPtr;
+		destinationObjectPtr = (omrobjectptr_t)((uintptr_t)destinationObjectPtr + remapPadSize);
+		objectReserveSizeInBytes -= remapPadding;
+	}
 
 	/* and correct for the double array alignment */
 	void *newCacheAlloc = (void *) (((uint8_t *)destinationObjectPtr) + objectReserveSizeInBytes);
+	/* unlike hot field padding the unused remap padding can be large enough to leave a TLH remainder behind a dedicated
+	 * large object cache, so it is consumed as a hole after the object rather than left in the cache
+	 */
+	uintptr_t remapTailSize = (0 != remapPadding) ? (remapPadding - remapPadSize) : 0;
+	newCacheAlloc = (void *)((uint8_t *)newCacheAlloc + remapTailSize);
 
 	omrobjectptr_t originalDestinationObjectPtr = destinationObjectPtr;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1800,6 +1944,12 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 			/* lay down a hole (XXX:  This assumes that we are using AOL (address-ordered-list)) */
 			MM_HeapLinkedFreeHeader::fillWithHoles(hotFieldPadBase, hotFieldPadSize, compressed);
 		}
+		if (0 != remapPadSize) {
+			MM_HeapLinkedFreeHeader::fillWithHoles(remapPadBase, remapPadSize, compressed);
+		}
+		if (0 != remapTailSize) {
+			MM_HeapLinkedFreeHeader::fillWithHoles((uintptr_t *)((uintptr_t)destinationObjectPtr + objectReserveSizeInBytes), remapTailSize, compressed);
+		}
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 		valgrindMempoolAlloc(_extensions, (uintptr_t) destinationObjectPtr, objectReserveSizeInBytes);
@@ -1824,7 +1974,11 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 		} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 		{
-			memcpy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+			if (0 != remapPadding) {
+				copyByMovingPages(env, destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+			} else {
+				memcpy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+			}
 
 			/* Copy the preserved fields from the forwarded header into the destination object */
 			forwardedHeader->fixupForwardedObject(destinationObjectPtr);
@@ -1864,6 +2018,19 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 
 			/* depth copy the hot fields of an object if scavenger dynamicBreadthFirstScanOrdering is enabled */
 			depthCopyHotFields(env, forwardedHeader, destinationObjectPtr);
+
+			/* co-locate the referents of profiled hot fields with tenured objects, unless the language declares hot fields */
+			if ((NULL != _hotFieldProfile) && (STATE_NOT_REMEMBERED == objectAge) && (U_8_MAX == _extensions->objectModel.getHotFieldOffset(forwardedHeader))) {
+				depthCopyProfiledHotFields(env, destinationObjectPtr);
+			}
+
+			/* count tenured objects per allocation site, to find the sites worth pretenuring */
+			if ((NULL != _extensions->pretenureProfile) && (STATE_NOT_REMEMBERED == objectAge)) {
+				uintptr_t siteToken = _delegate.getAllocationSiteToken(env, destinationObjectPtr);
+				if (0 != siteToken) {
+					_extensions->pretenureProfile->recordTenure(siteToken);
+				}
+			}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		} else { /* CS build flag  enabled: mid point of nested if-forwarding-succeeded check */
 
@@ -1920,6 +2087,53 @@ MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinati
 	}
 }
 
+MMINLINE void
+MM_Scavenger::depthCopyProfiledHotFields(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr)
+{
+	if (env->_profiledHotFieldCopyDepthCount < _extensions->depthCopyMax) {
+		uintptr_t classToken = _delegate.getHotFieldProfileToken(env, destinationObjectPtr);
+		MM_HotFieldProfile::Entry *entry = (0 != classToken) ? _hotFieldProfile->findEntry(classToken, false) : NULL;
+		if (NULL != entry) {
+			bool const compressed = _extensions->compressObjectReferences();
+			for (uintptr_t hot = 0; hot < HOT_FIELD_PROFILE_HOT_FIELD_COUNT; hot++) {
+				uint8_t offset = entry->hotFieldOffsets[hot];
+				if (U_8_MAX == offset) {
+					break;
+				}
+				fomrobject_t *slotAddress = GC_SlotObject::addToSlotAddress((fomrobject_t *)destinationObjectPtr, offset, compressed);
+				GC_SlotObject hotFieldObject(_omrVM, slotAddress);
+				omrobjectptr_t objectPtr = hotFieldObject.readReferenceFromSlot();
+				if (isObjectInEvacuateMemory(objectPtr)) {
+					MM_ForwardedHeader forwardHeaderHotField(objectPtr, compressed);
+					if (!forwardHeaderHotField.isForwardedPointer()) {
+						env->_profiledHotFieldCopyDepthCount += 1;
+						omrobjectptr_t copiedObjectPtr = copyObject(env, &forwardHeaderHotField);
+						env->_profiledHotFieldCopyDepthCount -= 1;
+						if ((NULL != copiedObjectPtr) && !isObjectInNewSpace(copiedObjectPtr)) {
+							_hotFieldProfile->recordHotFieldCopy(entry, slotAddress, copiedObjectPtr);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+MMINLINE uintptr_t
+MM_Scavenger::getHotFieldProfileSampleToken(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, omrobjectptr_t objectPtr)
+{
+	uintptr_t classToken = 0;
+	if ((NULL != _hotFieldProfile) && !objectScanner->isIndexableObject()) {
+		if (0 == env->_hotFieldProfileSampleCountdown) {
+			env->_hotFieldProfileSampleCountdown = OMR_MAX(_extensions->scavengerHotFieldProfileSampleInterval, 1) - 1;
+			classToken = _delegate.getHotFieldProfileToken(env, objectPtr);
+		} else {
+			env->_hotFieldProfileSampleCountdown -= 1;
+		}
+	}
+	return classToken;
+}
+
 /****************************************
  * Object scan and copy routines
  ****************************************
@@ -2067,11 +2281,16 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	uint64_t slotsCopied = 0;
 	uint64_t slotsScanned = 0;
 	GC_SlotObject *slotObject = NULL;
+	uintptr_t hotFieldProfileToken = getHotFieldProfileSampleToken(env, objectScanner, objectPtr);
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
 	while (NULL != (slotObject = objectScanner->getNextSlot())) {
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		shouldRemember |= isSlotObjectInNewSpace;
+		if ((0 != hotFieldProfileToken) && isSlotObjectInNewSpace) {
+			/* sampled object: fields keeping new space objects alive are the candidates for co-location */
+			_hotFieldProfile->recordFieldAccess(hotFieldProfileToken, (uintptr_t)slotObject->readAddressFromSlot() - (uintptr_t)objectPtr);
+		}
 		if (NULL != *copyCache) {
 			slotsCopied += 1;
 		}
@@ -2733,7 +2952,14 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
+		MM_SublistFragment fragment((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+		MM_SublistFragment::flush((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+		if(!_extensions->rememberedSet.allocate(env, &fragment)) {
+			if (NULL != _rememberedSetSummary) {
+				/* Failed to allocate a fragment - record the object in the summary of its heap chunk */
+				_rememberedSetSummary->add(objectPtr);
+				return ;
+			}
 			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
 			if (!_isRememberedSetInOverflowAtTheBeginning) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
@@ -2935,10 +3161,120 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 			scavengeRememberedObject(env, objectPtr);
 		}
 
+		/* Huge objects are not part of the tenure walk, scan the remembered ones directly */
+		MM_HugeObjectSpace *hugeObjectSpace = _extensions->hugeObjectSpace;
+		if (NULL != hugeObjectSpace) {
+			while (NULL != (objectPtr = hugeObjectSpace->nextObject(objectPtr))) {
+				if (_extensions->objectModel.isRemembered(objectPtr)) {
+					scavengeRememberedObject(env, objectPtr);
+				}
+			}
+		}
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+void
+MM_Scavenger::scavengeRememberedSetSummary(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	/* Collect the remembered objects of the summary chunks into the scan list. All chunks must be walked
+	 * before any object is copied, since copies tenured by other threads may be allocated in them.
+	 */
+	J9VMGC_SublistFragment scanListFragment;
+	scanListFragment.fragmentCurrent = NULL;
+	scanListFragment.fragmentTop = NULL;
+	scanListFragment.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
+	scanListFragment.parentList = &_rememberedSetSummaryScanList;
+	scanListFragment.deferredFlushID = 0;
+	scanListFragment.count = 0;
+
+	uintptr_t chunkCount = _rememberedSetSummary->getChunkCount();
+	for (uintptr_t unitBase = 0; unitBase < chunkCount; unitBase += SCAVENGER_REMEMBERED_SET_SUMMARY_CHUNKS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t unitTop = OMR_MIN(unitBase + SCAVENGER_REMEMBERED_SET_SUMMARY_CHUNKS_PER_WORK_UNIT, chunkCount);
+			for (uintptr_t chunkIndex = unitBase; (chunkIndex < unitTop) && !_rememberedSetSummaryScanListOverflow; chunkIndex++) {
+				omrobjectptr_t firstObject = _rememberedSetSummary->getFirstObject(chunkIndex);
+				if (NULL != firstObject) {
+					GC_RememberedSetSummaryChunkIterator chunkIterator(_extensions, _tenureMemorySubSpace, firstObject, _rememberedSetSummary->getChunkTop(chunkIndex));
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = chunkIterator.nextObject())) {
+						if (scanListFragment.fragmentCurrent >= scanListFragment.fragmentTop) {
+							MM_SublistFragment fragment(&scanListFragment);
+							MM_SublistFragment::flush(&scanListFragment);
+							if (!_rememberedSetSummaryScanList.allocate(env, &fragment)) {
+								_rememberedSetSummaryScanListOverflow = true;
+								break;
+							}
+						}
+						scanListFragment.count += 1;
+						*scanListFragment.fragmentCurrent++ = (uintptr_t)objectPtr;
+					}
+				}
+			}
+		}
+	}
+	MM_SublistFragment::flush(&scanListFragment);
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		if (_rememberedSetSummaryScanListOverflow) {
+			/* The objects could not all be collected, mark them in the mark map and scan them from here instead */
+			_rememberedSetSummaryScanList.clear(env);
+
+			/* Creation of this class will Abort Global Collector */
+			MM_RSOverflow rememberedSetOverflow(env);
+
+			for (uintptr_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+				omrobjectptr_t firstObject = _rememberedSetSummary->getFirstObject(chunkIndex);
+				if (NULL != firstObject) {
+					GC_RememberedSetSummaryChunkIterator chunkIterator(_extensions, _tenureMemorySubSpace, firstObject, _rememberedSetSummary->getChunkTop(chunkIndex));
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = chunkIterator.nextObject())) {
+						rememberedSetOverflow.addObject(objectPtr);
+					}
+				}
+			}
+
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = rememberedSetOverflow.nextObject())) {
+				scavengeRememberedObject(env, objectPtr);
+			}
+		}
+		_rememberedSetSummaryScanList.startProcessingSublist();
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* Huge objects are not part of the heap chunks, scan the remembered ones directly */
+	if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		MM_HugeObjectSpace *hugeObjectSpace = _extensions->hugeObjectSpace;
+		if ((NULL != hugeObjectSpace) && (NULL != _rememberedSetSummary->getFirstObject(chunkCount))) {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = hugeObjectSpace->nextObject(objectPtr))) {
+				if (_extensions->objectModel.isRemembered(objectPtr)) {
+					scavengeRememberedObject(env, objectPtr);
+				}
+			}
+		}
+	}
+
+	/*
+	 * Scan the collected objects, but don't adjust their remembered bit.
+	 * Objects that no longer need remembering will be pruned at the end of the scavenge.
+	 */
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = _rememberedSetSummaryScanList.popPreviousPuddle(puddle))) {
+		GC_SublistSlotIterator scanListSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)scanListSlotIterator.nextSlot())) {
+			if (NULL != *slotPtr) {
+				scavengeRememberedObject(env, *slotPtr);
+			}
+		}
+	}
+}
+
 MMINLINE void
 MM_Scavenger::flushRememberedSet(MM_EnvironmentStandard *env)
 {
@@ -2954,6 +3290,41 @@ MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 		pruneRememberedSetOverflow(env);
 	} else {
 		pruneRememberedSetList(env);
+		if (NULL != _rememberedSetSummary) {
+			pruneRememberedSetSummary(env);
+		}
+	}
+}
+
+MMINLINE void
+MM_Scavenger::pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* Check if object still has nursery references, direct or indirect */
+	bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+
+	/* Unconditionally remember object if it was recently referenced */
+	if (!IS_CONCURRENT_ENABLED && !shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
+		Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+		shouldBeRemembered = true;
+	}
+
+	if(shouldBeRemembered) {
+		/* Tenured object remains flagged as remembered */
+		/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
+		addToRememberedSetFragment(env, objectPtr);
+	} else {
+		/* Tenured object remembered flags can be cleared */
+		_extensions->objectModel.clearRemembered(objectPtr);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
+			/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
+			 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
+			 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
+			 * in a more generic spot when object is scavenged and is unnecessary to do it here.
+			 */
+			oldToOldReferenceCreated(env, objectPtr);
+		}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 	}
 }
 
@@ -2976,6 +3347,10 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 		/* Clear the overflow state. Probability is high that we'll wind up re-overflowing. */
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
+		/* Every remembered object is found by the walk, so the summary is rebuilt along with the list */
+		if (NULL != _rememberedSetSummary) {
+			_rememberedSetSummary->clear();
+		}
 
 		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
 		MM_HeapRegionDescriptorStandard *region = NULL;
@@ -2986,33 +3361,18 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 			omrobjectptr_t objectPtr;
 			while((objectPtr = objectIterator.nextObject()) != NULL) {
 				if(_extensions->objectModel.isRemembered(objectPtr)) {
-					/* Check if object still has nursery references, direct or indirect */
-					bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
-
-					/* Unconditionally remember object if it was recently referenced */
-					if (!IS_CONCURRENT_ENABLED && !shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
-						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
-						shouldBeRemembered = true;
-					}
+					pruneRememberedObject(env, objectPtr);
+				}
+			}
+		}
 
-					if(shouldBeRemembered) {
-						/* Tenured object remains flagged as remembered */
-						/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
-						addToRememberedSetFragment(env, objectPtr);
-					} else {
-						/* Tenured object remembered flags can be cleared */
-						_extensions->objectModel.clearRemembered(objectPtr);
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
-						if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
-							/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
-							 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
-							 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
-							 * in a more generic spot when object is scavenged and is unnecessary to do it here.
-							 */
-							oldToOldReferenceCreated(env, objectPtr);
-						}
-#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
-					}
+		/* Huge objects are not part of the tenure walk, verify or clear their remembered bits directly */
+		MM_HugeObjectSpace *hugeObjectSpace = _extensions->hugeObjectSpace;
+		if (NULL != hugeObjectSpace) {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = hugeObjectSpace->nextObject(objectPtr))) {
+				if (_extensions->objectModel.isRemembered(objectPtr)) {
+					pruneRememberedObject(env, objectPtr);
 				}
 			}
 		}
@@ -3054,6 +3414,12 @@ MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 
 				if (NULL == objectPtr) {
 					remSetSlotIterator.removeSlot();
+				} else if ((NULL != _rememberedSetSummary) && _rememberedSetSummary->isObjectInDirtyChunk((omrobjectptr_t)((uintptr_t)objectPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG))) {
+					/* The chunk of the object will be walked by pruneRememberedSetSummary(), which retains or clears the object.
+					 * Record it in the summary so that the walk starts no later than the object.
+					 */
+					_rememberedSetSummary->add((omrobjectptr_t)((uintptr_t)objectPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG));
+					remSetSlotIterator.removeSlot();
 				} else if((uintptr_t)objectPtr & DEFERRED_RS_REMOVE_FLAG) {
 					/* Is slot flagged for deferred removal ? */
 					/* Yes..so first remove tag bit from object address */
@@ -3106,6 +3472,53 @@ MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 }
 
+void
+MM_Scavenger::pruneRememberedSetSummary(MM_EnvironmentStandard *env)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		/* Chunks are cleared as they are walked, and dirtied again by retained objects that do not fit in the list */
+		_shouldPruneRememberedSetSummary = !_rememberedSetSummary->isEmpty();
+		_rememberedSetSummary->clearDirty();
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	if (_shouldPruneRememberedSetSummary) {
+		uintptr_t chunkCount = _rememberedSetSummary->getChunkCount();
+		for (uintptr_t unitBase = 0; unitBase < chunkCount; unitBase += SCAVENGER_REMEMBERED_SET_SUMMARY_CHUNKS_PER_WORK_UNIT) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				uintptr_t unitTop = OMR_MIN(unitBase + SCAVENGER_REMEMBERED_SET_SUMMARY_CHUNKS_PER_WORK_UNIT, chunkCount);
+				for (uintptr_t chunkIndex = unitBase; chunkIndex < unitTop; chunkIndex++) {
+					/* Only this thread can add objects of this chunk back to the summary */
+					omrobjectptr_t firstObject = _rememberedSetSummary->clearChunk(chunkIndex);
+					if (NULL != firstObject) {
+						GC_RememberedSetSummaryChunkIterator chunkIterator(_extensions, _tenureMemorySubSpace, firstObject, _rememberedSetSummary->getChunkTop(chunkIndex));
+						omrobjectptr_t objectPtr = NULL;
+						while (NULL != (objectPtr = chunkIterator.nextObject())) {
+							pruneRememberedObject(env, objectPtr);
+						}
+					}
+				}
+			}
+		}
+
+		/* Huge objects are not part of the heap chunks, verify or clear their remembered bits directly */
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_HugeObjectSpace *hugeObjectSpace = _extensions->hugeObjectSpace;
+			if ((NULL != _rememberedSetSummary->clearChunk(chunkCount)) && (NULL != hugeObjectSpace)) {
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = hugeObjectSpace->nextObject(objectPtr))) {
+					if (_extensions->objectModel.isRemembered(objectPtr)) {
+						pruneRememberedObject(env, objectPtr);
+					}
+				}
+			}
+		}
+
+		/* Retained objects were added to the list, fragment must be flushed */
+		flushRememberedSet(env);
+	}
+}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 void
 MM_Scavenger::scavengeRememberedSetListDirect(MM_EnvironmentStandard *env)
@@ -3246,6 +3659,9 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 		}
 	} else {
 		if (!IS_CONCURRENT_ENABLED) {
+			if (_isRememberedSetSummaryDirtyAtTheBeginning) {
+				scavengeRememberedSetSummary(env);
+			}
 			scavengeRememberedSetList(env);
 		}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -3945,6 +4361,24 @@ MM_Scavenger::backoutFixupAndReverseForwardPointersInSurvivor(MM_EnvironmentStan
 					omrobjectptr_t forwardedObject = header.getForwardedObject();
 					omrobjectptr_t originalObject = header.getObject();
 
+					if (0 != _remapCopyPageSize) {
+						/* the interior pages of a large original may have been moved to its copy, so bring them back */
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+						uintptr_t objectSizeInBytes = _extensions->objectModel.getConsumedSizeInBytesWithHeaderBeforeMove(forwardedObject);
+#else
+						uintptr_t objectSizeInBytes = _extensions->objectModel.getConsumedSizeInBytesWithHeader(forwardedObject);
+#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+						uintptr_t moveBase = 0;
+						uintptr_t moveTop = 0;
+						uintptr_t delta = (uintptr_t)forwardedObject - (uintptr_t)originalObject;
+						if ((objectSizeInBytes >= _extensions->scavengerRemapCopyThreshold)
+							&& (0 == (delta % _remapCopyPageSize))
+							&& getMovablePages(originalObject, objectSizeInBytes, &moveBase, &moveTop)
+						) {
+							memcpy((void *)moveBase, (void *)(moveBase + delta), moveTop - moveBase);
+						}
+					}
+
 					_delegate.reverseForwardedObject(env, &header);
 
 					/* A reverse forwarded object is a hole whose 'next' pointer actually points at the original object.
@@ -4001,6 +4435,23 @@ _delegate.fixupDestroyedSlot(env, &header, _activeSubSpace);
 		}
 	}
 #endif /* defined (OMR_GC_COMPRESSED_POINTERS) */
+
+	if (0 != _remapCopyPageSize) {
+		/* Restored pages came from copies whose slots may already refer to other copies, so back those out as well */
+		GC_MemorySubSpaceRegionIteratorStandard evacuateRegionIterator2(_activeSubSpace);
+		while(NULL != (rootRegion = evacuateRegionIterator2.nextRegion())) {
+			if (isObjectInEvacuateMemory((omrobjectptr_t )rootRegion->getLowAddress())) {
+				GC_ObjectHeapIteratorAddressOrderedList evacuateHeapIterator(_extensions, rootRegion, false);
+				omrobjectptr_t objectPtr = NULL;
+
+				while((objectPtr = evacuateHeapIterator.nextObjectNoAdvance()) != NULL) {
+					if (_extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr) >= _extensions->scavengerRemapCopyThreshold) {
+						backOutObjectScan(env, objectPtr);
+					}
+				}
+			}
+		}
+	}
 }
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -4192,6 +4643,12 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 		 */
 		_extensions->scavengerRsoScanUnsafe = true;
 
+		/* Summary chunks may record objects being backed out, so back out the whole remembered set through the overflow walk */
+		if (isRememberedSetSummaryDirty()) {
+			setRememberedSetOverflowState();
+			_rememberedSetSummary->clear();
+		}
+
 		if(isRememberedSetInOverflowState()) {
 			GC_MemorySubSpaceRegionIterator evacuateRegionIterator(_activeSubSpace);
 			MM_HeapRegionDescriptor* rootRegion;
@@ -4255,6 +4712,16 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 					backOutObjectScan(env, objectOverflow);
 				}
 
+				/* Huge objects are not part of the tenure walk, back out the remembered ones directly */
+				MM_HugeObjectSpace *hugeObjectSpace = _extensions->hugeObjectSpace;
+				if (NULL != hugeObjectSpace) {
+					while (NULL != (objectOverflow = hugeObjectSpace->nextObject(objectOverflow))) {
+						if (_extensions->objectModel.isRemembered(objectOverflow)) {
+							backOutObjectScan(env, objectOverflow);
+						}
+					}
+				}
+
 				/* Walk all classes that are flagged as remembered */
 				_delegate.backOutIndirectObjects(env);
 			}
@@ -4308,6 +4775,10 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 	/* Flush any VM level changes to prepare for a safe slot walk */
 	GC_OMRVMInterface::flushCachesForGC(env);
 
+	if (firstIncrement && _extensions->verifyHeapBeforeGC) {
+		_extensions->heapVerifier->verify(env, NULL, "before scavenge");
+	}
+
 	_extensions->incrementScavengerStats._gcCount += 1;
 	if (firstIncrement)	{
 		_extensions->scavengerStats._gcCount += 1;
@@ -4402,6 +4873,10 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 			/* Build free list in survivor profile - the scavenge was unsuccessful, so rebuild the free list */
 			_activeSubSpace->mainTeardownForAbortedGC(env);
 		}
+
+		if (_extensions->verifyHeapAfterGC) {
+			_extensions->heapVerifier->verify(env, NULL, "after scavenge");
+		}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		/* Although evacuate is functionally irrelevant at this point since we are finishing the cycle,
 		 * it is still useful for debugging (CS must not see live objects in Evacuate).
@@ -4427,6 +4902,14 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 		env->_cycleState->_endTime = omrtime_hires_clock();
 		reportGCCycleFinalIncrementEnding(env);
 
+		if ((NULL != _hotFieldProfile) && _extensions->scavengerHotFieldProfileReport) {
+			_hotFieldProfile->report(env);
+		}
+
+		if ((NULL != _extensions->pretenureProfile) && _extensions->scavengerPretenureReport) {
+			_extensions->pretenureProfile->report(env);
+		}
+
 	} // if lastIncrement
 
 
@@ -4839,8 +5322,8 @@ MM_Scavenger::internalGarbageCollect(MM_EnvironmentBase *envBase, MM_MemorySubSp
 		}
 	}
 
-	/* Check if there is an RSO and the heap is not safely walkable */
-	if(isRememberedSetInOverflowState() && _extensions->scavengerRsoScanUnsafe) {
+	/* Check if there is an RSO, or summary chunks to walk, and the heap is not safely walkable */
+	if((isRememberedSetInOverflowState() || isRememberedSetSummaryDirty()) && _extensions->scavengerRsoScanUnsafe) {
 		/* NOTE: No need to set that the collect was unsuccessful - we will actually execute
 		 * the scavenger after percolation.
 		 */
@@ -4963,6 +5446,76 @@ MM_Scavenger::globalCollectionComplete(MM_EnvironmentBase *env)
 	_extensions->scavengerStats._nextScavengeWillPercolate = false;
 	setFailedTenureLargestObject(0);
 	_countSinceForcingGlobalGC = 0;
+
+	/* The global collection may have swept or moved the objects recorded in the remembered set summary */
+	if (isRememberedSetSummaryDirty()) {
+		if (isRememberedSetInOverflowState()) {
+			/* The next scavenge walks the whole tenure space, which rebuilds the summary */
+			_rememberedSetSummary->clear();
+		} else if (_extensions->scavengerRsoScanUnsafe) {
+			/* The heap was not fixed up for walking, rebuild the remembered set on the next scavenge */
+			_rememberedSetSummary->clear();
+			setRememberedSetOverflowState();
+		} else {
+			rebuildRememberedSet(env);
+		}
+	}
+}
+
+void
+MM_Scavenger::rebuildRememberedSet(MM_EnvironmentBase *env)
+{
+	_extensions->rememberedSet.clear(env);
+	_rememberedSetSummary->clear();
+
+	J9VMGC_SublistFragment rememberedSetFragment;
+	rememberedSetFragment.fragmentCurrent = NULL;
+	rememberedSetFragment.fragmentTop = NULL;
+	rememberedSetFragment.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
+	rememberedSetFragment.parentList = &_extensions->rememberedSet;
+	rememberedSetFragment.deferredFlushID = 0;
+	rememberedSetFragment.count = 0;
+
+	/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = objectIterator.nextObject())) {
+			if (_extensions->objectModel.isRemembered(objectPtr)) {
+				addToRebuiltRememberedSet(env, &rememberedSetFragment, objectPtr);
+			}
+		}
+	}
+
+	/* Huge objects are not part of the tenure walk, check their remembered bits directly */
+	MM_HugeObjectSpace *hugeObjectSpace = _extensions->hugeObjectSpace;
+	if (NULL != hugeObjectSpace) {
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = hugeObjectSpace->nextObject(objectPtr))) {
+			if (_extensions->objectModel.isRemembered(objectPtr)) {
+				addToRebuiltRememberedSet(env, &rememberedSetFragment, objectPtr);
+			}
+		}
+	}
+
+	MM_SublistFragment::flush(&rememberedSetFragment);
+}
+
+void
+MM_Scavenger::addToRebuiltRememberedSet(MM_EnvironmentBase *env, J9VMGC_SublistFragment *rememberedSetFragment, omrobjectptr_t objectPtr)
+{
+	if (rememberedSetFragment->fragmentCurrent >= rememberedSetFragment->fragmentTop) {
+		MM_SublistFragment fragment(rememberedSetFragment);
+		MM_SublistFragment::flush(rememberedSetFragment);
+		if (!_extensions->rememberedSet.allocate(env, &fragment)) {
+			_rememberedSetSummary->add(objectPtr);
+			return;
+		}
+	}
+	rememberedSetFragment->count += 1;
+	*rememberedSetFragment->fragmentCurrent++ = (uintptr_t)objectPtr;
 }
 
 void
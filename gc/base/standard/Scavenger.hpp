@@ -42,6 +42,7 @@
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "SublistPool.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -49,13 +50,14 @@ class MM_AllocateDescription;
 class MM_CollectorLanguageInterface;
 class MM_EnvironmentBase;
 class MM_HeapRegionManager;
+class MM_HotFieldProfile;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceSemiSpace;
 class MM_ParallelDispatcher;
 class MM_PhysicalSubArena;
+class MM_RememberedSetSummary;
 class MM_RSOverflow;
-class MM_SublistPool;
 
 struct OMR_VM;
 
@@ -123,6 +125,17 @@ private:
 
 	volatile uintptr_t _backOutDoneIndex; /**< snapshot of _doneIndex, when backOut was detected */
 
+	MM_HotFieldProfile *_hotFieldProfile; /**< sampled per-class hot field profile (NULL unless scavengerHotFieldProfiling is enabled) */
+
+	uintptr_t _remapCopyPageSize; /**< page size used to copy large objects by moving their pages in this scavenge, 0 if disabled */
+	volatile bool _remapCopyUnsupported; /**< set once the heap fails to move pages, so that later scavenges always copy */
+
+	MM_RememberedSetSummary *_rememberedSetSummary; /**< remembered objects that did not fit in the remembered set list (NULL for concurrent scavenger, remembered set overflow is used instead) */
+	bool _isRememberedSetSummaryDirtyAtTheBeginning; /**< Cached summary dirty flag at the beginning of the scavenge */
+	MM_SublistPool _rememberedSetSummaryScanList; /**< remembered objects collected from the summary chunks, scanned in parallel */
+	volatile bool _rememberedSetSummaryScanListOverflow; /**< set if the scan list could not hold all of the objects collected from the summary */
+	bool _shouldPruneRememberedSetSummary; /**< set if the summary has chunks to prune at the end of the scavenge */
+
 	void *_heapBase;  /**< Cached base pointer of heap */
 	void *_heapTop;  /**< Cached top pointer of heap */
 	MM_HeapRegionManager *_regionManager;
@@ -301,6 +314,37 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/* Depth copy the profiled hot fields of an object that has just been tenured, so that the referents
+	 * are placed next to it in tenure space. Used only for classes with no language declared hot field.
+	 * @param destinationObjectPtr The tenured copy of the object
+	 */
+	MMINLINE void depthCopyProfiledHotFields(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr);
+
+	/* Copy a large object by moving the whole pages it spans to its destination, which must be at the same offset
+	 * within a page, and copying only the partial pages at either end. The page holding the start of the evacuated
+	 * object is always copied so that its forwarding pointer survives. Falls back to memcpy if the heap cannot move pages.
+	 * @param destinationObjectPtr The destination of the object
+	 * @param objectPtr The evacuated object
+	 * @param objectCopySizeInBytes The number of bytes to copy
+	 */
+	MMINLINE void copyByMovingPages(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, omrobjectptr_t objectPtr, uintptr_t objectCopySizeInBytes);
+
+	/* Get the range of an evacuated object that copyByMovingPages() moves rather than copies.
+	 * @param objectPtr The evacuated object
+	 * @param objectCopySizeInBytes The number of bytes copied
+	 * @param[out] moveBase Receives the start of the page aligned range
+	 * @param[out] moveTop Receives the end of the page aligned range
+	 * @return true if the range is not empty
+	 */
+	MMINLINE bool getMovablePages(omrobjectptr_t objectPtr, uintptr_t objectCopySizeInBytes, uintptr_t *moveBase, uintptr_t *moveTop);
+
+	/* Select the object being scanned for hot field profiling, once every scavengerHotFieldProfileSampleInterval objects per thread.
+	 * @param objectScanner The scanner for the object
+	 * @param objectPtr The object being scanned
+	 * @return The class token of the object if its slots should be sampled, 0 otherwise
+	 */
+	MMINLINE uintptr_t getHotFieldProfileSampleToken(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, omrobjectptr_t objectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -356,8 +400,30 @@ public:
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
+	MMINLINE void pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
 
+	/**
+	 * Scavenge the remembered objects of the summary chunks, collecting them first so that the
+	 * chunks are walked before any object is copied into tenure space.
+	 */
+	void scavengeRememberedSetSummary(MM_EnvironmentStandard *env);
+
+	/**
+	 * Walk the summary chunks and verify or clear the remembered bits of their objects. Retained
+	 * objects are moved back to the remembered set list while there is room in it.
+	 */
+	void pruneRememberedSetSummary(MM_EnvironmentStandard *env);
+
+	/**
+	 * Rebuild the remembered set list and summary from the remembered bits in the tenure space,
+	 * after a global collection has swept or moved the objects recorded in the summary.
+	 */
+	void rebuildRememberedSet(MM_EnvironmentBase *env);
+	void addToRebuiltRememberedSet(MM_EnvironmentBase *env, J9VMGC_SublistFragment *rememberedSetFragment, omrobjectptr_t objectPtr);
+
+	MMINLINE bool isRememberedSetSummaryDirty();
+
 	/**
 	 * Checks if the  Object should be remembered or not
 	 * @param env Standard Environment
@@ -750,6 +816,13 @@ public:
 
 	MM_ScavengerDelegate* getDelegate() { return &_delegate; }
 
+	/**
+	 * Languages that sample field accesses themselves may record them against this profile
+	 * (see MM_HotFieldProfile::recordFieldAccess()).
+	 * @return the hot field profile, or NULL if scavengerHotFieldProfiling is not enabled
+	 */
+	MM_HotFieldProfile *getHotFieldProfile() { return _hotFieldProfile; }
+
 	/* Read Barrier Verifier specific methods */
 #if defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS)
 	virtual void scavenger_poisonSlots(MM_EnvironmentBase *env);
@@ -1005,6 +1078,14 @@ public:
 		, _rescanThreadsForRememberedObjects(false)
 #endif
 		, _backOutDoneIndex(0)
+		, _hotFieldProfile(NULL)
+		, _remapCopyPageSize(0)
+		, _remapCopyUnsupported(false)
+		, _rememberedSetSummary(NULL)
+		, _isRememberedSetSummaryDirtyAtTheBeginning(false)
+		, _rememberedSetSummaryScanList()
+		, _rememberedSetSummaryScanListOverflow(false)
+		, _shouldPruneRememberedSetSummary(false)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
 		, _regionManager(_extensions->heapRegionManager)
@@ -29,6 +29,7 @@
 #include "Configuration.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HugeObjectSpace.hpp"
 #include "ObjectModel.hpp"
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
@@ -54,7 +55,10 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (extensions->scavengerEnabled) {
-		if (extensions->isOld(parentObject) && !extensions->isOld(childObject)) {
+		/* huge objects are old but live outside of the tenure range */
+		MM_HugeObjectSpace *hugeObjectSpace = extensions->hugeObjectSpace;
+		bool isParentOld = extensions->isOld(parentObject) || ((NULL != hugeObjectSpace) && hugeObjectSpace->isHugeObject(parentObject));
+		if (isParentOld && !extensions->isOld(childObject)) {
 			if (extensions->objectModel.atomicSetRememberedState(parentObject, STATE_REMEMBERED)) {
 				/* The object has been successfully marked as REMEMBERED - allocate an entry in the remembered set */
 				extensions->scavenger->addToRememberedSetFragment((MM_EnvironmentStandard *)env, parentObject);
@@ -51,6 +51,10 @@ omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 class MM_AllocateInitialization;
 /* Caller is expected to initialize the allocation description (MM_AllocateInitialization::getAllocateDescription()) prior to call */
 omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, MM_AllocateInitialization *allocator);
+/* Allocates count objects contiguously in address order with one heap allocation; caller initializes each allocation
+ * description prior to call. Returns false if any object could not be allocated or initialized, or if the batch cannot
+ * be allocated as a unit (mixed flags, indexable or huge), in which case objects should be allocated individually. */
+bool OMR_GC_AllocateObjects(OMR_VMThread * omrVMThread, MM_AllocateInitialization **allocators, uintptr_t count, omrobjectptr_t *objects);
 #endif
 
 #endif /* MM_OMRGCAPI_HPP_ */
@@ -39,6 +39,15 @@ OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, MM_AllocateInitialization *all
 	return allocator->allocateAndInitializeObject(omrVMThread);
 }
 
+bool
+OMR_GC_AllocateObjects(OMR_VMThread * omrVMThread, MM_AllocateInitialization **allocators, uintptr_t count, omrobjectptr_t *objects)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	Assert_MM_true(NULL != env->getExtensions()->getGlobalCollector());
+	Assert_MM_true(0 < count);
+	return MM_AllocateInitialization::allocateAndInitializeObjects(omrVMThread, allocators, count, objects);
+}
+
 omrobjectptr_t
 OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t allocationCategory, uintptr_t requiredSizeInBytes, uintptr_t allocationFlags)
 {
@@ -37,6 +37,7 @@
 #include "HeapMemorySubSpaceIterator.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionDescriptor.hpp"
+#include "IdleHeapRelease.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "ModronAssertions.h"
@@ -67,6 +68,12 @@ collectorCreationHelper(OMR_VM *omrVM, MM_EnvironmentBase *env)
 		if (!extensions->getGlobalCollector()->collectorStartup(extensions)) {
 			omrtty_printf("Failed to start global collector.\n");
 			rc = OMR_ERROR_INTERNAL;
+		} else if (0 != extensions->idleHeapReleaseDelay) {
+			extensions->idleHeapRelease = MM_IdleHeapRelease::newInstance(env);
+			if ((NULL == extensions->idleHeapRelease) || !extensions->idleHeapRelease->startup()) {
+				omrtty_printf("Failed to start idle heap release thread.\n");
+				rc = OMR_ERROR_INTERNAL;
+			}
 		}
 	}
 
@@ -297,6 +304,13 @@ OMR_GC_ShutdownCollector(OMR_VM* vm)
 	if (NULL != extensions) {
 		MM_Collector *globalCollector = extensions->getGlobalCollector();
 
+		if (NULL != extensions->idleHeapRelease) {
+			MM_EnvironmentBase env(vm);
+			extensions->idleHeapRelease->shutdown();
+			extensions->idleHeapRelease->kill(&env);
+			extensions->idleHeapRelease = NULL;
+		}
+
 		if (NULL != globalCollector) {
 			globalCollector->collectorShutdown(extensions);
 		}
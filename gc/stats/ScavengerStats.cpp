@@ -79,6 +79,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 	,_flipDiscardBytes(0)
 	,_tenureDiscardBytes(0)
+	,_remapCopyCount(0)
+	,_remapCopyBytes(0)
 	,_survivorTLHRemainderCount(0)
 	,_tenureTLHRemainderCount(0)
 	,_semiSpaceAllocBytesAcumulation(0)
@@ -184,6 +186,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	 */
 	_flipDiscardBytes = 0;
 	_tenureDiscardBytes = 0;
+	_remapCopyCount = 0;
+	_remapCopyBytes = 0;
 
 	_survivorTLHRemainderCount = 0;
 	_tenureTLHRemainderCount = 0;
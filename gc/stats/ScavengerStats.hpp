@@ -126,6 +126,8 @@ public:
 
 	uintptr_t _flipDiscardBytes;		/**< Bytes of survivor discarded by copy scan cache */
 	uintptr_t _tenureDiscardBytes;		/**< Bytes of tenure discarded by copy scan cache */
+	uintptr_t _remapCopyCount;		/**< Objects whose interior pages were moved rather than copied */
+	uintptr_t _remapCopyBytes;		/**< Bytes of those objects moved by remapping pages */
 
 	uintptr_t _survivorTLHRemainderCount;
 	uintptr_t _tenureTLHRemainderCount;
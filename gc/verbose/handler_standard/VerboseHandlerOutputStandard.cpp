@@ -69,6 +69,7 @@ static void verboseHandlerConcurrentRememberedSetScanEnd(J9HookInterface** hook,
 static void verboseHandlerConcurrentCardCleaningEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentTracingEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentKickoff(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerConcurrentForecast(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentHalted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentCollectionStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
@@ -148,6 +149,7 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	/* Concurrent */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_KICKOFF, verboseHandlerConcurrentKickoff, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_FORECAST, verboseHandlerConcurrentForecast, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_HALTED, verboseHandlerConcurrentHalted, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_START, verboseHandlerConcurrentCollectionStart, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_ABORTED, verboseHandlerConcurrentAborted, OMR_GET_CALLSITE(), (void *)this);
@@ -207,6 +209,7 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	/* Concurrent */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_KICKOFF, verboseHandlerConcurrentKickoff, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_FORECAST, verboseHandlerConcurrentForecast, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_HALTED, verboseHandlerConcurrentHalted, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_START, verboseHandlerConcurrentCollectionStart, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_ABORTED, verboseHandlerConcurrentAborted, NULL);
@@ -422,6 +425,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
 	}
+	if (0 != scavengerStats->_remapCopyCount) {
+		writer->formatAndOutput(env, 1, "<memory-remapped objects=\"%zu\" bytes=\"%zu\" />",
+				scavengerStats->_remapCopyCount, scavengerStats->_remapCopyBytes);
+	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedFlipCount, scavengerStats->_failedFlipBytes);
@@ -695,6 +702,9 @@ MM_VerboseHandlerOutputStandard::getConcurrentKickoffReason(void *eventData)
 	case KICKOFF_THRESHOLD_REACHED:
 		reasonString = "threshold reached";
 		break;
+	case KICKOFF_FORECAST_REACHED:
+		reasonString = "allocation forecast reached";
+		break;
 	case NEXT_SCAVENGE_WILL_PERCOLATE:
 		reasonString = "next scavenge will percolate";
 		break;
@@ -715,6 +725,30 @@ MM_VerboseHandlerOutputStandard::handleConcurrentKickoffInternal(MM_EnvironmentB
 	/* Empty stub */
 }
 
+void
+MM_VerboseHandlerOutputStandard::handleConcurrentForecast(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ConcurrentForecastEvent* event = (MM_ConcurrentForecastEvent*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	char tagTemplate[200];
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, 0, "<concurrent-forecast %s>", tagTemplate);
+	writer->formatAndOutput(
+			env, 1, "<forecast thresholdFreeBytes=\"%zu\" predictedms=\"%llu.%03llu\" actualms=\"%llu.%03llu\" allocationBytesPerMs=\"%zu\" markingBytesPerMs=\"%zu\" completed=\"%s\" />",
+			event->kickOffThreshold,
+			event->predictedDuration / 1000, event->predictedDuration % 1000,
+			event->actualDuration / 1000, event->actualDuration % 1000,
+			event->allocationRate, event->markingRate,
+			(0 != event->completed) ? "true" : "false");
+	writer->formatAndOutput(env, 0, "</concurrent-forecast>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleConcurrentHalted(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
@@ -1125,6 +1159,12 @@ verboseHandlerConcurrentKickoff(J9HookInterface** hook, uintptr_t eventNum, void
 	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentKickoff(hook, eventNum, eventData);
 }
 
+void
+verboseHandlerConcurrentForecast(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentForecast(hook, eventNum, eventData);
+}
+
 void
 verboseHandlerConcurrentHalted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
 {
@@ -193,6 +193,14 @@ public:
 	 */
 	void handleConcurrentKickoff(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write verbose stanza for the concurrent kickoff forecast of a finished cycle.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleConcurrentForecast(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
 	/**
 	 * Write verbose stanza for concurrent halted event.
 	 * @param hook Hook interface used by the JVM.
@@ -287,6 +287,7 @@ struct ModronLnrlOptions {
 #define DEFAULT_MINIMUM_CONTRACTION_RATIO	10
 
 #define DESIRED_SUBAREA_SIZE		((uintptr_t)(4*1024*1024))
+#define PARTIAL_COMPACT_SUBAREA_SIZE		((uintptr_t)(512*1024))
 
 typedef enum {
 	COMPACT_NONE = 0,
@@ -348,7 +349,8 @@ typedef enum {
 	NO_KICKOFF_REASON=1,
 	KICKOFF_THRESHOLD_REACHED,
 	NEXT_SCAVENGE_WILL_PERCOLATE,
-	LANGUAGE_DEFINED_REASON
+	LANGUAGE_DEFINED_REASON,
+	KICKOFF_FORECAST_REACHED
 } ConcurrentKickoffReason;
 
 /**
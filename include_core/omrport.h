@@ -2377,6 +2377,8 @@ typedef struct OMRPortLibrary {
 	int32_t (*vmem_get_process_memory_size)(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
 	/** see @ref omrvmem.c::omrvmem_disclaim_dir "omrvmem_disclaim_dir"*/
 	const char *(*vmem_disclaim_dir)(struct OMRPortLibrary *portLibrary) ;
+	/** see @ref omrvmem.c::omrvmem_move_memory "omrvmem_move_memory"*/
+	int32_t (*vmem_move_memory)(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier) ;
 	/** see @ref omrstr.c::omrstr_startup "omrstr_startup"*/
 	int32_t (*str_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_shutdown "omrstr_shutdown"*/
@@ -3183,6 +3185,7 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrvmem_get_available_physical_memory(param1) privateOmrPortLibrary->vmem_get_available_physical_memory(privateOmrPortLibrary, (param1))
 #define omrvmem_get_process_memory_size(param1,param2) privateOmrPortLibrary->vmem_get_process_memory_size(privateOmrPortLibrary, (param1), (param2))
 #define omrvmem_disclaim_dir() privateOmrPortLibrary->vmem_disclaim_dir(privateOmrPortLibrary)
+#define omrvmem_move_memory(param1,param2,param3,param4) privateOmrPortLibrary->vmem_move_memory(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrstr_startup() privateOmrPortLibrary->str_startup(privateOmrPortLibrary)
 #define omrstr_shutdown() privateOmrPortLibrary->str_shutdown(privateOmrPortLibrary)
 #define omrstr_printf(...) privateOmrPortLibrary->str_printf(privateOmrPortLibrary, __VA_ARGS__)
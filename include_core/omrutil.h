@@ -367,6 +367,16 @@ uint32_t getCacheLineSize(void);
 void OMRZeroMemory(void *ptr, uintptr_t length);
 
 
+/**
+* @brief Zero memory that will not be touched soon without reading it into the data cache
+* (streaming stores on x86, DC ZVA on AArch64, dcbz on POWER).
+* @param *ptr
+* @param length
+* @return void
+*/
+void OMRZeroMemoryNonTemporal(void *ptr, uintptr_t length);
+
+
 /**
 * @brief
 * @param *dest
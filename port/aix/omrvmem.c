@@ -724,6 +724,12 @@ omrvmem_disclaim_dir(struct OMRPortLibrary *portLibrary)
 	return NULL;
 }
 
+int32_t
+omrvmem_move_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
 /**
  * @internal
  * Update J9PortVmIdentifier structure
@@ -197,6 +197,7 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrvmem_get_available_physical_memory, /* vmem_get_available_physical_memory */
 	omrvmem_get_process_memory_size, /* vmem_get_process_memory_size */
 	omrvmem_disclaim_dir, /* vmem_disclaim_dir */
+	omrvmem_move_memory, /* vmem_move_memory */
 	omrstr_startup, /* str_startup */
 	omrstr_shutdown, /* str_shutdown */
 	omrstr_printf, /* str_printf */
@@ -453,3 +453,28 @@ omrvmem_disclaim_dir(struct OMRPortLibrary *portLibrary)
 {
 	return NULL;
 }
+
+/**
+ * Move the pages backing a committed range of a reserved block to another committed range of
+ * the same block, without copying their contents. On success the target range holds the
+ * previous contents of the source range, and the source range stays committed and reads as
+ * zeros. On failure neither range is changed, and the caller is expected to copy the memory
+ * instead.
+ *
+ * Moving is only implemented on Linux, for private anonymous mappings, and needs
+ * mremap(MREMAP_DONTUNMAP) (Linux 5.7). On all other platforms
+ * OMRPORT_ERROR_VMEM_NOT_SUPPORTED is always returned.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] source The page aligned start of the range to move.
+ * @param[in] target The page aligned start of the range to move to, not overlapping the source range.
+ * @param[in] byteAmount The number of bytes to move, a multiple of the page size.
+ * @param[in] identifier Descriptor for the virtual memory block containing both ranges.
+ *
+ * @return 0 on success, a negative error code on failure.
+ */
+int32_t
+omrvmem_move_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
@@ -52,6 +52,10 @@
 #include <limits.h>
 
 #include <sys/mman.h>
+/* MREMAP_DONTUNMAP is not defined in <sys/mman.h> before glibc 2.32 */
+#if !defined(MREMAP_DONTUNMAP)
+#define MREMAP_DONTUNMAP 4
+#endif /* MREMAP_DONTUNMAP */
 /* MADV_HUGEPAGE is not defined in <sys/mman.h> in RHEL 6 & CentOS 6 */
 #if !defined(MADV_HUGEPAGE)
 #define MADV_HUGEPAGE 14
@@ -1010,6 +1014,36 @@ omrvmem_disclaim_dir(struct OMRPortLibrary *portLibrary)
 	return PPG_vmemTmpDirPath;
 }
 
+int32_t
+omrvmem_move_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	int32_t result = OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+
+	Trc_PRT_vmem_omrvmem_move_memory_Entry(source, target, byteAmount);
+
+	if (!rangeIsValid(identifier, source, byteAmount) || !rangeIsValid(identifier, target, byteAmount)) {
+		result = OMRPORT_ERROR_VMEM_INVALID_PARAMS;
+	} else if ((OMRPORT_VMEM_RESERVE_USED_MMAP == identifier->allocator) && (OMRPORT_INVALID_FD == identifier->fd)) {
+		/* only private anonymous pages can be moved while leaving the source range mapped */
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(source, identifier->pageSize);
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(target, identifier->pageSize);
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(byteAmount, identifier->pageSize);
+
+		if (0 == byteAmount) {
+			result = 0;
+		} else if (target == mremap(source, byteAmount, byteAmount, MREMAP_MAYMOVE | MREMAP_FIXED | MREMAP_DONTUNMAP, target)) {
+			result = 0;
+		} else {
+			/* kernels before 5.7 reject MREMAP_DONTUNMAP, and nothing has been moved */
+			Trc_PRT_vmem_omrvmem_move_memory_failure(errno, source, target, byteAmount);
+			result = OMRPORT_ERROR_VMEM_OPFAILED;
+		}
+	}
+
+	Trc_PRT_vmem_omrvmem_move_memory_Exit(result);
+	return result;
+}
+
 
 /* Get the state of Transparent HugePage (THP) from OS
  *
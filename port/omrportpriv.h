@@ -935,6 +935,8 @@ extern J9_CFUNC int32_t
 omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
 extern J9_CFUNC const char *
 omrvmem_disclaim_dir(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC int32_t
+omrvmem_move_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier);
 /* J9SourcePort*/
 extern J9_CFUNC int32_t
 omrport_shutdown_library(struct OMRPortLibrary *portLibrary);
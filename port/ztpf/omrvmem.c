@@ -901,6 +901,12 @@ omrvmem_disclaim_dir(struct OMRPortLibrary *portLibrary)
 	return NULL;
 }
 
+int32_t
+omrvmem_move_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
 static uintptr_t
 get_hugepages_info(struct OMRPortLibrary *portLibrary,
 		vmem_hugepage_info_t *page_info)
@@ -28,6 +28,9 @@
 #include <stdlib.h>
 #endif /* defined(J9ZOS390) || (defined(LINUX) && defined(S390)) */
 #include <string.h>
+#if defined(OMR_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#endif /* defined(OMR_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64)) */
 
 #if defined(J9ZOS39064)
 #include "omrgcconsts.h"
@@ -47,6 +50,10 @@ extern "C" void J9ZERZ10(void *ptr, uintptr_t length);
 static uint32_t cacheLineSize = 0;
 #endif /* defined(AIXPPC) || defined(LINUXPPC) */
 
+#if defined(OMR_ARCH_AARCH64) && defined(__GNUC__)
+static uintptr_t zeroBlockSize = 0;
+#endif /* defined(OMR_ARCH_AARCH64) && defined(__GNUC__) */
+
 #if defined(J9ZOS390)
 struct IHAPSA {
 	char filler1[204];			/* Filler to get to offset 204 or X'CC'  */
@@ -147,6 +154,76 @@ OMRZeroMemory(void *ptr, uintptr_t length)
 }
 
 
+void
+OMRZeroMemoryNonTemporal(void *ptr, uintptr_t length)
+{
+#if defined(OMR_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64))
+	char *addr = static_cast<char*>(ptr);
+	char *limit = (char *)((uintptr_t)ptr + length);
+	char *alignedBase = (char *)(((uintptr_t)addr + 15) & ~(uintptr_t)15);
+	char *alignedTop = (char *)((uintptr_t)limit & ~(uintptr_t)15);
+
+	/* Short or unaligned ranges are not worth bypassing the cache for */
+	if ((length < 256) || (alignedBase >= alignedTop)) {
+		memset(ptr, 0, (size_t)length);
+		return;
+	}
+
+	memset(addr, 0, (size_t)(alignedBase - addr));
+	__m128i zero = _mm_setzero_si128();
+	for (addr = alignedBase; addr < alignedTop; addr += 16) {
+		_mm_stream_si128((__m128i *)addr, zero);
+	}
+	memset(alignedTop, 0, (size_t)(limit - alignedTop));
+
+	/* Streaming stores are weakly ordered, order them before any store publishing the memory */
+	_mm_sfence();
+#elif defined(OMR_ARCH_AARCH64) && defined(__GNUC__)
+	char *addr = static_cast<char*>(ptr);
+	char *limit = NULL;
+	uintptr_t localZeroBlockSize = zeroBlockSize;
+
+	/* one-time-only read of the DC ZVA block size, UDATA_MAX if DC ZVA is prohibited */
+	if (0 == localZeroBlockSize) {
+		uint64_t dczid = 0;
+		__asm__ __volatile__("mrs %0, dczid_el0" : "=r"(dczid));
+		if (0 != (dczid & 0x10)) {
+			localZeroBlockSize = UDATA_MAX;
+		} else {
+			localZeroBlockSize = (uintptr_t)4 << (dczid & 0xf);
+		}
+		zeroBlockSize = localZeroBlockSize;
+	}
+
+	if ((UDATA_MAX == localZeroBlockSize) || (length < (2 * localZeroBlockSize))) {
+		memset(ptr, 0, (size_t)length);
+		return;
+	}
+
+	/* Zero any initial portion to first block boundary */
+	limit = (char *)(((uintptr_t)addr + localZeroBlockSize - 1) & ~(localZeroBlockSize - 1));
+	memset(addr, 0, (size_t)(limit - addr));
+	addr = limit;
+
+	/* DC ZVA full blocks, which allocates the lines zeroed without reading them from memory */
+	limit = (char *)(((uintptr_t)ptr + length) & ~(localZeroBlockSize - 1));
+	for (; addr < limit; addr += localZeroBlockSize) {
+		__asm__ __volatile__(
+				"dc zva, %0"
+				: /* no outputs */
+				: "r"(addr)
+				: /* clobbers */ "memory");
+	}
+
+	/* zero final portion smaller than a block */
+	memset(addr, 0, (size_t)(((uintptr_t)ptr + length) - (uintptr_t)addr));
+#else /* defined(OMR_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64)) */
+	/* dcbz on POWER already avoids reading the lines being zeroed */
+	OMRZeroMemory(ptr, length);
+#endif /* defined(OMR_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64)) */
+}
+
+
 uint32_t
 getCacheLineSize(void)
 {